@@ -0,0 +1,144 @@
+#include <cinolib/meshes/meshes.h>
+#include <cinolib/octree.h>
+#include <cinolib/soup_octree.h>
+#include <cinolib/icosphere.h>
+#include <cinolib/vector_serialization.h>
+#include <cinolib/memory_usage.h>
+#include <cinolib/how_many_seconds.h>
+
+/* Compares build time, memory footprint and query time of the classic
+ * Octree (one heap allocated item per triangle) against the SoupOctree,
+ * both in OWNED mode (flat copy of the coordinates) and in REFERENCE mode
+ * (no copy, the soup points to the mesh vertices).
+ *
+ * The refit variant deforms the mesh referenced by a SoupOctree and compares
+ * the time needed to refit the tree against the time of a full rebuild.
+ *
+ * Usage: octree_soa [icosphere subdivisions] [legacy|owned|reference|refit|all]
+ *
+ * Resident memory is measured as the growth of the RSS of the process, hence
+ * it is accurate only if each variant runs in a separate process
+*/
+
+using namespace cinolib;
+typedef std::chrono::steady_clock Time;
+
+template<class Tree>
+void run_queries(const Tree & tree, const std::vector<vec3d> & queries, double & t_closest, double & t_ray)
+{
+    Time::time_point t0 = Time::now();
+    for(const vec3d & q : queries) tree.closest_point(q);
+    Time::time_point t1 = Time::now();
+    for(const vec3d & q : queries)
+    {
+        double t;
+        uint   id;
+        tree.intersects_ray(q, -q, t, id);
+    }
+    Time::time_point t2 = Time::now();
+    t_closest = how_many_seconds(t0,t1);
+    t_ray     = how_many_seconds(t1,t2);
+}
+
+void print(const std::string & name, const uint n_tris, const double t_build, const size_t rss, const double t_closest, const double t_ray)
+{
+    std::cout << name << "\t#tris: "   << n_tris
+                      << "\tbuild: "   << t_build     << "s"
+                      << "\tmemory: "  << rss/1048576.0 << "MB"
+                      << "\tclosest: " << t_closest   << "s"
+                      << "\tray: "     << t_ray       << "s" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    uint        n_subd  = (argc>=2) ? atoi(argv[1]) : 8;
+    std::string variant = (argc>=3) ? std::string(argv[2]) : "all";
+
+    std::vector<double> coords;
+    std::vector<uint>   tris;
+    icosphere(1.f, n_subd, coords, tris);
+    std::vector<vec3d> verts = vec3d_from_serialized_xyz(coords);
+    uint n_tris = (uint)tris.size()/3;
+
+    std::vector<vec3d> queries(10000);
+    for(uint i=0; i<queries.size(); ++i)
+    {
+        double a = i*0.618033988749895*2*M_PI;
+        double z = 2.0*(i+0.5)/queries.size()-1.0;
+        double r = std::sqrt(1.0-z*z);
+        queries.at(i) = vec3d(r*std::cos(a), r*std::sin(a), z) * 1.5;
+    }
+
+    double t_closest, t_ray;
+
+    if(variant=="all" || variant=="reference")
+    {
+        size_t rss0 = memory_usage_in_bytes();
+        Time::time_point t0 = Time::now();
+        SoupOctree<TriangleSoup> o;
+        o.build_from_vectors(verts, tris);
+        Time::time_point t1 = Time::now();
+        size_t rss1 = memory_usage_in_bytes();
+        run_queries(o, queries, t_closest, t_ray);
+        print("reference", n_tris, how_many_seconds(t0,t1), rss1-rss0, t_closest, t_ray);
+    }
+
+    if(variant=="all" || variant=="owned")
+    {
+        size_t rss0 = memory_usage_in_bytes();
+        Time::time_point t0 = Time::now();
+        SoupOctree<TriangleSoup> o;
+        o.soup.reserve(n_tris);
+        for(uint i=0; i<tris.size(); i+=3)
+        {
+            vec3d v[3] = { verts.at(tris.at(i)), verts.at(tris.at(i+1)), verts.at(tris.at(i+2)) };
+            o.soup.push(i/3, v);
+        }
+        o.build();
+        Time::time_point t1 = Time::now();
+        size_t rss1 = memory_usage_in_bytes();
+        run_queries(o, queries, t_closest, t_ray);
+        print("owned    ", n_tris, how_many_seconds(t0,t1), rss1-rss0, t_closest, t_ray);
+    }
+
+    if(variant=="all" || variant=="refit")
+    {
+        SoupOctree<TriangleSoup> o;
+        o.build_from_vectors(verts, tris);
+        double t_refit   = 0;
+        double t_rebuild = 0;
+        uint   n_rebuilt = 0;
+        for(uint it=0; it<10; ++it)
+        {
+            // small twist around the Z axis
+            for(vec3d & p : verts) p = p.rotate(vec3d(0,0,1), 0.02*p.z());
+
+            Time::time_point t0 = Time::now();
+            n_rebuilt += o.refit();
+            Time::time_point t1 = Time::now();
+            SoupOctree<TriangleSoup> tmp;
+            tmp.build_from_vectors(verts, tris);
+            Time::time_point t2 = Time::now();
+            t_refit   += how_many_seconds(t0,t1);
+            t_rebuild += how_many_seconds(t1,t2);
+        }
+        std::cout << "refit    \t#tris: "    << n_tris
+                  << "\trefit: "             << t_refit/10   << "s"
+                  << "\trebuild: "           << t_rebuild/10 << "s"
+                  << "\toctants rebuilt: "   << n_rebuilt    << std::endl;
+    }
+
+    if(variant=="all" || variant=="legacy")
+    {
+        size_t rss0 = memory_usage_in_bytes();
+        Time::time_point t0 = Time::now();
+        Octree o;
+        o.build_from_vectors(verts, tris);
+        Time::time_point t1 = Time::now();
+        size_t rss1 = memory_usage_in_bytes();
+        run_queries(o, queries, t_closest, t_ray);
+        print("legacy   ", n_tris, how_many_seconds(t0,t1), rss1-rss0, t_closest, t_ray);
+    }
+
+    return 0;
+}
@@ -0,0 +1,582 @@
+#include <cinolib/meshes/meshes.h>
+#include <cinolib/icosphere.h>
+#include <cinolib/grid_mesh.h>
+#include <cinolib/tetrahedralization.h>
+#include <cinolib/vector_serialization.h>
+#include <cinolib/laplacian.h>
+#include <cinolib/gradient.h>
+#include <cinolib/linear_solvers.h>
+#include <cinolib/geodesics.h>
+#include <cinolib/HKS.h>
+#include <cinolib/mean_curv_flow.h>
+#include <cinolib/ARAP.h>
+#include <cinolib/QEM_simplification.h>
+#include <cinolib/octree.h>
+#include <cinolib/soup_octree.h>
+#include <cinolib/voxelize.h>
+#include <cinolib/RBF_Hermite_PU.h>
+#include <cinolib/Poisson_sampling.h>
+#include <cinolib/Poisson_sampling_parallel.h>
+#include <cinolib/marching_tets.h>
+#include <cinolib/subdivision_stencil.h>
+#include <cinolib/streaming/stream_operators.h>
+#include <cinolib/find_intersections.h>
+#include <cinolib/predicates_batched.h>
+#include <cinolib/filtered_predicates.h>
+#include <cinolib/rasterize_shadow.h>
+#include <cinolib/3d_printing/optimal_build_dir.h>
+#include <cinolib/3d_printing/slice_mesh.h>
+#include <cinolib/io/write_CLI.h>
+#include <cinolib/io/read_OBJ.h>
+#include <cinolib/io/read_MESH.h>
+#ifdef CINOLIB_USES_CGAL_GMP_MPFR
+#include <cinolib/rationals.h>
+#endif
+#include "../common/bench_utils.h"
+
+/* Headless benchmark of the core kernels of the library. Kernels run on
+ * synthetic meshes of controlled size (icospheres and tetrahedralized grids)
+ * and on some of the meshes bundled with the examples.
+ *
+ * Usage: core_kernels [--size small|medium|large] [--reps N] [--filter substring] [--json file]
+ *
+ * Runs on different commits can be compared with
+ *
+ *      python3 compare.py before.json after.json
+*/
+
+using namespace cinolib;
+
+struct Sizes
+{
+    uint ico_subd;   // icosphere subdivisions (20*4^n triangles)
+    uint grid;       // hexahedra per side of the tetrahedralized grid
+    uint voxels;     // max voxels per side
+    uint n_queries;  // point/ray queries
+};
+
+Sizes sizes_for(const std::string & s)
+{
+    if(s=="small") return { 5, 16,  64,   10000 };
+    if(s=="large") return { 8, 64, 256, 1000000 };
+    return { 7, 32, 128, 100000 };
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_io(bench::Suite & s)
+{
+    for(const char *name : { "bunny.obj", "Laurana.obj", "blub_triangulated.obj" })
+    {
+        std::string f = std::string(DATA_PATH) + "/" + name;
+        std::vector<vec3d> verts;
+        std::vector<std::vector<uint>> polys;
+        read_OBJ(f.c_str(), verts, polys);
+        s.run("load_obj", name, polys.size(), "polys", [&]()
+        {
+            read_OBJ(f.c_str(), verts, polys);
+        },
+        [&](){ verts.clear(); polys.clear(); });
+    }
+
+    for(const char *name : { "rockerarm.mesh", "sphere.mesh" })
+    {
+        std::string f = std::string(DATA_PATH) + "/" + name;
+        std::vector<vec3d> verts;
+        std::vector<std::vector<uint>> polys;
+        read_MESH(f.c_str(), verts, polys);
+        s.run("load_mesh", name, polys.size(), "polys", [&]()
+        {
+            read_MESH(f.c_str(), verts, polys);
+        },
+        [&](){ verts.clear(); polys.clear(); });
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_surface(bench::Suite & s, const Sizes & sz)
+{
+    std::vector<double> coords;
+    std::vector<uint>   tris;
+    icosphere(1.f, sz.ico_subd, coords, tris);
+    std::vector<vec3d> verts = vec3d_from_serialized_xyz(coords);
+    std::string input = "icosphere_" + std::to_string(sz.ico_subd);
+    size_t n_tris = tris.size()/3;
+
+    s.run("connectivity_trimesh", input, n_tris, "tris", [&]()
+    {
+        Trimesh<> m(verts, tris);
+    });
+
+    Trimesh<> m(verts, tris);
+
+    Eigen::SparseMatrix<double> L;
+    s.run("laplacian_assembly", input, m.num_verts(), "verts", [&]()
+    {
+        L = laplacian(m, COTANGENT);
+    });
+    if(L.size()==0) L = laplacian(m, COTANGENT); // assembly was filtered out
+
+    s.run("gradient_assembly", input, m.num_polys(), "tris", [&]()
+    {
+        gradient_matrix(m);
+    });
+
+    // harmonic field between two antipodal points
+    uint v_far = 0;
+    for(uint vid=1; vid<m.num_verts(); ++vid) if(m.vert(vid).dist(m.vert(0)) > m.vert(v_far).dist(m.vert(0))) v_far = vid;
+    std::map<uint,double> bc = {{0,0.0}, {v_far,1.0}};
+    Eigen::VectorXd rhs = Eigen::VectorXd::Zero(m.num_verts());
+    Eigen::VectorXd x;
+    s.run("laplacian_solve", input, m.num_verts(), "verts", [&]()
+    {
+        solve_square_system_with_bc(-L, rhs, x, bc, SIMPLICIAL_LDLT);
+    });
+    s.run("laplacian_solve_multigrid", input, m.num_verts(), "verts", [&]()
+    {
+        solve_square_system_with_bc(-L, rhs, x, bc, MULTIGRID_PCG);
+    });
+
+    s.run("geodesics_heat", input, m.num_verts(), "verts", [&]()
+    {
+        compute_geodesics(m, {0});
+    });
+
+    GeodesicsCache cache;
+    compute_geodesics_amortized(m, cache, {0});
+    s.run("geodesics_heat_cached", input, m.num_verts(), "verts", [&]()
+    {
+        compute_geodesics_amortized(m, cache, {v_far});
+    });
+    delete cache.heat_flow_cache;
+    delete cache.integration_cache;
+
+    std::vector<uint> landmarks;
+    for(uint i=0; i<32; ++i) landmarks.push_back((i*7919)%m.num_verts());
+    s.run("hks", input, landmarks.size()*5, "columns", [&]()
+    {
+        HKS(m, landmarks, 5);
+    });
+
+    // five MCF iterations on the whole mesh, and on a cap (~10% of the verts)
+    std::vector<uint> cap;
+    for(uint vid=0; vid<m.num_verts(); ++vid) if(m.vert(vid).z() > 0.8) cap.push_back(vid);
+    Trimesh<> m_flow;
+    for(const std::string kernel : {"mcf", "mcf_region"})
+    {
+        s.run(kernel, input, 5, "iters", [&]()
+        {
+            MeanCurvatureFlow<Mesh_std_attributes, Vert_std_attributes, Edge_std_attributes, Polygon_std_attributes>
+                flow(m_flow, 1e-3, true, (kernel=="mcf") ? std::vector<uint>() : cap);
+            for(uint i=0; i<5; ++i) flow.iterate();
+        },
+        [&](){ m_flow = m; });
+    }
+
+    // ARAP deformation: bottom cap fixed, top cap translated sideways (hard constraints)
+    for(const std::string kernel : {"arap", "arap_anderson"})
+    {
+        s.run(kernel, input, 5, "iters", [&]()
+        {
+            ARAP_data data;
+            data.n_iters                = 5;
+            data.hard_constrain_handles = true;
+            data.anderson_window        = (kernel=="arap") ? 0 : 5;
+            for(uint vid=0; vid<m_flow.num_verts(); ++vid)
+            {
+                vec3d p = m_flow.vert(vid);
+                if(std::fabs(p.z()) < 0.8) continue;
+                if(p.z() > 0) p.x() += 0.3;
+                data.handles.push_back(vid);
+                data.handles_x[vid] = p.x();
+                data.handles_y[vid] = p.y();
+                data.handles_z[vid] = p.z();
+            }
+            ARAP(m_flow, data);
+        },
+        [&](){ m_flow = m; });
+    }
+
+    // QEM simplification down to 10% of the triangles, and extraction of an intermediate level
+    ProgressiveMesh pm;
+    s.run("qem_simplify", input, m.num_polys(), "tris", [&]()
+    {
+        QEM_simplify(m, m.num_polys()/10, pm);
+    });
+    if(s.enabled("lod_extract") && pm.num_levels()==1) QEM_simplify(m, m.num_polys()/10, pm); // simplification was filtered out
+    s.run("lod_extract", input, m.num_polys(), "tris", [&]()
+    {
+        std::vector<vec3d> lod_verts;
+        std::vector<uint>  lod_tris;
+        pm.extract(pm.num_levels()/2, lod_verts, lod_tris);
+    });
+
+    std::vector<vec3d> queries(sz.n_queries);
+    for(uint i=0; i<queries.size(); ++i)
+    {
+        double a = i*0.618033988749895*2*M_PI;
+        double z = 2.0*(i+0.5)/queries.size()-1.0;
+        double r = std::sqrt(1.0-z*z);
+        queries.at(i) = vec3d(r*std::cos(a), r*std::sin(a), z) * 1.5;
+    }
+
+    s.run("octree_build", input, n_tris, "tris", [&]()
+    {
+        Octree o;
+        o.build_from_mesh_polys(m);
+    });
+
+    s.run("soup_octree_build", input, n_tris, "tris", [&]()
+    {
+        SoupOctree<TriangleSoup> o;
+        o.build_from_mesh_polys(m);
+    });
+
+    // picking indices are built at the first query, and then reused
+    s.run("pick_build", input, n_tris, "tris", [&]()
+    {
+        m.pick_poly(queries.front());
+    },
+    [&](){ m.pick_cache_clear(); });
+    s.run("pick_poly", input, queries.size(), "queries", [&]()
+    {
+        for(const vec3d & q : queries) m.pick_poly(q/1.5); // on the surface, as clicks are
+    });
+
+    Octree o;
+    o.build_from_mesh_polys(m);
+    s.run("octree_closest_point", input, queries.size(), "queries", [&]()
+    {
+        for(const vec3d & q : queries) o.closest_point(q);
+    });
+    s.run("octree_ray", input, queries.size(), "queries", [&]()
+    {
+        double t;
+        uint   id;
+        for(const vec3d & q : queries) o.intersects_ray(q, -q, t, id);
+    });
+
+    SoupOctree<TriangleSoup> so;
+    so.build_from_mesh_polys(m);
+    s.run("soup_octree_closest_point", input, queries.size(), "queries", [&]()
+    {
+        for(const vec3d & q : queries) so.closest_point(q);
+    });
+    s.run("soup_octree_ray", input, queries.size(), "queries", [&]()
+    {
+        double t;
+        uint   id;
+        for(const vec3d & q : queries) so.intersects_ray(q, -q, t, id);
+    });
+
+    s.run("voxelize", input + "_" + std::to_string(sz.voxels), size_t(sz.voxels)*sz.voxels*sz.voxels, "voxels", [&]()
+    {
+        VoxelGrid g;
+        voxelize(m, sz.voxels, g);
+    });
+
+    // two overlapping spheres, whose intersection is a circle
+    std::vector<vec3d> verts2 = verts;
+    std::vector<uint>  tris2  = tris;
+    for(const vec3d & p : verts) verts2.push_back(p + vec3d(0.5,0.1,0.05));
+    for(uint vid : tris) tris2.push_back(vid + (uint)verts.size());
+    s.run("find_intersections", "two_" + input, tris2.size()/3, "tris", [&]()
+    {
+        std::set<ipair> intersections;
+        find_intersections(verts2, tris2, intersections);
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_volume(bench::Suite & s, const Sizes & sz)
+{
+    Hexmesh<> hm;
+    grid_mesh(sz.grid, sz.grid, sz.grid, hm);
+    Tetmesh<> tm;
+    hex_to_tets(hm, tm);
+    std::string input = "tet_grid_" + std::to_string(sz.grid);
+
+    std::vector<vec3d> verts = tm.vector_verts();
+    std::vector<uint>  tets;
+    for(uint pid=0; pid<tm.num_polys(); ++pid)
+    {
+        for(uint vid : tm.poly_verts_id(pid)) tets.push_back(vid);
+    }
+    s.run("connectivity_tetmesh", input, tets.size()/4, "tets", [&]()
+    {
+        Tetmesh<> m(verts, tets);
+    });
+
+    // signed distance from a sphere centered in the grid
+    vec3d  c = tm.bbox().center();
+    double r = tm.bbox().diag()*0.3;
+    for(uint vid=0; vid<tm.num_verts(); ++vid) tm.vert_uvw(vid)[0] = tm.vert(vid).dist(c) - r;
+
+    s.run("marching_tets", input, tm.num_polys(), "tets", [&]()
+    {
+        std::vector<vec3d> iso_verts, iso_norms;
+        std::vector<uint>  iso_tris;
+        marching_tets(tm, 0.0, iso_verts, iso_tris, iso_norms);
+    });
+
+    // eight nested level sets in one call (the field is gathered once)
+    std::vector<double> levels;
+    for(int i=-4; i<4; ++i) levels.push_back(i*r/8.0);
+    s.run("marching_tets_levels", input, tm.num_polys()*levels.size(), "tets", [&]()
+    {
+        std::vector<std::vector<vec3d>> iso_verts, iso_norms;
+        std::vector<std::vector<uint>>  iso_tris;
+        marching_tets(tm, levels, iso_verts, iso_tris, iso_norms);
+    });
+
+    s.run("laplacian_assembly", input, tm.num_verts(), "verts", [&]()
+    {
+        laplacian(tm, COTANGENT);
+    });
+
+    // Loop subdivision of a coarser cage: one-time build, then repeated position updates
+    Hexmesh<> cage_hm;
+    grid_mesh(sz.grid/2, sz.grid/2, sz.grid/2, cage_hm);
+    Tetmesh<> cage;
+    hex_to_tets(cage_hm, cage);
+    std::string cage_input = "tet_grid_" + std::to_string(sz.grid/2);
+    CachedSubdivision<Tetmesh<>> subd;
+    s.run("subdivision_build", cage_input, cage.num_polys(), "tets", [&]()
+    {
+        subd.build(cage, SUBDIVISION_LOOP);
+    });
+    if(s.enabled("subdivision_update") && subd.mesh().num_polys()==0) subd.build(cage, SUBDIVISION_LOOP); // build was filtered out
+    subd.mesh().mesh_data().update_normals = false;
+    s.run("subdivision_update", cage_input, subd.mesh().num_verts(), "verts", [&]()
+    {
+        subd.update(cage.vector_verts());
+    });
+
+    // out-of-core counterparts, with a memory budget that forces several chunks
+    if(!s.enabled("streamed_mesh_build") && !s.enabled("streamed_marching_tets")) return;
+    tm.save("core_kernels_tmp.mesh");
+    StreamOptions opt;
+    opt.max_memory = 16<<20;
+    s.run("streamed_mesh_build", input, tm.num_polys(), "tets", [&]()
+    {
+        make_streamed_mesh("core_kernels_tmp.mesh", "core_kernels_tmp.cstr", opt);
+    });
+    if(s.enabled("streamed_marching_tets"))
+    {
+        make_streamed_mesh("core_kernels_tmp.mesh", "core_kernels_tmp.cstr", opt);
+        StreamedMesh sm("core_kernels_tmp.cstr");
+        s.run("streamed_marching_tets", input, tm.num_polys(), "tets", [&]()
+        {
+            StreamedSoupWriter out(3, opt.max_memory);
+            stream_marching_tets(sm, [&](const uint, const vec3d & p) { return p.dist(c) - r; }, 0.0, out);
+            out.write("core_kernels_tmp.off");
+        });
+    }
+    remove("core_kernels_tmp.mesh");
+    remove("core_kernels_tmp.cstr");
+    remove("core_kernels_tmp.off");
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_predicates(bench::Suite & s, const Sizes & sz)
+{
+    // vertices of an icosphere tested against a set of planes passing through the origin
+    std::vector<double> coords;
+    std::vector<uint>   tris;
+    icosphere(1.f, sz.ico_subd, coords, tris);
+    uint n = uint(coords.size()/3);
+    std::string input = "icosphere_" + std::to_string(sz.ico_subd);
+    std::vector<double> res(n);
+    double planes[4][9] =
+    {
+        { 0,0,0, 1,0,0, 0,1,0 },
+        { 0,0,0, 0,1,0, 0,0,1 },
+        { 0,0,0, 1,1,0, 0,1,1 },
+        { 0,0,0, 1,0,1, 1,1,1 },
+    };
+
+    s.run("orient3d_scalar", input, 4*size_t(n), "queries", [&]()
+    {
+        for(const auto & t : planes)
+        for(uint i=0; i<n; ++i) res[i] = orient3d(t, t+3, t+6, &coords[3*i]);
+    });
+
+    s.run("orient3d_batch", input, 4*size_t(n), "queries", [&]()
+    {
+        for(const auto & t : planes) orient3d_batch(t, 0, t+3, 0, t+6, 0, coords.data(), 3, n, res.data());
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+#ifdef CINOLIB_USES_CGAL_GMP_MPFR
+void bench_rationals(bench::Suite & s)
+{
+    // flip checks as in the mapping algorithms (AFM, Stripe Embedding): the triangles of a mesh
+    // flattened on the XY plane, half of the vertices moved to rational (non double) positions
+    for(const char *name : { "bunny.obj", "Laurana.obj" })
+    {
+        Trimesh<> m((std::string(DATA_PATH) + "/" + name).c_str());
+        std::vector<CGAL_Q> coords(3*m.num_verts());
+        for(uint vid=0; vid<m.num_verts(); ++vid)
+        {
+            coords[3*vid  ] = m.vert(vid).x();
+            coords[3*vid+1] = m.vert(vid).y();
+            coords[3*vid+2] = 0;
+            if(vid%2==1)
+            {
+                uint nbr = m.adj_v2v(vid).front();
+                coords[3*vid  ] = (coords[3*vid  ]*2 + CGAL_Q(m.vert(nbr).x()))/3;
+                coords[3*vid+1] = (coords[3*vid+1]*2 + CGAL_Q(m.vert(nbr).y()))/3;
+            }
+        }
+        std::vector<uint> tris = serialized_vids_from_polys(m.vector_polys());
+        std::vector<int>  res(m.num_polys());
+
+        s.run("orient2d_rational_lazy", name, m.num_polys(), "tris", [&]()
+        {
+            for(uint pid=0; pid<m.num_polys(); ++pid)
+            {
+                CGAL_Q o = orient2d(&coords[3*tris[3*pid]], &coords[3*tris[3*pid+1]], &coords[3*tris[3*pid+2]]);
+                res[pid] = (o>0) ? 1 : ((o<0) ? -1 : 0);
+            }
+        });
+
+        s.run("orient2d_rational_filtered", name, m.num_polys(), "tris", [&]()
+        {
+            orient2d_sign_batch(coords.data(), 3, tris.data(), m.num_polys(), res.data());
+        });
+    }
+}
+#endif
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_printing(bench::Suite & s, const Sizes & sz)
+{
+    std::string f = std::string(DATA_PATH) + "/bunny.obj";
+    Trimesh<> m(f.c_str());
+
+    std::vector<uint8_t> data(1024*1024);
+    vec3d dir(1,1,1);
+    dir.normalize();
+    s.run("rasterize_shadow", "bunny.obj_1024", m.num_polys(), "tris", [&]()
+    {
+        rasterize_shadow(m, dir, 1024, 1024, data.data());
+    });
+
+    // slicing of a dense sphere
+    std::vector<double> coords;
+    std::vector<uint>   tris;
+    icosphere(1.f, sz.ico_subd, coords, tris);
+    Trimesh<> sphere(coords, tris);
+    std::string input = "icosphere_" + std::to_string(sz.ico_subd) + "_1000_layers";
+    std::vector<double> z_levels;
+    std::vector<std::vector<std::vector<vec3d>>> holes, contours;
+    s.run("slice_mesh", input, 1000, "layers", [&]()
+    {
+        slice_mesh(sphere, sphere.bbox().delta_z()/1000, z_levels, holes, contours);
+    });
+    s.run("write_CLI", input, 1000, "layers", [&]()
+    {
+        write_CLI("core_kernels_tmp.cli", z_levels, holes, contours, {}, {});
+    });
+    remove("core_kernels_tmp.cli");
+
+    // few candidates, such that the kernel takes a few seconds
+    OptimalBuildDirOptions opt;
+    opt.n_dirs = sz.ico_subd*4;
+    s.run("optimal_build_dir", "bunny.obj_" + std::to_string(opt.n_dirs), opt.n_dirs, "dirs", [&]()
+    {
+        optimal_build_dir(m, opt);
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_reconstruction(bench::Suite & s, const Sizes & sz)
+{
+    // Hermite RBF reconstruction of a sphere from its oriented vertices
+    std::vector<double> coords;
+    std::vector<uint>   tris;
+    icosphere(1.f, sz.ico_subd, coords, tris);
+    std::vector<vec3d> points  = vec3d_from_serialized_xyz(coords);
+    std::vector<vec3d> normals = points;
+    for(vec3d & n : normals) n.normalize();
+    std::string input = "icosphere_" + std::to_string(sz.ico_subd);
+
+    Hermite_RBF_PU<CubicRBF> f;
+    s.run("hrbf_pu_build", input, points.size(), "points", [&]()
+    {
+        f = Hermite_RBF_PU<CubicRBF>(points, normals);
+    });
+
+    s.run("hrbf_pu_voxelize", input + "_" + std::to_string(sz.voxels), size_t(sz.voxels)*sz.voxels*sz.voxels, "voxels", [&]()
+    {
+        VoxelGrid g;
+        voxelize([&](const vec3d & p) { return f.eval(p); }, AABB(points,1.5), sz.voxels, g);
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+void bench_sampling(bench::Suite & s, const Sizes & sz)
+{
+    // Poisson disk sampling of a box, of a sphere and of a tetrahedralized
+    // grid, with radii such that the sample count scales with sz.voxels
+    double r = 1.0/sz.voxels;
+    std::vector<vec3d> samples;
+    std::string input = "cube_" + std::to_string(sz.voxels);
+    s.run("poisson_box_serial", input, size_t(sz.voxels)*sz.voxels*sz.voxels, "cells", [&]()
+    {
+        Poisson_sampling<3,vec3d>(2*r, vec3d(0,0,0), vec3d(1,1,1), samples);
+    });
+    s.run("poisson_box_parallel", input, size_t(sz.voxels)*sz.voxels*sz.voxels, "cells", [&]()
+    {
+        Poisson_sampling_parallel<3,vec3d>(2*r, vec3d(0,0,0), vec3d(1,1,1), samples);
+    });
+
+    std::vector<double> coords;
+    std::vector<uint>   tris;
+    icosphere(1.f, sz.ico_subd, coords, tris);
+    Trimesh<> m(coords, tris);
+    s.run("poisson_surface_parallel", "icosphere_" + std::to_string(sz.ico_subd), m.num_polys(), "tris", [&]()
+    {
+        Poisson_sampling_parallel(m, r, samples);
+    });
+
+    Hexmesh<> hm;
+    grid_mesh(sz.grid, sz.grid, sz.grid, hm);
+    Tetmesh<> tm;
+    hex_to_tets(hm, tm);
+    tm.normalize_bbox();
+    s.run("poisson_volume_parallel", "tet_grid_" + std::to_string(sz.grid), tm.num_polys(), "tets", [&]()
+    {
+        Poisson_sampling_parallel(tm, 2*r, samples);
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+int main(int argc, char **argv)
+{
+    bench::Suite s("core_kernels", argc, argv);
+    Sizes sz = sizes_for(s.size);
+
+    bench_io(s);
+    bench_surface(s, sz);
+    bench_volume(s, sz);
+    bench_predicates(s, sz);
+    bench_printing(s, sz);
+    bench_reconstruction(s, sz);
+    bench_sampling(s, sz);
+#ifdef CINOLIB_USES_CGAL_GMP_MPFR
+    bench_rationals(s);
+#endif
+
+    s.write_json();
+    return 0;
+}
@@ -0,0 +1,205 @@
+#ifndef CINO_BENCH_UTILS_H
+#define CINO_BENCH_UTILS_H
+
+#include <cinolib/memory_usage.h>
+#include <cinolib/how_many_seconds.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Minimal harness shared by all benchmarks. Each kernel is executed a number
+ * of times, and the best and median wall clock times are recorded, together
+ * with a throughput (elements processed per second) and the peak resident
+ * memory observed while the kernel was running.
+ *
+ * Results are printed on stdout as a table, and can be exported in JSON so
+ * that runs on different commits can be compared (see compare.py)
+ *
+ * Peak memory is the high-water mark of the RSS (VmHWM), which on Linux is
+ * reset before each kernel. On other systems it falls back to the RSS at the
+ * end of the kernel.
+*/
+
+namespace bench
+{
+
+typedef std::chrono::steady_clock Time;
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+struct Result
+{
+    std::string kernel;     // e.g. "laplacian_assembly"
+    std::string input;      // e.g. "icosphere_7"
+    size_t      n_elements; // size of the input (the unit depends on the kernel)
+    std::string unit;       // e.g. "tris", "verts", "queries"
+    uint        reps;
+    double      t_min;      // s
+    double      t_median;   // s
+    double      peak_mb;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+inline void reset_peak_memory()
+{
+#ifdef __linux__
+    // https://www.kernel.org/doc/Documentation/filesystems/proc.txt (clear_refs)
+    FILE *fp = fopen("/proc/self/clear_refs", "w");
+    if(fp)
+    {
+        fputs("5", fp);
+        fclose(fp);
+    }
+#endif
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+inline size_t peak_memory_in_bytes()
+{
+#ifdef __linux__
+    std::ifstream f("/proc/self/status");
+    std::string line;
+    while(std::getline(f,line))
+    {
+        if(line.compare(0,6,"VmHWM:")==0) return std::stoul(line.substr(6))*1024; // kB
+    }
+#endif
+    return cinolib::memory_usage_in_bytes();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+class Suite
+{
+    public:
+
+        Suite(const std::string & name, int argc, char **argv) : name(name)
+        {
+            for(int i=1; i<argc; ++i)
+            {
+                if(strcmp(argv[i],"--reps"  )==0 && i+1<argc) reps   = std::max(1,atoi(argv[++i])); else
+                if(strcmp(argv[i],"--json"  )==0 && i+1<argc) json   = argv[++i];                   else
+                if(strcmp(argv[i],"--filter")==0 && i+1<argc) filter = argv[++i];                   else
+                if(strcmp(argv[i],"--size"  )==0 && i+1<argc) size   = argv[++i];                   else
+                {
+                    std::cout << "Usage: " << argv[0] << " [--size small|medium|large] [--reps N] [--filter substring] [--json file]" << std::endl;
+                    exit(0);
+                }
+            }
+        }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        bool enabled(const std::string & kernel) const
+        {
+            return filter.empty() || kernel.find(filter)!=std::string::npos;
+        }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // setup is executed before each repetition and is not timed
+        void run(const std::string           & kernel,
+                 const std::string           & input,
+                 const size_t                  n_elements,
+                 const std::string           & unit,
+                 const std::function<void()> & body,
+                 const std::function<void()> & setup = nullptr)
+        {
+            if(!enabled(kernel)) return;
+
+            std::vector<double> times;
+            size_t peak = 0;
+            for(uint i=0; i<reps; ++i)
+            {
+                if(setup) setup();
+                reset_peak_memory();
+                Time::time_point t0 = Time::now();
+                body();
+                Time::time_point t1 = Time::now();
+                times.push_back(cinolib::how_many_seconds(t0,t1));
+                peak = std::max(peak, peak_memory_in_bytes());
+            }
+            std::sort(times.begin(), times.end());
+
+            Result r;
+            r.kernel     = kernel;
+            r.input      = input;
+            r.n_elements = n_elements;
+            r.unit       = unit;
+            r.reps       = reps;
+            r.t_min      = times.front();
+            r.t_median   = times.at(times.size()/2);
+            r.peak_mb    = double(peak)/(1024.0*1024.0);
+            results.push_back(r);
+
+            printf("%-28s %-22s %10zu %-8s min: %10.6fs  median: %10.6fs  %12.4g %s/s  peak: %8.1fMB\n",
+                   kernel.c_str(), input.c_str(), n_elements, unit.c_str(), r.t_min, r.t_median,
+                   (r.t_min>0) ? double(n_elements)/r.t_min : 0.0, unit.c_str(), r.peak_mb);
+            fflush(stdout);
+        }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void write_json() const
+        {
+            if(json.empty()) return;
+            FILE *fp = fopen(json.c_str(), "w");
+            if(!fp)
+            {
+                std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : couldn't write file " << json << std::endl;
+                return;
+            }
+            char date[64];
+            time_t now = time(nullptr);
+            strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+            fprintf(fp, "{\n");
+            fprintf(fp, "  \"suite\": \"%s\",\n", name.c_str());
+            fprintf(fp, "  \"size\": \"%s\",\n", size.c_str());
+            fprintf(fp, "  \"date\": \"%s\",\n", date);
+#ifdef __VERSION__
+            fprintf(fp, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+#ifdef NDEBUG
+            fprintf(fp, "  \"build\": \"release\",\n");
+#else
+            fprintf(fp, "  \"build\": \"debug\",\n");
+#endif
+            fprintf(fp, "  \"threads\": %u,\n", std::thread::hardware_concurrency());
+            fprintf(fp, "  \"results\": [\n");
+            for(size_t i=0; i<results.size(); ++i)
+            {
+                const Result & r = results.at(i);
+                fprintf(fp, "    {\"kernel\": \"%s\", \"input\": \"%s\", \"n_elements\": %zu, \"unit\": \"%s\", \"reps\": %u, "
+                            "\"t_min\": %.9g, \"t_median\": %.9g, \"throughput\": %.9g, \"peak_mb\": %.3f}%s\n",
+                        r.kernel.c_str(), r.input.c_str(), r.n_elements, r.unit.c_str(), r.reps,
+                        r.t_min, r.t_median, (r.t_min>0) ? double(r.n_elements)/r.t_min : 0.0, r.peak_mb,
+                        (i+1<results.size()) ? "," : "");
+            }
+            fprintf(fp, "  ]\n}\n");
+            fclose(fp);
+            std::cout << "results written to " << json << std::endl;
+        }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        std::string         name;
+        std::string         size   = "medium";
+        std::string         filter;
+        std::string         json;
+        uint                reps   = 3;
+        std::vector<Result> results;
+};
+
+}
+
+#endif // CINO_BENCH_UTILS_H
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+#
+# Compares two JSON files produced by the benchmarks (--json option) and
+# reports, for each kernel, the relative change of the best running time.
+# Exits with a non zero code if any kernel got slower than the threshold.
+#
+# Usage: python3 compare.py before.json after.json [threshold, default 0.10]
+
+import json
+import sys
+
+if len(sys.argv) < 3:
+    print("Usage: compare.py before.json after.json [threshold]")
+    sys.exit(2)
+
+before    = json.load(open(sys.argv[1]))
+after     = json.load(open(sys.argv[2]))
+threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 0.10
+
+key  = lambda r: (r["kernel"], r["input"])
+base = {key(r): r for r in before["results"]}
+
+regressions = 0
+print("%-28s %-22s %12s %12s %9s %10s" % ("kernel", "input", "before (s)", "after (s)", "change", "peak (MB)"))
+for r in after["results"]:
+    b = base.get(key(r))
+    if b is None:
+        print("%-28s %-22s %12s %12.6f %9s %10.1f" % (r["kernel"], r["input"], "-", r["t_min"], "new", r["peak_mb"]))
+        continue
+    change = (r["t_min"] - b["t_min"]) / b["t_min"] if b["t_min"] > 0 else 0.0
+    flag   = ""
+    if change > threshold:
+        flag = "  <== REGRESSION"
+        regressions += 1
+    print("%-28s %-22s %12.6f %12.6f %+8.1f%% %10.1f%s" % (r["kernel"], r["input"], b["t_min"], r["t_min"], 100*change, r["peak_mb"], flag))
+
+if regressions > 0:
+    print("%d kernel(s) slower than %.0f%%" % (regressions, 100*threshold))
+    sys.exit(1)
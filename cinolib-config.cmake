@@ -42,6 +42,7 @@ option(CINOLIB_USES_BOOST               "Use Boost"                  OFF)
 option(CINOLIB_USES_VTK                 "Use VTK"                    OFF)
 option(CINOLIB_USES_SPECTRA             "Use Spectra"                OFF)
 option(CINOLIB_USES_CGAL_GMP_MPFR       "Use CGAL, GMP and MPFR"     OFF)
+option(CINOLIB_PROFILING                "Enable scoped tracing"      OFF)
 
 #::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 #::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -185,3 +186,9 @@ if(CINOLIB_USES_CGAL_GMP_MPFR)
     endif()
 endif()
 
+#::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+if(CINOLIB_PROFILING)
+    message("CINOLIB OPTIONAL MODULE: Profiling")
+    target_compile_definitions(cinolib INTERFACE CINOLIB_PROFILING)
+endif()
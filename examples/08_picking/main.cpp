@@ -37,7 +37,7 @@ int main(int argc, char **argv)
                 uint vid = m.pick_vert(p);
                 profiler.pop();
                 std::cout << "ID " << vid << std::endl;
-                m.vert_data(vid).color = Color::RED();
+                m.vert_color(vid) = Color::RED();
                 m.updateGL();
             }
         }
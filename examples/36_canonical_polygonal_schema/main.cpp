@@ -49,8 +49,8 @@ int main(int argc, char **argv)
             {
                 uint v0 = obj.edge_vert_id(eid,0);
                 uint v1 = obj.edge_vert_id(eid,1);
-                int loop_id = obj.vert_data(v0).label;
-                if(loop_id<0) loop_id = obj.vert_data(v1).label;
+                int loop_id = obj.vert_label(v0);
+                if(loop_id<0) loop_id = obj.vert_label(v1);
                 Color c = Color::scatter(uint(data.loops.size()),loop_id,1.f,1.f);
                 obj_loops.push_seg(obj.vert(v0),obj.vert(v1),c);
                 cps_edges.push_seg(cps.vert(v0),cps.vert(v1),c);
@@ -20,8 +20,8 @@ int main(int argc, char **argv)
     std::cout << "\n" << inters.size() << " pairs of intersecting triangles were found\n" << std::endl;
     for(const auto & i : inters)
     {
-        m.poly_data(i.first ).color = Color::RED();
-        m.poly_data(i.second).color = Color::RED();
+        m.poly_color(i.first ) = Color::RED();
+        m.poly_color(i.second) = Color::RED();
 
         m.poly_data(i.first ).flags[MARKED] = true;
         m.poly_data(i.second).flags[MARKED] = true;
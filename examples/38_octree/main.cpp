@@ -45,7 +45,7 @@ int main(int argc, char **argv)
                 if(octree.intersects_ray(p-dir, dir, t, pid)) // consider only the first hit
                 {
                     std::cout << "hit triangle " << pid << std::endl;
-                    m.poly_data(pid).color = Color::RED();
+                    m.poly_color(pid) = Color::RED();
                     ss.push_seg(p-dir,m.centroid());
                     m.updateGL();
                 }
@@ -25,7 +25,7 @@ int main(int argc, char *argv[])
         Color c = Color::scatter(n_ccs,i);
         for(auto vid : ccs[i])
         {
-            m.vert_data(vid).color = c;
+            m.vert_color(vid) = c;
         }
     }
     m.show_marked_edge(false);
@@ -46,7 +46,7 @@ int main(int argc, char *argv[])
                 {
                     for(uint pid : m.adj_v2p(vid))
                     {
-                        m.poly_data(pid).label = i;
+                        m.poly_label(pid) = i;
                     }
                 }
                 Trimesh<> subm;
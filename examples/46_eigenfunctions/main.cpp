@@ -47,7 +47,7 @@ int main(int argc, char **argv)
             {
                 double val  = f.at(curr_f*m.num_verts()+vid);
                 double norm = (val-f_min[curr_f])/(f_max[curr_f]-f_min[curr_f]);
-                m.vert_data(vid).color = Color::red_white_blue_ramp_01(norm);
+                m.vert_color(vid) = Color::red_white_blue_ramp_01(norm);
             }
             m.show_vert_color();
         }
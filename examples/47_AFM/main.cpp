@@ -41,6 +41,9 @@ void stats(const char *filename = NULL)
     std::cout << "            Moves TOT: " << data.moves_tot                << std::endl;
     std::cout << "                Flips: " << data.moves_flip               << std::endl;
     std::cout << "               Splits: " << data.moves_split              << std::endl;
+    std::cout << "         Failed moves: " << data.moves_failed             << std::endl;
+    std::cout << "            Moves/sec: " << data.moves_per_sec            << std::endl;
+    std::cout << "      Front size peak: " << data.front.peak               << std::endl;
     std::cout << "---------------------------------------"                  << std::endl;
     std::cout << "     Convexifications: " << data.convexifications         << std::endl;
     std::cout << "     Concavifications: " << data.concavifications         << std::endl;
@@ -150,8 +150,8 @@ int main(int argc, char **argv)
                         uint c1 = data.stripes.at(j  );
                         int  pid = data.m.poly_id({piv,c0,c1});
                         assert(pid>=0);
-                        data.m.poly_data(pid).color = c;
-                        res.poly_data(pid).color = c;
+                        data.m.poly_color(pid) = c;
+                        res.poly_color(pid) = c;
                         chains0.push_seg(data.m.vert(c0),data.m.vert(c1));
                         chains1.push_seg(res.vert(c0),res.vert(c1));
                     }
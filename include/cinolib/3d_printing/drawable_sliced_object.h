@@ -87,6 +87,21 @@ class DrawableSlicedObj : public AbstractDrawablePolygonMesh<SlicedObj<M,V,E,P>>
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+        template<class M2, class V2, class E2, class P2>
+        explicit DrawableSlicedObj(const Trimesh<M2,V2,E2,P2> & m,
+                                   const double layer_thickness,
+                                   const double hatch_size = 0.01)
+        : SlicedObj<M,V,E,P>(m, layer_thickness, hatch_size)
+        {
+            this->init_drawable_stuff();
+            this->show_marked_edge_color(Color::BLACK());
+            this->show_marked_edge_width(3.0);
+            this->show_wireframe(false);
+            this->updateGL();
+        }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
         ObjectType object_type() const { return DRAWABLE_SLICED_OBJ; }
 };
 
@@ -34,143 +34,281 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/3d_printing/optimal_build_dir.h>
-#include <cinolib/3d_printing/overhangs.h>
 #include <cinolib/3d_printing/height_along_build_dir.h>
-#include <cinolib/3d_printing/supports_contact_area.h>
-#include <cinolib/3d_printing/supports_volume.h>
-#include <cinolib/3d_printing/shadow_on_build_platform.h>
+#include <cinolib/3d_printing/supports_analysis.h>
+#include <cinolib/rasterize_shadow.h>
+#include <cinolib/soup_octree.h>
 #include <cinolib/sphere_coverage.h>
+#include <cinolib/parallel_for.h>
+#include <cinolib/tracer.h>
+#include <climits>
+#include <thread>
 
 namespace cinolib
 {
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-vec3d optimal_build_dir(const DrawableTrimesh<M,V,E,P> & m,
-                        const OptimalBuildDirOptions   & opt,
-                              float                    & best_height,
-                              float                    & best_shadow_area,
-                              float                    & best_contact_area,
-                              float                    & best_supp_volume)
+vec3d optimal_build_dir(const Trimesh<M,V,E,P>            & m,
+                        const OptimalBuildDirOptions      & opt,
+                              std::vector<BuildDirScores> & cache)
 {
-    // evenly sample the unit sphere to produce
-    // a set of candidate build directions
-    std::vector<vec3d> dirs;
-    sphere_coverage(opt.n_dirs, dirs);
-
-    // cache everything that can be cached to speed up computation
-    GLFWwindow *GL_context = create_offline_GL_context(opt.buffer_size, opt.buffer_size);
-    u_int8_t   *data       = new u_int8_t[opt.buffer_size*opt.buffer_size];
-    Octree octree;
-    octree.build_from_mesh_polys(m);
-
-    // compute scores for all candidate directions. scores are stored separately because this will
-    // allow to normalize them in the same range and combine them in a meaningful way...
-    //
-    std::vector<float> h(opt.n_dirs, inf_float); // height (along the build direction)
-    std::vector<float> a(opt.n_dirs, inf_float); // area of the projection on the building platform
-    std::vector<float> c(opt.n_dirs, inf_float); // area of the contacts between model and supports
-    std::vector<float> v(opt.n_dirs, inf_float); // volume of the supports
-    //
-    for(uint i=0; i<opt.n_dirs; ++i)
+    CINO_PROFILE_SCOPE("optimal_build_dir");
+
+    bool need_shadow    = (opt.w_shadow_area>0);
+    bool need_overhangs = (opt.w_support_contact>0 || opt.w_support_volume>0);
+
+    auto is_forbidden = [&](const vec3d & d) -> bool
     {
-        bool skip = false;
         for(const vec3d & fd : opt.forb_dirs)
         {
-            if(fd.angle_deg(dirs[i])<opt.forb_cone_angle)
+            if(fd.angle_deg(d)<opt.forb_cone_angle) return true;
+        }
+        return false;
+    };
+
+    // a cached entry can be reused if it contains all the metrics required by the current weights
+    auto is_complete = [&](const BuildDirScores & s) -> bool
+    {
+        return (!need_shadow    || s.shadow_area>=0) &&
+               (!need_overhangs || (s.contact_area>=0 && s.supp_volume>=0));
+    };
+
+    // the octree is built lazily, only if some direction is not in the cache
+    SoupOctree<TriangleSoup> octree;
+    bool octree_ready = false;
+
+    // evaluates all the directions in dirs that are neither forbidden nor cached,
+    // and appends their metrics to the cache. Directions are independent from each
+    // other, hence they are processed in parallel (each thread runs serially)
+    auto evaluate = [&](const std::vector<vec3d> & dirs)
+    {
+        std::vector<vec3d> todo;
+        for(const vec3d & d : dirs)
+        {
+            if(is_forbidden(d)) continue;
+            bool cached = false;
+            for(uint i=0; i<cache.size(); ++i)
             {
-                skip = true;
-                break;
+                if(cache.at(i).dir.dist(d) < 1e-6)
+                {
+                    cached = is_complete(cache.at(i));
+                    if(!cached) // incomplete: drop it and test it again
+                    {
+                        std::swap(cache.at(i), cache.back());
+                        cache.pop_back();
+                    }
+                    break;
+                }
             }
+            if(!cached) todo.push_back(d);
         }
-        if(skip) continue;
-
-        // NOTE: this call is 90% of the computational cost
-        std::vector<std::pair<uint,uint>> polys_hanging;
-        overhangs(m, opt.overhang_threshold, dirs[i], polys_hanging, octree);
+        if(todo.empty()) return;
 
-        // projection of the "lowest" mesh vertex along the build direction
-        // this is used further down to estimate the volume of support structures
-        // which are supposed to expand from the overhang down to the floor
-        float floor;
+        if(need_overhangs && !octree_ready)
+        {
+            CINO_PROFILE_SCOPE("optimal_build_dir::octree");
+            octree.build_from_mesh_polys(m);
+            octree_ready = true;
+        }
 
-        h[i] = (opt.w_height         >0) ? height_along_build_dir(m, dirs[i], floor) : 0.f;
-        a[i] = (opt.w_shadow_area    >0) ? shadow_on_build_platform(m, dirs[i], opt.buffer_size, data, GL_context) : 0.f;
-        c[i] = (opt.w_support_contact>0) ? supports_contact_area(m, polys_hanging) : 0.f;
-        v[i] = (opt.w_support_volume >0) ? supports_volume(m, dirs[i], floor, polys_hanging) : 0.f;
+        // directions are split in blocks of contiguous ids, one per thread. Each
+        // block reuses the buffers of a single SupportsAnalysis object
+        uint n_threads = opt.parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+        uint n_blocks  = std::max(1u, std::min(uint(todo.size()), n_threads));
+        uint blk_size  = (uint(todo.size()) + n_blocks - 1) / n_blocks;
+        std::vector<SupportsAnalysis> supp_pool(n_blocks);
 
-        // add penalty for critical surfaces
-        if(opt.w_support_contact>0 &&
-           opt.crit_srf.size()  >0)
+        std::vector<BuildDirScores> res(todo.size());
+        PARALLEL_FOR(0, n_blocks, opt.parallel ? 2 : UINT_MAX, [&](const uint b)
         {
-            for(auto & ov : polys_hanging)
+            uint end = std::min(uint(todo.size()), (b+1)*blk_size);
+            for(uint i=b*blk_size; i<end; ++i)
             {
-                // scale overhang area
-                if(CONTAINS(opt.crit_srf,ov.first))
+                CINO_PROFILE_SCOPE("optimal_build_dir::candidate");
+
+                BuildDirScores & s = res.at(i);
+                s.dir = todo.at(i);
+
+                // projection of the "lowest" mesh vertex along the build direction
+                // this is used further down to estimate the volume of support structures
+                // which are supposed to expand from the overhang down to the floor
+                float floor;
+                s.height = height_along_build_dir(m, s.dir, floor);
+
+                if(need_shadow)
                 {
-                    c[i] += m.poly_area(ov.first) * opt.crit_srf_boost;
+                    CINO_PROFILE_SCOPE("optimal_build_dir::shadow");
+                    std::vector<uint8_t> data(opt.buffer_size*opt.buffer_size);
+                    rasterize_shadow(m, s.dir, opt.buffer_size, opt.buffer_size, data.data(), false);
+                    uint shadow_pixels = 0;
+                    for(uint8_t px : data) if(px==0xFF) ++shadow_pixels;
+                    s.shadow_area = (float)shadow_pixels/data.size();
                 }
-                // scale area of poly vertically below overhang
-                if(ov.second!=ov.first && CONTAINS(opt.crit_srf,ov.second))
+
+                if(need_overhangs)
                 {
-                    c[i] += m.poly_area(ov.second) * opt.crit_srf_boost;
+                    SupportsAnalysis & supp = supp_pool.at(b);
+                    {
+                        // NOTE: this call is 90% of the computational cost
+                        CINO_PROFILE_SCOPE("optimal_build_dir::overhangs");
+                        supports_analysis(m, opt.overhang_threshold, s.dir, floor, octree, supp, false);
+                    }
+                    const std::vector<std::pair<uint,uint>> & polys_hanging = supp.overhangs;
+
+                    CINO_PROFILE_SCOPE("optimal_build_dir::metrics");
+                    s.contact_area = supp.contact_area;
+                    s.supp_volume  = supp.volume;
+
+                    // add penalty for critical surfaces
+                    if(opt.crit_srf.size()>0)
+                    {
+                        for(auto & ov : polys_hanging)
+                        {
+                            // scale overhang area
+                            if(CONTAINS(opt.crit_srf,ov.first))
+                            {
+                                s.contact_area += m.poly_area(ov.first) * opt.crit_srf_boost;
+                            }
+                            // scale area of poly vertically below overhang
+                            if(ov.second!=ov.first && CONTAINS(opt.crit_srf,ov.second))
+                            {
+                                s.contact_area += m.poly_area(ov.second) * opt.crit_srf_boost;
+                            }
+                        }
+                    }
                 }
             }
+        });
+        cache.insert(cache.end(), res.begin(), res.end());
+    };
+
+    // normalizes all metrics in [0,1] and combines them into a global score. Only
+    // the cached directions that are not forbidden take part in the normalization.
+    // Returns the ids of such directions, sorted by increasing score (best first)
+    auto rank = [&]() -> std::vector<uint>
+    {
+        std::vector<uint> ids;
+        for(uint i=0; i<cache.size(); ++i)
+        {
+            if(!is_forbidden(cache.at(i).dir) && is_complete(cache.at(i))) ids.push_back(i);
         }
-    }
+        if(ids.empty()) return ids;
+
+        float h_min = inf_float, h_max = -inf_float;
+        float a_min = inf_float, a_max = -inf_float;
+        float c_min = inf_float, c_max = -inf_float;
+        float v_min = inf_float, v_max = -inf_float;
+        for(uint i : ids)
+        {
+            const BuildDirScores & s = cache.at(i);
+            h_min = std::min(h_min, s.height      ); h_max = std::max(h_max, s.height      );
+            a_min = std::min(a_min, s.shadow_area ); a_max = std::max(a_max, s.shadow_area );
+            c_min = std::min(c_min, s.contact_area); c_max = std::max(c_max, s.contact_area);
+            v_min = std::min(v_min, s.supp_volume ); v_max = std::max(v_max, s.supp_volume );
+        }
+
+        std::vector<float> scores(cache.size(), inf_float);
+        for(uint i : ids)
+        {
+            const BuildDirScores & s = cache.at(i);
+            float h_norm = (h_max > h_min) ? (s.height       - h_min)/(h_max - h_min) : 1;
+            float a_norm = (a_max > a_min) ? (s.shadow_area  - a_min)/(a_max - a_min) : 1;
+            float c_norm = (c_max > c_min) ? (s.contact_area - c_min)/(c_max - c_min) : 1;
+            float v_norm = (v_max > v_min) ? (s.supp_volume  - v_min)/(v_max - v_min) : 1;
 
-    // release memory
-    destroy_offline_GL_context(GL_context);
-    delete[] data;
-
-    // normalize all scores in [0,1]
-    auto h_minmax = std::minmax_element(h.begin(), h.end());
-    auto a_minmax = std::minmax_element(a.begin(), a.end());
-    auto c_minmax = std::minmax_element(c.begin(), c.end());
-    auto v_minmax = std::minmax_element(v.begin(), v.end());
-    //
-    float h_min = *h_minmax.first; float h_max = *h_minmax.second;
-    float a_min = *a_minmax.first; float a_max = *a_minmax.second;
-    float c_min = *c_minmax.first; float c_max = *c_minmax.second;
-    float v_min = *v_minmax.first; float v_max = *v_minmax.second;
-    //
-    for(float & f : h) f = (h_max > h_min) ? (f - h_min)/(h_max - h_min) : 1;
-    for(float & f : a) f = (a_max > a_min) ? (f - a_min)/(a_max - a_min) : 1;
-    for(float & f : c) f = (c_max > c_min) ? (f - c_min)/(c_max - c_min) : 1;
-    for(float & f : v) f = (v_max > v_min) ? (f - v_min)/(v_max - v_min) : 1;
-
-    // compute global scores
-    std::vector<float> scores(opt.n_dirs);
-    for(uint i=0; i<opt.n_dirs; ++i)
+            // metrics with zero weight may not have been computed
+            scores[i] = opt.w_height * h_norm;
+            if(opt.w_shadow_area    >0) scores[i] += opt.w_shadow_area     * a_norm;
+            if(opt.w_support_contact>0) scores[i] += opt.w_support_contact * c_norm;
+            if(opt.w_support_volume >0) scores[i] += opt.w_support_volume  * v_norm;
+        }
+        std::stable_sort(ids.begin(), ids.end(), [&](const uint i, const uint j){ return scores[i] < scores[j]; });
+        return ids;
+    };
+
+    // evenly sample the unit sphere to produce a set of candidate build
+    // directions (always the same ones, so that they can be found in the cache)
+    std::vector<vec3d> dirs;
+    sphere_coverage(opt.n_dirs, dirs, false);
+    evaluate(dirs);
+
+    // coarse-to-fine refinement around the best candidates. The initial cone angle
+    // is half the average angular distance between the samples of the initial set
+    double cone = 0.5 * std::sqrt(4.0*M_PI/std::max(opt.n_dirs,1u));
+    for(uint step=0; step<opt.n_refine_steps; ++step, cone*=0.5)
     {
-        float h_norm = (h_max > h_min) ? (h[i] - h_min)/(h_max - h_min) : 1;
-        float a_norm = (a_max > a_min) ? (a[i] - a_min)/(a_max - a_min) : 1;
-        float c_norm = (c_max > c_min) ? (c[i] - c_min)/(c_max - c_min) : 1;
-        float v_norm = (v_max > v_min) ? (v[i] - v_min)/(v_max - v_min) : 1;
-
-        scores[i] = opt.w_height          * h_norm +
-                    opt.w_shadow_area     * a_norm +
-                    opt.w_support_contact * c_norm +
-                    opt.w_support_volume  * v_norm;
+        CINO_PROFILE_SCOPE("optimal_build_dir::refine");
+
+        std::vector<uint> ids = rank();
+        dirs.clear();
+        for(uint i=0; i<std::min((uint)ids.size(), opt.n_refine_best); ++i)
+        {
+            vec3d d = cache.at(ids.at(i)).dir;
+            vec3d u = (std::fabs(d.x())<0.9) ? d.cross(vec3d(1,0,0)) : d.cross(vec3d(0,1,0));
+            u.normalize();
+            vec3d v = d.cross(u);
+            for(uint j=0; j<opt.n_refine_dirs; ++j)
+            {
+                double ang = 2.0*M_PI*(j + 0.5*(step%2))/opt.n_refine_dirs;
+                vec3d  n   = d*std::cos(cone) + (u*std::cos(ang) + v*std::sin(ang))*std::sin(cone);
+                n.normalize();
+                dirs.push_back(n);
+            }
+        }
+        evaluate(dirs);
     }
 
+    CINO_PROFILE_MEMORY();
+
     // pick the best dir (lowest score)
-    auto   it = std::min_element(scores.begin(), scores.end());
+    std::vector<uint> ids = rank();
+    if(ids.empty())
+    {
+        std::cerr << "WARNING: all candidate build directions are forbidden" << std::endl;
+        return vec3d(0,0,1);
+    }
+    return cache.at(ids.front()).dir;
+}
 
-    best_height       = h.at(std::distance(scores.begin(),it));
-    best_shadow_area  = a.at(std::distance(scores.begin(),it));
-    best_contact_area = c.at(std::distance(scores.begin(),it));
-    best_supp_volume  = v.at(std::distance(scores.begin(),it));
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-    return dirs.at(std::distance(scores.begin(),it));
+template<class M, class V, class E, class P>
+CINO_INLINE
+vec3d optimal_build_dir(const Trimesh<M,V,E,P>       & m,
+                        const OptimalBuildDirOptions & opt,
+                              float                  & best_height,
+                              float                  & best_shadow_area,
+                              float                  & best_contact_area,
+                              float                  & best_supp_volume)
+{
+    std::vector<BuildDirScores> cache;
+    vec3d best = optimal_build_dir(m, opt, cache);
+
+    best_height       = 0.f;
+    best_shadow_area  = 0.f;
+    best_contact_area = 0.f;
+    best_supp_volume  = 0.f;
+    for(const BuildDirScores & s : cache)
+    {
+        if(s.dir==best)
+        {
+            best_height       = std::max(0.f, s.height);
+            best_shadow_area  = std::max(0.f, s.shadow_area);
+            best_contact_area = std::max(0.f, s.contact_area);
+            best_supp_volume  = std::max(0.f, s.supp_volume);
+            break;
+        }
+    }
+    return best;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-vec3d optimal_build_dir(const DrawableTrimesh<M,V,E,P> & m,
-                        const OptimalBuildDirOptions   & opt)
+vec3d optimal_build_dir(const Trimesh<M,V,E,P>       & m,
+                        const OptimalBuildDirOptions & opt)
 {
     float best_height;
     float best_shadow_area;
@@ -36,7 +36,7 @@
 #ifndef CINO_OPTIMAL_BUILD_DIR_H
 #define CINO_OPTIMAL_BUILD_DIR_H
 
-#include <cinolib/meshes/drawable_trimesh.h>
+#include <cinolib/meshes/trimesh.h>
 
 namespace cinolib
 {
@@ -76,6 +76,22 @@ namespace cinolib
  * the support contact area, the area of critical surfaces touched by a support structure
  * will be multiplied by a boost factor, in order to count more than the other regular
  * surface elements.
+ *
+ * Candidate directions are independent from each other and are evaluated in parallel.
+ * The shadow area is computed with a CPU rasterizer (see rasterize_shadow), hence no
+ * GL context (nor GPU, nor display) is necessary to run this method.
+ *
+ * Coarse-to-fine refinement: rather than sampling the sphere very densely, users can
+ * start from a coarse set of directions and ask for a number of refinement steps. At each
+ * step, the best directions found so far are refined by testing new candidates on a
+ * cone around them. The cone angle starts from (half) the average spacing between the
+ * initial candidates, and halves at each step.
+ *
+ * Caching: metrics of all tested directions can be stored in (and reused from) a cache.
+ * Repeated calls that only change the weights, the forbidden directions or the refinement
+ * options will not evaluate again the directions that have already been tested. The cache
+ * is tied to the mesh and to the overhang threshold, buffer size and critical surfaces,
+ * and must be cleared if any of them changes.
 */
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -93,25 +109,51 @@ struct OptimalBuildDirOptions
     float forb_cone_angle    = 3.0;     // amplitude of each cone hosting a forbidden build direction
     std::vector<vec3d>       forb_dirs; // set of forbidden build directions
     std::unordered_set<uint> crit_srf;  // list of triangles that are critical
+    uint  n_refine_steps     = 0;       // # of coarse-to-fine refinement steps (0 = no refinement)
+    uint  n_refine_best      = 3;       // # of best directions refined at each step
+    uint  n_refine_dirs      = 8;       // # of new candidates sampled around each of them
+    bool  parallel           = true;    // evaluate candidate directions concurrently
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+// raw (i.e. not normalized) metrics of a tested build direction. Metrics
+// that were not computed because their weight was zero are set to -1
+//
+struct BuildDirScores
+{
+    vec3d dir;
+    float height       = -1; // height along the build direction
+    float shadow_area  = -1; // area of the projection on the building platform (ratio of the buffer)
+    float contact_area = -1; // area of the contacts between model and supports
+    float supp_volume  = -1; // volume of the supports
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+vec3d optimal_build_dir(const Trimesh<M,V,E,P>            & m,
+                        const OptimalBuildDirOptions      & opt,
+                              std::vector<BuildDirScores> & cache); // metrics of tested dirs (in/out)
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<class M, class V, class E, class P>
 CINO_INLINE
-vec3d optimal_build_dir(const DrawableTrimesh<M,V,E,P> & m,
-                        const OptimalBuildDirOptions   & opt,
-                              float                    & best_height,
-                              float                    & best_shadow_area,
-                              float                    & best_contact_area,
-                              float                    & best_supp_volume);
+vec3d optimal_build_dir(const Trimesh<M,V,E,P>       & m,
+                        const OptimalBuildDirOptions & opt,
+                              float                  & best_height,
+                              float                  & best_shadow_area,
+                              float                  & best_contact_area,
+                              float                  & best_supp_volume);
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-vec3d optimal_build_dir(const DrawableTrimesh<M,V,E,P> & m,
-                        const OptimalBuildDirOptions   & opt);
+vec3d optimal_build_dir(const Trimesh<M,V,E,P>       & m,
+                        const OptimalBuildDirOptions & opt);
 
 }
 
@@ -37,7 +37,7 @@
 #include <cinolib/parallel_for.h>
 #include <cinolib/octree.h>
 #include <cinolib/find_intersections.h>
-#include <mutex>
+#include <climits>
 
 namespace cinolib
 {
@@ -47,55 +47,50 @@ CINO_INLINE
 void overhangs(const Trimesh<M,V,E,P>  & m,
                const float               thresh, // degrees
                const vec3d             & build_dir,
-                     std::vector<uint> & polys_hanging)
+                     std::vector<uint> & polys_hanging,
+               const bool                parallel)
 {
-    std::mutex mutex;
-    PARALLEL_FOR(0, m.num_polys(), 1000, [&](const uint pid)
+    std::vector<uint8_t> is_hanging(m.num_polys());
+    PARALLEL_FOR(0, m.num_polys(), parallel ? 1000 : UINT_MAX, [&](const uint pid)
     {
-        float ang = build_dir.angle_deg(m.poly_data(pid).normal);
-        if(ang-90.f > thresh)
-        {
-            std::lock_guard<std::mutex> guard(mutex);
-            polys_hanging.push_back(pid);
-        }
+        float ang = build_dir.angle_deg(m.poly_normal(pid));
+        is_hanging[pid] = (ang-90.f > thresh);
     });
+    // compact serially, so that the output is sorted by ID regardless of threads
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        if(is_hanging[pid]) polys_hanging.push_back(pid);
+    }
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-template<class M, class V, class E, class P>
+template<class M, class V, class E, class P, class Tree>
 CINO_INLINE
 void overhangs(const Trimesh<M,V,E,P>                  & m,
                const float                               thresh, // degrees
                const vec3d                             & build_dir,
                      std::vector<std::pair<uint,uint>> & polys_hanging,
-               const Octree                            & octree) // cached
+               const Tree                              & octree, // cached
+               const bool                                parallel)
 {
     // find overhanging triangles
     std::vector<uint> tmp;
-    overhangs(m, thresh, build_dir, tmp);
+    overhangs(m, thresh, build_dir, tmp, parallel);
 
-    // cast a ray from each overhang to find the first triangle below it
-    std::mutex mutex;
-    PARALLEL_FOR(0, tmp.size(), 1000, [&](const uint i)
+    // cast a ray from each overhang to find the first triangle below it.
+    // Each thread writes in its own slot of the output, whose order is
+    // therefore deterministic
+    size_t off = polys_hanging.size();
+    polys_hanging.resize(off+tmp.size());
+    PARALLEL_FOR(0, tmp.size(), parallel ? 1000 : UINT_MAX, [&](const uint i)
     {
-        uint pid  = tmp[i];
-        auto pair = std::make_pair(pid,pid);
-        std::set<std::pair<double,uint>> hits;
-        if(octree.intersects_ray(m.poly_centroid(pid), -build_dir, hits))
-        {
-            auto hit = hits.begin();
-            if(hit->second==pid) ++hit; // skip the first hit, it's the starting polygon
-            if(hit!=hits.end())
-            {
-                pair.second = hit->second;
-            }
-        }
-        // critical section
-        {
-            std::lock_guard<std::mutex> guard(mutex);
-            polys_hanging.push_back(pair);
-        }
+        uint   pid = tmp[i];
+        uint   below;
+        double t;
+        // skip the starting polygon, which is always hit at t=0
+        if(!octree.intersects_ray(m.poly_centroid(pid), -build_dir, pid, t, below)) below = pid;
+        polys_hanging[off+i] = std::make_pair(pid,below);
     });
 }
 
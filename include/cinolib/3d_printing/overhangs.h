@@ -47,7 +47,8 @@ CINO_INLINE
 void overhangs(const Trimesh<M,V,E,P>  & m,
                const float               thresh, // degrees
                const vec3d             & build_dir,
-                     std::vector<uint> & polys_hanging);
+                     std::vector<uint> & polys_hanging,
+               const bool                parallel = true);
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
@@ -78,15 +79,19 @@ void overhangs(const Trimesh<M,V,E,P>                  & m,
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 // in case the function is called multiple times, it is convenient to
-// pay the cost for building the octree just once
+// pay the cost for building the octree just once. Any spatial data structure
+// that returns the first hit along a ray can be used (e.g. Octree, SoupOctree).
+// Set parallel to false when the function is already called from within a
+// parallel loop (e.g. to test multiple build directions concurrently)
 //
-template<class M, class V, class E, class P>
+template<class M, class V, class E, class P, class Tree>
 CINO_INLINE
 void overhangs(const Trimesh<M,V,E,P>                  & m,
                const float                               thresh, // degrees
                const vec3d                             & build_dir,
                      std::vector<std::pair<uint,uint>> & polys_hanging,
-               const Octree                            & octree); // cached
+               const Tree                              & octree,  // cached
+               const bool                                parallel = true);
 }
 
 #ifndef  CINO_STATIC_LIB
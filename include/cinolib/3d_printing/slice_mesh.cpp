@@ -0,0 +1,221 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/3d_printing/slice_mesh.h>
+#include <cinolib/parallel_for.h>
+#include <unordered_map>
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <cmath>
+
+namespace cinolib
+{
+
+// oriented intersection between a triangle and a plane. Endpoints are identified
+// by the (sorted) ids of the vertices of the edge they lie on
+//
+struct SliceSegment
+{
+    uint64_t e_from, e_to;
+    vec3d    p_from;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void slice_layer(const Trimesh<M,V,E,P>                     & m,
+                 const std::vector<uint>                    & active,
+                 const double                                 h,
+                       std::vector<SliceSegment>            & segs,   // buffer (reused across layers)
+                       std::unordered_map<uint64_t,uint>    & next,   // buffer (reused across layers)
+                       std::vector<std::vector<vec3d>>      & internal_polylines,
+                       std::vector<std::vector<vec3d>>      & external_polylines)
+{
+    // point where the plane crosses the edge from a (below) to b (above)
+    auto cross = [&](const uint a, const uint b, uint64_t & key) -> vec3d
+    {
+        key = (a<b) ? (uint64_t(a)<<32 | b) : (uint64_t(b)<<32 | a);
+        const vec3d & pa = m.vert(a);
+        const vec3d & pb = m.vert(b);
+        if(pb.z()==h) return pb;
+        double t = (h - pa.z())/(pb.z() - pa.z());
+        return vec3d(pa.x() + (pb.x()-pa.x())*t, pa.y() + (pb.y()-pa.y())*t, h);
+    };
+
+    segs.clear();
+    for(uint pid : active)
+    {
+        uint v[3] = { m.poly_vert_id(pid,0), m.poly_vert_id(pid,1), m.poly_vert_id(pid,2) };
+        bool up[3];
+        for(uint i=0; i<3; ++i) up[i] = (m.vert(v[i]).z()>=h);
+        if(up[0]==up[1] && up[1]==up[2]) continue;
+
+        // walking along the triangle boundary (in its winding order) the plane is
+        // crossed once going upwards and once going downwards. If triangles are
+        // oriented outwards, going from the downward crossing to the upward crossing
+        // leaves the inside of the object to the left (i.e. outer boundaries are CCW)
+        SliceSegment s;
+        for(uint i=0; i<3; ++i)
+        {
+            uint j = (i+1)%3;
+            if(up[i]==up[j]) continue;
+            if(up[i]) s.p_from = cross(v[j], v[i], s.e_from); // downward
+            else      cross(v[i], v[j], s.e_to);              // upward
+        }
+        segs.push_back(s);
+    }
+
+    // chain segments into contours
+    next.clear();
+    for(uint i=0; i<segs.size(); ++i) next[segs.at(i).e_from] = i;
+    std::vector<bool> visited(segs.size(), false);
+    for(uint i=0; i<segs.size(); ++i)
+    {
+        if(visited.at(i)) continue;
+        std::vector<vec3d> contour;
+        bool closed = false;
+        uint curr   = i;
+        while(!visited.at(curr))
+        {
+            visited.at(curr) = true;
+            const vec3d & p = segs.at(curr).p_from;
+            if(contour.empty() || !(contour.back()==p)) contour.push_back(p);
+            auto it = next.find(segs.at(curr).e_to);
+            if(it==next.end()) break;
+            curr = it->second;
+            if(curr==i) closed = true;
+        }
+        if(!closed) continue;
+        if(contour.size()>1 && contour.back()==contour.front()) contour.pop_back();
+        if(contour.size()<3) continue;
+
+        // signed area (shoelace formula)
+        double area = 0;
+        for(uint j=0; j<contour.size(); ++j)
+        {
+            const vec3d & a = contour.at(j);
+            const vec3d & b = contour.at((j+1)%contour.size());
+            area += a.x()*b.y() - b.x()*a.y();
+        }
+        if(area>0) external_polylines.push_back(contour); else
+        if(area<0) internal_polylines.push_back(contour);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void slice_mesh(const Trimesh<M,V,E,P>                             & m,
+                const std::vector<double>                          & z_levels,
+                      std::vector<std::vector<std::vector<vec3d>>> & internal_polylines,
+                      std::vector<std::vector<std::vector<vec3d>>> & external_polylines)
+{
+    uint n_layers = z_levels.size();
+    internal_polylines.assign(n_layers, {});
+    external_polylines.assign(n_layers, {});
+    if(n_layers==0 || m.num_polys()==0) return;
+
+    // z extent of each triangle, and triangles sorted by their lowest z
+    std::vector<double> z_min(m.num_polys());
+    std::vector<double> z_max(m.num_polys());
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        double z0 = m.poly_vert(pid,0).z();
+        double z1 = m.poly_vert(pid,1).z();
+        double z2 = m.poly_vert(pid,2).z();
+        z_min.at(pid) = std::min({z0,z1,z2});
+        z_max.at(pid) = std::max({z0,z1,z2});
+    }
+    std::vector<uint> order(m.num_polys());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](const uint a, const uint b){ return z_min[a] < z_min[b]; });
+    std::vector<double> sorted_z_min(order.size());
+    for(uint i=0; i<order.size(); ++i) sorted_z_min.at(i) = z_min.at(order.at(i));
+
+    // split layers into as many contiguous ranges as threads
+    uint n_threads = std::max(1u, std::thread::hardware_concurrency());
+    uint n_ranges  = std::min(n_layers, n_threads);
+    PARALLEL_FOR(0, n_ranges, 2, [&](const uint r)
+    {
+        uint l_beg = uint(uint64_t(r  )*n_layers/n_ranges);
+        uint l_end = uint(uint64_t(r+1)*n_layers/n_ranges);
+
+        // initialize the active list for the first plane of the range
+        double h = z_levels.at(l_beg);
+        uint   i = uint(std::upper_bound(sorted_z_min.begin(), sorted_z_min.end(), h) - sorted_z_min.begin());
+        std::vector<uint> active;
+        for(uint j=0; j<i; ++j) if(z_max.at(order.at(j))>=h) active.push_back(order.at(j));
+
+        std::vector<SliceSegment>         segs;
+        std::unordered_map<uint64_t,uint> next;
+        for(uint l=l_beg; l<l_end; ++l)
+        {
+            h = z_levels.at(l);
+            // add triangles that start below the plane, remove those that end below it
+            while(i<order.size() && sorted_z_min.at(i)<=h) active.push_back(order.at(i++));
+            active.erase(std::remove_if(active.begin(), active.end(), [&](const uint pid){ return z_max.at(pid)<h; }), active.end());
+
+            slice_layer(m, active, h, segs, next, internal_polylines.at(l), external_polylines.at(l));
+        }
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void slice_mesh(const Trimesh<M,V,E,P>                             & m,
+                const double                                         layer_thickness,
+                      std::vector<double>                          & z_levels,
+                      std::vector<std::vector<std::vector<vec3d>>> & internal_polylines,
+                      std::vector<std::vector<std::vector<vec3d>>> & external_polylines)
+{
+    assert(layer_thickness>0);
+    z_levels.clear();
+    double z_beg = m.bbox().min.z();
+    double z_end = m.bbox().max.z();
+    uint   n     = uint(std::ceil((z_end-z_beg)/layer_thickness));
+    for(uint i=0; i<n; ++i)
+    {
+        double z = z_beg + (i+0.5)*layer_thickness;
+        if(z<z_end) z_levels.push_back(z);
+    }
+    slice_mesh(m, z_levels, internal_polylines, external_polylines);
+}
+
+}
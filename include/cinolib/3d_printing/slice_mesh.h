@@ -0,0 +1,96 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_SLICE_MESH_H
+#define CINO_SLICE_MESH_H
+
+#include <cinolib/meshes/trimesh.h>
+
+namespace cinolib
+{
+
+/* Slices a closed and consistently oriented triangle mesh with a set of
+ * horizontal planes (the build direction is assumed to be +Z), producing
+ * the closed contours of each layer. Output contours follow the same
+ * conventions of read_CLI, and can therefore be used to build a SlicedObj
+ * or to be exported with write_CLI:
+ *
+ *  - external_polylines: outer boundaries of the slice (CCW, seen from +Z)
+ *  - internal_polylines: holes (CW, seen from +Z)
+ *
+ * Each contour is a list of points in 3D (z is the level of the slice), and
+ * the first point is not repeated at the end of the list.
+ *
+ * Triangles are sorted by their minimum z, and layer planes are swept in
+ * ascending order keeping a list of active triangles (i.e. triangles whose
+ * z extent contains the current plane). Intersection segments are oriented
+ * using the winding of the triangles (no normals are needed), and are chained
+ * into contours by matching their endpoints, which are identified by the mesh
+ * edge they lie on (hashed). Vertices lying exactly on a plane are considered
+ * above it, therefore contours are always watertight. Chains that do not close
+ * (e.g. because the mesh has boundaries) are discarded.
+ *
+ * Layers are split into ranges that are processed in parallel, each with its
+ * own sweep.
+*/
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void slice_mesh(const Trimesh<M,V,E,P>                             & m,
+                const std::vector<double>                          & z_levels,            // sorted in ascending order
+                      std::vector<std::vector<std::vector<vec3d>>> & internal_polylines,  // inner holes
+                      std::vector<std::vector<std::vector<vec3d>>> & external_polylines); // outer slice boundary
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// slices the mesh with evenly spaced planes, placed at the middle of
+// layers with the given thickness. The z of each plane is returned in
+// z_levels
+//
+template<class M, class V, class E, class P>
+CINO_INLINE
+void slice_mesh(const Trimesh<M,V,E,P>                             & m,
+                const double                                         layer_thickness,
+                      std::vector<double>                          & z_levels,
+                      std::vector<std::vector<std::vector<vec3d>>> & internal_polylines,  // inner holes
+                      std::vector<std::vector<std::vector<vec3d>>> & external_polylines); // outer slice boundary
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "slice_mesh.cpp"
+#endif
+
+#endif // CINO_SLICE_MESH_H
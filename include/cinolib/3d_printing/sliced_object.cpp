@@ -35,6 +35,7 @@
 *********************************************************************************/
 #include <cinolib/3d_printing/sliced_object.h>
 #include <cinolib/io/read_CLI.h>
+#include <cinolib/3d_printing/slice_mesh.h>
 #include <cinolib/triangle_wrap.h>
 #include <cinolib/vector_serialization.h>
 #include <cinolib/ANSI_color_codes.h>
@@ -73,6 +74,26 @@ SlicedObj<M,V,E,P>::SlicedObj(const std::vector<std::vector<std::vector<vec3d>>>
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+template<class M, class V, class E, class P>
+template<class M2, class V2, class E2, class P2>
+CINO_INLINE
+SlicedObj<M,V,E,P>::SlicedObj(const Trimesh<M2,V2,E2,P2> & m,
+                              const double layer_thickness,
+                              const double thick_radius)
+    : Trimesh<M,V,E,P>()
+    , thick_radius(thick_radius)
+{
+    std::vector<double> z_levels;
+    std::vector<std::vector<std::vector<vec3d>>> slice_polys;
+    std::vector<std::vector<std::vector<vec3d>>> slice_holes;
+    slice_mesh(m, layer_thickness, z_levels, slice_polys, slice_holes);
+    std::vector<std::vector<std::vector<vec3d>>> supports(z_levels.size());
+    hatches.resize(z_levels.size());
+    init(slice_polys, slice_holes, supports);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<class M, class V, class E, class P>
 CINO_INLINE
 BoostMultiPolygon SlicedObj<M,V,E,P>::slice_as_boost_poly(const uint sid) const
@@ -143,16 +164,16 @@ void SlicedObj<M,V,E,P>::triangulate_slices()
         for(auto p : verts)
         {
             uint vid = this->vert_add(p);
-            this->vert_data(vid).uvw[0] = static_cast<double>(sid)/static_cast<double>(num_slices());
-            this->vert_data(vid).label  = sid;
+            this->vert_uvw(vid)[0] = static_cast<double>(sid)/static_cast<double>(num_slices());
+            this->vert_label(vid)  = sid;
         }
         for(uint i=0; i<n_tris; ++i)
         {
             uint pid = this->poly_add(base_addr + tris.at(3*i+0),
                                       base_addr + tris.at(3*i+1),
                                       base_addr + tris.at(3*i+2));
-            this->poly_data(pid).label = sid;
-            for(uint eid : this->adj_p2e(pid)) this->edge_data(eid).label = sid;
+            this->poly_label(pid) = sid;
+            for(uint eid : this->adj_p2e(pid)) this->edge_label(eid) = sid;
         }
     }
     std::cout << "new sliced object (" << num_slices() << " slices)" << std::endl;
@@ -176,7 +197,7 @@ void SlicedObj<M,V,E,P>::slice_segments(const uint           sid,
     uint fresh_id = 0;
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
-        if(this->edge_is_boundary(eid) && this->edge_data(eid).label == (int)sid)
+        if(this->edge_is_boundary(eid) && this->edge_label(eid) == (int)sid)
         {
             for(uint off=0; off<2; ++off)
             {
@@ -70,6 +70,14 @@ class SlicedObj : public Trimesh<M,V,E,P>
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+        // slices a closed triangle mesh (build direction: +Z) with layers of the given thickness
+        template<class M2, class V2, class E2, class P2>
+        explicit SlicedObj(const Trimesh<M2,V2,E2,P2> & m,
+                           const double layer_thickness,
+                           const double thick_radius = 0.01);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
         uint num_slices() const { return slices.size(); }
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
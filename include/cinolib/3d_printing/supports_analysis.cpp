@@ -0,0 +1,98 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/3d_printing/supports_analysis.h>
+#include <cinolib/parallel_for.h>
+#include <climits>
+
+namespace cinolib
+{
+
+template<class M, class V, class E, class P, class Tree>
+CINO_INLINE
+void supports_analysis(const Trimesh<M,V,E,P> & m,
+                       const float              thresh, // degrees
+                       const vec3d            & build_dir,
+                       const float              floor,
+                       const Tree             & octree,
+                             SupportsAnalysis & res,
+                       const bool               parallel)
+{
+    vec3d c = m.centroid();
+
+    // below[pid] is max_uint if pid is not an overhang
+    res.below.resize(m.num_polys());
+    res.area.resize(m.num_polys());
+    res.length.resize(m.num_polys());
+    PARALLEL_FOR(0, m.num_polys(), parallel ? 1000 : UINT_MAX, [&](const uint pid)
+    {
+        float ang = build_dir.angle_deg(m.poly_normal(pid));
+        if(ang-90.f <= thresh)
+        {
+            res.below[pid] = max_uint;
+            return;
+        }
+
+        vec3d  p = m.poly_centroid(pid);
+        uint   below;
+        double t;
+        if(!octree.intersects_ray(p, -build_dir, pid, t, below)) below = pid;
+
+        float z_beg = (p - c).dot(build_dir);
+        float z_end = (below==pid) ? floor : (m.poly_centroid(below) - c).dot(build_dir);
+        res.below[pid]  = below;
+        res.area[pid]   = m.poly_area(pid);
+        res.length[pid] = z_beg - z_end;
+    });
+
+    // gather, in ID order
+    res.overhangs.clear();
+    res.lengths.clear();
+    res.contact_area = 0;
+    res.volume       = 0;
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        uint below = res.below[pid];
+        if(below==max_uint) continue;
+        res.overhangs.push_back(std::make_pair(pid,below));
+        res.lengths.push_back(res.length[pid]);
+        // if overhang projects over the mesh, the contact area counts twice
+        res.contact_area += res.area[pid];
+        if(below!=pid) res.contact_area += res.area[pid];
+        res.volume       += float(res.area[pid]) * res.length[pid];
+    }
+}
+
+}
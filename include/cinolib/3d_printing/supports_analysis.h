@@ -0,0 +1,93 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_SUPPORTS_ANALYSIS_H
+#define CINO_SUPPORTS_ANALYSIS_H
+
+#include <cinolib/meshes/trimesh.h>
+
+namespace cinolib
+{
+
+// Per direction analysis of the support structures necessary to print mesh m along
+// a given build direction. It fuses in a single parallel sweep over the triangles the
+// computation of overhangs (see overhangs.h), of the triangles below them, of the length
+// of each support and of the total contact area and volume of supports. Results are the
+// same of calling cinolib::overhangs, cinolib::supports_contact_area and cinolib::supports_volume
+// in a row, but areas and centroids are computed only once, and in parallel. Overhangs are
+// sorted by ID, and totals are accumulated in that order, so the output does not depend on
+// the number of threads.
+//
+// Per triangle buffers are stored in the output struct, and are reused across calls.
+// This makes it convenient to keep one SupportsAnalysis object per thread when the
+// function is called multiple times, e.g. to test many candidate build directions.
+//
+struct SupportsAnalysis
+{
+    std::vector<std::pair<uint,uint>> overhangs;    // (hanging triangle, triangle below it or itself if none)
+    std::vector<float>                lengths;      // length of the support of each overhang, along the build direction
+    float                             contact_area = 0;
+    float                             volume       = 0;
+
+    // per triangle scratch buffers (reused across calls)
+    std::vector<uint>                 below;
+    std::vector<double>               area;
+    std::vector<float>                length;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// floor is the projection of the lowest point of the mesh along the build direction,
+// measured from the mesh centroid (see height_along_build_dir). Any spatial data structure
+// that returns the first hit along a ray can be used (e.g. Octree, SoupOctree). Set parallel
+// to false when the function is already called from within a parallel loop
+//
+template<class M, class V, class E, class P, class Tree>
+CINO_INLINE
+void supports_analysis(const Trimesh<M,V,E,P> & m,
+                       const float              thresh, // degrees
+                       const vec3d            & build_dir,
+                       const float              floor,
+                       const Tree             & octree,
+                             SupportsAnalysis & res,
+                       const bool               parallel = true);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "supports_analysis.cpp"
+#endif
+
+#endif // CINO_SUPPORTS_ANALYSIS_H
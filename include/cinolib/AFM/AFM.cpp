@@ -36,10 +36,12 @@
 #include <cinolib/AFM/AFM.h>
 #include <cinolib/AFM/flip_checks.h>
 #include <cinolib/AFM/advance_move.h>
+#include <cinolib/AFM/front.h>
 #include <cinolib/geometry/n_sided_poygon.h>
 #include <cinolib/split_separating_simplices.h>
 #include <cinolib/how_many_seconds.h>
 #include <cinolib/dijkstra.h>
+#include <cinolib/tracer.h>
 
 namespace cinolib
 {
@@ -47,59 +49,72 @@ namespace cinolib
 CINO_INLINE
 void AFM(AFM_data & data)
 {
+    CINO_PROFILE_SCOPE("AFM");
+
     if(!data.initialized) AFM_init(data);
 
     uint step_count = 0;
+    uint iter_count = 0;
+    uint moves_in   = data.moves_tot;
+    auto t_in       = std::chrono::steady_clock::now();
+
+    // front counters are sampled (once every few moves, plus at the end of the
+    // call) as emitting them at every move would flood the trace
+    const uint counter_stride = 1000;
+    auto emit_counters = [&]()
+    {
+        CINO_PROFILE_COUNTER("AFM::front_size", data.front.index.size());
+        CINO_PROFILE_COUNTER("AFM::tris", data.m0.num_polys());
+    };
 
-    while(!data.front.empty())
+    // pop the cheapest edge in the front, along with the triangle it conquers
+    uint v0, v1, pid;
+    while(front_pop(data, v0, v1, pid))
     {
-        // pop the first edge in the front
-        uint v0 = data.front.front();
-        data.front.pop_front();
-        uint v1 = data.front.front();
-        data.front.pop_front();
-
-        // pick the edge ID
-        int eid = data.m0.edge_id(v0,v1);
-        // if the edge does not exist anymore or it's not marked, it was already processed
-        if(eid<0 || !data.m0.edge_data(eid).flags[MARKED]) continue;
-
-        // pick the ID of the triangle to conquer to advance the front
-        uint pid = data.m0.adj_e2p(eid).front();
-        if(data.m0.poly_data(pid).flags[MARKED])
+        // front edges in pid, for classification
+        uint front_edges = data.front.poly_front_edges.at(pid);
+        if(data.enable_sanity_checks)
         {
-            pid = data.m0.adj_e2p(eid).back();
-            assert(!data.m0.poly_data(pid).flags[MARKED]);
+            assert(front_edges == uint(data.m0.edge_data(data.m0.poly_edge_id(pid,0)).flags[MARKED] +
+                                       data.m0.edge_data(data.m0.poly_edge_id(pid,1)).flags[MARKED] +
+                                       data.m0.edge_data(data.m0.poly_edge_id(pid,2)).flags[MARKED]));
         }
 
-        // count front edges in pid, for classification
-        uint front_edges = data.m0.edge_data(data.m0.poly_edge_id(pid,0)).flags[MARKED] +
-                           data.m0.edge_data(data.m0.poly_edge_id(pid,1)).flags[MARKED] +
-                           data.m0.edge_data(data.m0.poly_edge_id(pid,2)).flags[MARKED];
-
         auto tic = std::chrono::steady_clock::now();
 
         switch(front_edges)
         {
             case 1:
             {
+                CINO_PROFILE_SCOPE("AFM::advance_by_triangle_split");
                 if(advance_by_triangle_split(data, pid, v0, v1))
                 {
                     ++data.moves_tot;
                     ++data.moves_split;
                     ++step_count;
                 }
+                else
+                {
+                    ++data.moves_failed;
+                    front_postpone(data, v0, v1);
+                }
                 break;
             }
 
             case 2: // advance by edge flip or split
             {
+                CINO_PROFILE_SCOPE("AFM::advance_by_edge_flip");
                 if(advance_by_edge_flip(data, pid))
                 {
                     ++data.moves_tot;
                     ++data.moves_flip;
                     ++step_count;
                 }
+                else
+                {
+                    ++data.moves_failed;
+                    front_postpone(data, v0, v1);
+                }
                 break;
             }
 
@@ -109,6 +124,8 @@ void AFM(AFM_data & data)
 
         auto toc = std::chrono::steady_clock::now();
 
+        if(++iter_count % counter_stride == 0) emit_counters();
+
         if(data.abort_if_too_slow && how_many_seconds(tic,toc)>data.max_time_per_step)
         {
             std::cout << "Time per single iteration is above " << data.max_time_per_step << "s\nEXIT" << std::endl;
@@ -116,7 +133,7 @@ void AFM(AFM_data & data)
             break;
         }
 
-        if(data.step_by_step && step_count==data.step_size) return;
+        if(data.step_by_step && step_count==data.step_size) break;
 
         if(data.stop)
         {
@@ -124,6 +141,14 @@ void AFM(AFM_data & data)
             break;
         }
     }
+
+    emit_counters();
+
+    // instrumentation (refers to the moves executed in this call)
+    double secs = how_many_seconds(t_in, std::chrono::steady_clock::now());
+    data.moves_per_sec = (secs>0) ? float((data.moves_tot-moves_in)/secs) : 0.f;
+    data.tris_out      = data.m0.num_polys();
+    data.mesh_growth   = (data.tris_out-data.tris_in)/float(data.tris_in);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -131,6 +156,8 @@ void AFM(AFM_data & data)
 CINO_INLINE
 void AFM_init(AFM_data & data)
 {
+    CINO_PROFILE_SCOPE("AFM_init");
+
     data.initialized = true;
 
     if(!data.m0.mesh_is_manifold())
@@ -166,26 +193,20 @@ void AFM_init(AFM_data & data)
     data.m0.poly_set_flag(MARKED,false);
     data.m0.vert_set_flag(MARKED,false);
     data.m0.edge_set_flag(MARKED,false); // marked edges belong to the current front
-    for(auto i=border.begin(),j=i+1; j!=border.end(); ++i,++j)
+    for(uint i=0; i<border.size(); ++i)
     {
-        data.front.push_back(*i);
-        data.front.push_back(*j);
+        uint vi = border.at(i);
+        uint vj = border.at((i+1)%border.size());
 
-        data.m0.vert_data(*i).flags[MARKED] = true;
-        data.m0.vert_data(*j).flags[MARKED] = true;
+        data.m0.vert_data(vi).flags[MARKED] = true;
 
-        data.m1.poly_add(*i,*j,data.origin);
+        data.m1.poly_add(vi,vj,data.origin);
 
-        int eid = data.m0.edge_id(*i,*j);
+        int eid = data.m0.edge_id(vi,vj);
         assert(eid>=0);
         data.m0.edge_data(eid).flags[MARKED] = true;
     }
-    data.front.push_back(*border.rbegin());
-    data.front.push_back(*border.begin());
-    data.m1.poly_add(*border.rbegin(),*border.begin(), data.origin);
-    int eid = data.m0.edge_id(*border.rbegin(), *border.begin());
-    assert(eid>=0);
-    data.m0.edge_data(eid).flags[MARKED] = true;
+    front_init(data);
 
     data.m1.edge_mark_boundaries();
 
@@ -41,6 +41,9 @@
 #include <cinolib/meshes/drawable_trimesh.h>
 #include <cinolib/rationals.h>
 #include <cinolib/profiler.h>
+#include <set>
+#include <tuple>
+#include <unordered_map>
 
 namespace cinolib
 {
@@ -62,11 +65,29 @@ namespace cinolib
  * of a finite number of steps. See the dedicated example (#47) in cinolib/examples.
 */
 
+/* Front of the advancing front map. Each front edge is stored once, indexed by its
+ * endpoints (so that it survives the edge re-numbering caused by mesh refinement),
+ * and sorted by the estimated cost of the move it triggers. For each triangle of m0
+ * the number of incident front edges is kept up to date as the front advances, so
+ * that moves can be classified without inspecting edge flags (see AFM/front.h)
+*/
+struct AFM_front
+{
+    std::set<std::tuple<uint,uint,uint64_t>>          queue;            // (cost, insertion stamp, edge key)
+    std::unordered_map<uint64_t,std::pair<uint,uint>> index;            // edge key => (cost, stamp) of its entry in the queue
+    std::vector<uint8_t>                              poly_front_edges; // number of front edges incident to each triangle of m0
+    std::vector<uint64_t>                             dirty;            // edges whose entry in the queue must be refreshed
+    std::vector<uint64_t>                             postponed;        // edges whose move failed, retried when the queue empties
+    uint                                              retry_moves = 0;  // value of moves_tot at the last retry of postponed edges
+    uint                                              stamp = 0;        // insertion counter (FIFO order among moves with same cost)
+    uint                                              peak  = 0;        // max front size reached during execution
+};
+
 struct AFM_data
 {
     DrawableTrimesh<>   m0;                     // input mesh. May be refined during map generation
     DrawableTrimesh<>   m1;                     // output mesh of the target domain, same connectivity as m0
-    std::deque<uint>    front;                  // serialized front edges
+    AFM_front           front;                  // current front (edges of m0 flagged as MARKED)
     int                 target_domain = CIRCLE; // CIRCLE, SQUARE, STAR
     uint                origin;                 // id of the vertex selected as the origin of the front
     bool                initialized = false;    // true if m1 has already been initialized
@@ -80,6 +101,7 @@ struct AFM_data
     int      step_size            = 1;     // moves for each step
     bool     stop                 = false; // if set to true, stops after current iteration (for debug)
     bool     refinement_enabled   = true;  // permit input mesh refinement to unlock deadlocks with convexification and concavification
+    bool     cheap_moves_first    = true;  // process edge flips that close the front before vertex splits that grow it (FIFO otherwise)
     bool     abort_if_too_slow    = true;  // stop execution if a moves takes more than max_time_per_step
     double   max_time_per_step    = 2;     // seconds
 
@@ -90,6 +112,8 @@ struct AFM_data
     uint  moves_tot = 0;
     uint  moves_split = 0;
     uint  moves_flip = 0;
+    uint  moves_failed = 0;      // front edges popped without advancing the front
+    float moves_per_sec = 0;
     uint  convexifications = 0;
     uint  concavifications = 0;
     bool  converged = false;
@@ -38,6 +38,7 @@
 #include <cinolib/AFM/convexification.h>
 #include <cinolib/AFM/concavification.h>
 #include <cinolib/AFM/snap_rounding.h>
+#include <cinolib/AFM/front.h>
 
 namespace cinolib
 {
@@ -85,7 +86,7 @@ bool advance_by_triangle_split(      AFM_data & data,
                                  CGAL::to_double(V2[2]));
     }
     uint new_pid = data.m1.poly_add(v0,v1,v2);
-    data.m1.poly_data(new_pid).color = data.conquered_color;
+    data.m1.poly_color(new_pid) = data.conquered_color;
     data.m1.poly_add(v0,v2,data.origin);
     data.m1.poly_add(v1,data.origin,v2);
     if(update_split_point_coords) snap_rounding(data,v2); // do not snap if the point was already CAREFULLY placed (i.e. during concavification)!
@@ -98,11 +99,12 @@ bool advance_by_triangle_split(      AFM_data & data,
     // update m0 flags
     data.m0.vert_data(v2).flags[MARKED]  = true;
     data.m0.poly_data(pid).flags[MARKED] = true;
-    data.m0.poly_data(pid).color = data.conquered_color;
+    data.m0.poly_color(pid) = data.conquered_color;
+    // (edges v0-v2 and v1-v2 enter the front, v0-v1 leaves it)
     for(uint eid : data.m0.adj_p2e(pid))
     {
-        data.m0.edge_data(eid).flags[MARKED] = (!data.m0.edge_contains_vert(eid,v0) ||
-                                                !data.m0.edge_contains_vert(eid,v1));
+        front_set(data, eid, (!data.m0.edge_contains_vert(eid,v0) ||
+                              !data.m0.edge_contains_vert(eid,v1)));
     }
     // update m1 flags
     int e0 = data.m1.edge_id(v0,v1); assert(e0>=0);
@@ -111,11 +113,6 @@ bool advance_by_triangle_split(      AFM_data & data,
     data.m1.edge_data(e0).flags[MARKED] = false;
     data.m1.edge_data(e1).flags[MARKED] = true;
     data.m1.edge_data(e2).flags[MARKED] = true;
-    // add edges v0-v2 and v1-v2 to the front
-    data.front.push_back(v0);
-    data.front.push_back(v2);
-    data.front.push_back(v1);
-    data.front.push_back(v2);
 
     /////// POSTCONDITIONS ///////
 
@@ -227,15 +224,15 @@ bool advance_by_edge_flip(AFM_data & data, const uint pid)
     assert(err>=0);
     int new_pid = data.m1.poly_id({v0,v1,v2});
     assert(new_pid>=0);
-    data.m1.poly_data(new_pid).color = data.conquered_color;
+    data.m1.poly_color(new_pid) = data.conquered_color;
 
     /////// UPDATE FRONT FLAGS ///////
 
     // update m0 flags
-    for(uint eid : data.m0.adj_p2e(pid)) data.m0.edge_data(eid).flags[MARKED] = false;
-    data.m0.edge_data(e_front).flags[MARKED] = true;
+    // (edge v0-v1 enters the front, the other two leave it)
     data.m0.poly_data(pid).flags[MARKED] = true;
-    data.m0.poly_data(pid).color = data.conquered_color;
+    for(uint eid : data.m0.adj_p2e(pid)) front_set(data, eid, eid==e_front);
+    data.m0.poly_color(pid) = data.conquered_color;
     // update m1 flags
     int e0 = data.m1.edge_id(v0,v1); assert(e0>=0);
     int e1 = data.m1.edge_id(v1,v2); assert(e1>=0);
@@ -243,9 +240,6 @@ bool advance_by_edge_flip(AFM_data & data, const uint pid)
     data.m1.edge_data(e0).flags[MARKED] = true;
     data.m1.edge_data(e1).flags[MARKED] = false;
     data.m1.edge_data(e2).flags[MARKED] = false;
-    // add new front edge
-    data.front.push_back(v0);
-    data.front.push_back(v1);
 
     if(had_convexified)
     {
@@ -35,6 +35,7 @@
 *********************************************************************************/
 #include <cinolib/AFM/concavification.h>
 #include <cinolib/AFM/flip_checks.h>
+#include <cinolib/AFM/front.h>
 #include <cinolib/AFM/snap_rounding.h>
 #include <cinolib/geometry/segment_utils.h>
 
@@ -71,9 +72,9 @@ uint concavify_front(AFM_data & data,
     // if the next flip is concave, just focus on this one
     // (the next will be made valid by the convexification routine)
 
-    auto res = orient2d(&data.exact_coords[3*v0],
-                        &data.exact_coords[3*v2],
-                        &data.exact_coords[3*v3]);
+    int res = orient2d_sign(&data.exact_coords[3*v0],
+                            &data.exact_coords[3*v2],
+                            &data.exact_coords[3*v3]);
     if(res==0 || (res<0) == CCW || v3==data.origin)
     {
         CGAL_Q A[3] =
@@ -118,8 +119,8 @@ uint concavify_front(AFM_data & data,
                             &data.exact_coords[3*v0],
                             &data.exact_coords[3*v2], B);
         // if B does not lie in between v0 and v2, set B as v2
-        if(orient2d(&data.exact_coords[3*v0],B,&data.exact_coords[3*data.origin]) *
-           orient2d(B,&data.exact_coords[3*v2],&data.exact_coords[3*data.origin])<=0)
+        if(orient2d_sign(&data.exact_coords[3*v0],B,&data.exact_coords[3*data.origin]) *
+           orient2d_sign(B,&data.exact_coords[3*v2],&data.exact_coords[3*data.origin])<=0)
         {
             B[0] = data.exact_coords[3*v2+0];
             B[1] = data.exact_coords[3*v2+1];
@@ -162,7 +163,7 @@ uint concavify_front(AFM_data & data,
 
     int eid = data.m0.edge_id(v0,v1);
     assert(eid>=0);
-    uint vid = data.m0.edge_split(eid);
+    uint vid = front_edge_split(data,eid);
     assert(vid==split_point_id);
 
     return split_point_id;
@@ -35,6 +35,7 @@
 *********************************************************************************/
 #include <cinolib/AFM/convexification.h>
 #include <cinolib/AFM/flip_checks.h>
+#include <cinolib/AFM/front.h>
 #include <cinolib/AFM/snap_rounding.h>
 #include <cinolib/geometry/segment_utils.h>
 
@@ -122,9 +123,9 @@ bool triangle_is_blocking(AFM_data & data,
 
     // it the positive half space of the edge opposite to front_vert
     // does not contain the new_pos, the triangle is blocking
-    if(orient2d(&data.exact_coords[3*v0],
-                &data.exact_coords[3*v1],
-                p)<=0) return true;
+    if(orient2d_sign(&data.exact_coords[3*v0],
+                     &data.exact_coords[3*v1],
+                     p)<=0) return true;
     return false;
 }
 
@@ -192,7 +193,7 @@ void unlock_by_edge_split(AFM_data & data,
                     CGAL::to_double(pp[1]),
                     CGAL::to_double(pp[2]));
 
-    data.m0.edge_split(data.m0.edge_id(vid,e[off]), 0.5); // just split at the midpoint in the input mesh...
+    front_edge_split(data, data.m0.edge_id(vid,e[off]), 0.5); // just split at the midpoint in the input mesh...
     data.m1.edge_split(data.m1.edge_id(vid,e[off]), p);
     snap_rounding(data,data.exact_coords.size()/3-1);
 }
@@ -36,6 +36,9 @@
 #include <cinolib/AFM/flip_checks.h>
 #include <cinolib/rationals.h>
 #include <cinolib/predicates.h>
+#include <cinolib/predicates_batched.h>
+#include <cinolib/filtered_predicates.h>
+#include <cinolib/vector_serialization.h>
 
 namespace cinolib
 {
@@ -46,9 +49,9 @@ bool flipped(AFM_data & data,
              const uint b,
              const uint c)
 {
-    return orient2d(&data.exact_coords[3*a],
-                    &data.exact_coords[3*b],
-                    &data.exact_coords[3*c]) <= 0;
+    return orient2d_sign(&data.exact_coords[3*a],
+                         &data.exact_coords[3*b],
+                         &data.exact_coords[3*c]) <= 0;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -58,9 +61,9 @@ bool flipped(AFM_data & data, const uint pid, const bool use_rationals)
 {
     if(use_rationals)
     {
-        return orient2d(&data.exact_coords[3*data.m1.poly_vert_id(pid,0)],
-                        &data.exact_coords[3*data.m1.poly_vert_id(pid,1)],
-                        &data.exact_coords[3*data.m1.poly_vert_id(pid,2)]) <= 0;
+        return orient2d_sign(&data.exact_coords[3*data.m1.poly_vert_id(pid,0)],
+                             &data.exact_coords[3*data.m1.poly_vert_id(pid,1)],
+                             &data.exact_coords[3*data.m1.poly_vert_id(pid,2)]) <= 0;
     }
     return orient2d(data.m1.poly_vert(pid,0).ptr(),
                     data.m1.poly_vert(pid,1).ptr(),
@@ -73,10 +76,29 @@ CINO_INLINE
 uint count_flipped(AFM_data & data, const bool use_rationals)
 {
     uint count = 0;
-    for(uint pid=0; pid<data.m1.num_polys(); ++pid)
+    if(!use_rationals)
     {
-        if(flipped(data,pid,use_rationals)) ++count;
+        // gather all triangles and evaluate their orientation as a single filtered batch
+        uint np = data.m1.num_polys();
+        std::vector<double> abc(9*np);
+        for(uint pid=0; pid<np; ++pid)
+        {
+            for(uint i=0; i<3; ++i)
+            {
+                const vec3d & p = data.m1.poly_vert(pid,i);
+                std::copy(p.ptr(), p.ptr()+3, abc.begin()+9*pid+3*i);
+            }
+        }
+        std::vector<double> res(np);
+        orient2d_batch(abc.data(), 9, abc.data()+3, 9, abc.data()+6, 9, np, res.data());
+        for(double o : res) if(o<=0) ++count;
+        return count;
     }
+    // rational coordinates: filtered batch (exact arithmetic only for uncertain cases)
+    std::vector<uint> tris = serialized_vids_from_polys(data.m1.vector_polys());
+    std::vector<int>  res(data.m1.num_polys());
+    orient2d_sign_batch(data.exact_coords.data(), 3, tris.data(), data.m1.num_polys(), res.data());
+    for(int o : res) if(o<=0) ++count;
     return count;
 }
 
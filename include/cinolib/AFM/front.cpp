@@ -0,0 +1,220 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/AFM/front.h>
+
+namespace cinolib
+{
+
+CINO_INLINE
+uint64_t front_key(const uint v0, const uint v1)
+{
+    return (v0<v1) ? (uint64_t(v0)<<32 | v1) : (uint64_t(v1)<<32 | v0);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// edge flips close the front locally and do not introduce new vertices, hence they
+// are processed before vertex splits. Moves with the same cost are processed FIFO
+CINO_INLINE
+uint front_move_cost(const AFM_data & data, const uint pid)
+{
+    if(!data.cheap_moves_first) return 0;
+    return (data.front.poly_front_edges.at(pid)>=2) ? 0 : 1;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+int front_target_poly(const AFM_data & data, const uint eid)
+{
+    for(uint pid : data.m0.adj_e2p(eid))
+    {
+        if(!data.m0.poly_data(pid).flags[MARKED]) return pid;
+    }
+    return -1;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void front_init(AFM_data & data)
+{
+    AFM_front & f = data.front;
+    f.queue.clear();
+    f.index.clear();
+    f.dirty.clear();
+    f.postponed.clear();
+    f.retry_moves = data.moves_tot;
+    f.stamp = 0;
+    f.peak  = 0;
+    f.poly_front_edges.assign(data.m0.num_polys(),0);
+
+    for(uint eid=0; eid<data.m0.num_edges(); ++eid)
+    {
+        if(!data.m0.edge_data(eid).flags[MARKED]) continue;
+        for(uint pid : data.m0.adj_e2p(eid)) ++f.poly_front_edges.at(pid);
+        f.dirty.push_back(front_key(data.m0.edge_vert_id(eid,0), data.m0.edge_vert_id(eid,1)));
+    }
+    front_update(data);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void front_set(AFM_data & data, const uint eid, const bool in_front)
+{
+    if(data.m0.edge_data(eid).flags[MARKED]==in_front) return;
+    data.m0.edge_data(eid).flags[MARKED] = in_front;
+
+    // the cost of all the front edges of the adjacent triangles may have changed
+    AFM_front & f = data.front;
+    for(uint pid : data.m0.adj_e2p(eid))
+    {
+        if(in_front) ++f.poly_front_edges.at(pid);
+        else         --f.poly_front_edges.at(pid);
+
+        for(uint e : data.m0.adj_p2e(pid))
+        {
+            f.dirty.push_back(front_key(data.m0.edge_vert_id(e,0), data.m0.edge_vert_id(e,1)));
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint front_edge_split(AFM_data & data, const uint eid, const double lambda)
+{
+    AFM_front & f = data.front;
+    f.dirty.push_back(front_key(data.m0.edge_vert_id(eid,0), data.m0.edge_vert_id(eid,1)));
+
+    // the split removes the triangles incident to eid, moving the last (new) triangles
+    // in their slots. All triangles with a new or changed id are therefore incident to
+    // the split point, and have their front edge count recomputed from scratch
+    uint vid = data.m0.edge_split(eid,lambda);
+    f.poly_front_edges.resize(data.m0.num_polys());
+    for(uint pid : data.m0.adj_v2p(vid))
+    {
+        uint count = 0;
+        for(uint e : data.m0.adj_p2e(pid))
+        {
+            count += data.m0.edge_data(e).flags[MARKED];
+            f.dirty.push_back(front_key(data.m0.edge_vert_id(e,0), data.m0.edge_vert_id(e,1)));
+        }
+        f.poly_front_edges.at(pid) = count;
+    }
+    return vid;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void front_update(AFM_data & data)
+{
+    AFM_front & f = data.front;
+    for(uint64_t key : f.dirty)
+    {
+        auto it  = f.index.find(key);
+        int  eid = data.m0.edge_id(uint(key>>32), uint(key & 0xffffffff));
+        int  pid = (eid>=0 && data.m0.edge_data(eid).flags[MARKED]) ? front_target_poly(data,eid) : -1;
+
+        if(pid<0) // not (or no longer) a front edge
+        {
+            if(it!=f.index.end())
+            {
+                f.queue.erase(std::make_tuple(it->second.first, it->second.second, key));
+                f.index.erase(it);
+            }
+            continue;
+        }
+
+        uint cost = front_move_cost(data,pid);
+        if(it!=f.index.end())
+        {
+            if(it->second.first==cost) continue; // preserve its position in the queue
+            f.queue.erase(std::make_tuple(it->second.first, it->second.second, key));
+        }
+        f.index[key] = std::make_pair(cost, f.stamp);
+        f.queue.insert(std::make_tuple(cost, f.stamp, key));
+        ++f.stamp;
+    }
+    f.dirty.clear();
+    f.peak = std::max(f.peak, uint(f.index.size()));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void front_postpone(AFM_data & data, const uint v0, const uint v1)
+{
+    data.front.postponed.push_back(front_key(v0,v1));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool front_pop(AFM_data & data, uint & v0, uint & v1, uint & pid)
+{
+    front_update(data);
+
+    AFM_front & f = data.front;
+    while(true)
+    {
+        if(f.queue.empty())
+        {
+            if(f.postponed.empty() || data.moves_tot==f.retry_moves) return false;
+            f.retry_moves = data.moves_tot;
+            f.dirty.swap(f.postponed);
+            front_update(data);
+            continue;
+        }
+
+        uint64_t key = std::get<2>(*f.queue.begin());
+        f.queue.erase(f.queue.begin());
+        f.index.erase(key);
+
+        v0 = uint(key>>32);
+        v1 = uint(key & 0xffffffff);
+        int eid = data.m0.edge_id(v0,v1);
+        if(eid<0 || !data.m0.edge_data(eid).flags[MARKED]) continue;
+        int target = front_target_poly(data,eid);
+        if(target<0) continue;
+        pid = target;
+        return true;
+    }
+}
+
+}
@@ -0,0 +1,105 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_AFM_FRONT_H
+#define CINO_AFM_FRONT_H
+
+#include <cinolib/AFM/AFM.h>
+
+namespace cinolib
+{
+
+// key of edge v0-v1 in the front (independent of the edge orientation)
+CINO_INLINE
+uint64_t front_key(const uint v0, const uint v1);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// estimated cost of the move that conquers triangle pid (lower costs are processed first)
+CINO_INLINE
+uint front_move_cost(const AFM_data & data, const uint pid);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// triangle adjacent to front edge eid that was not conquered yet (-1 if none)
+CINO_INLINE
+int front_target_poly(const AFM_data & data, const uint eid);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// initialize the front with the edges of m0 currently flagged as MARKED
+CINO_INLINE
+void front_init(AFM_data & data);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// add/remove edge eid of m0 to/from the front, updating the front edge count of its triangles.
+// Changes are not reflected in the priority queue until the next call to front_update
+CINO_INLINE
+void front_set(AFM_data & data, const uint eid, const bool in_front);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// split edge eid of m0, keeping the front edge counts consistent with the new triangles
+CINO_INLINE
+uint front_edge_split(AFM_data & data, const uint eid, const double lambda = 0.5);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// refresh the entries of the priority queue that were affected by the last moves
+CINO_INLINE
+void front_update(AFM_data & data);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// postpone front edge v0-v1, whose move failed. Postponed edges are re-inserted in the queue when
+// it empties, as long as some move succeeded in the meanwhile (i.e. their neighborhood may have changed)
+CINO_INLINE
+void front_postpone(AFM_data & data, const uint v0, const uint v1);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// pop the cheapest front edge v0-v1 and the triangle pid (w.r.t. m0) it has to conquer.
+// Returns false if the front is empty (or only contains edges that cannot advance)
+CINO_INLINE
+bool front_pop(AFM_data & data, uint & v0, uint & v1, uint & pid);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "front.cpp"
+#endif
+
+#endif // CINO_AFM_FRONT_H
@@ -34,8 +34,6 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/ARAP.h>
-#include <cinolib/parallel_for.h>
-#include <cinolib/laplacian.h>
 
 namespace cinolib
 {
@@ -44,198 +42,94 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void ARAP(AbstractMesh<M,V,E,P> & m, ARAP_data & data)
 {
-    /////////////////////////////////////////////////////////////////////////
+    assert(m.mesh_type()==TRIMESH || m.mesh_type()==TETMESH);
 
-    auto init = [&]()
-    {
-        assert(m.mesh_type()==TRIMESH || m.mesh_type()==TETMESH);
+    uint nv = m.num_verts();
+    uint nh = data.handles.size();
 
+    if(data.init)
+    {
         data.init = false;
 
-        data.R.resize(m.num_verts());
-        data.xyz_ref = m.vector_verts();
-
-        data.w.resize(m.num_edges());
-        for(uint eid=0; eid<m.num_edges(); ++eid)
+        // one group of terms per vertex, one term per incident edge.
+        // Each edge appears in the groups of both its endpoints, hence
+        // weights are halved (the global step then solves L*x = b, with
+        // L the graph Laplacian, and b_i = sum_j w_ij/2 (R_i+R_j) e_ij)
+        std::vector<uint> g_off(1,0);
+        std::vector<ARAPSolver<3>::Term> terms;
+        for(uint vid=0; vid<nv; ++vid)
         {
-            data.w.at(eid) = m.edge_weight(eid,data.w_type);
+            for(uint eid : m.adj_v2e(vid))
+            {
+                uint nbr = m.vert_opposite_to(eid,vid);
+                terms.push_back({vid, nbr, 0.5*m.edge_weight(eid,data.w_type), m.vert(vid)-m.vert(nbr)});
+            }
+            g_off.push_back(terms.size());
         }
+        data.solver.set_terms(nv, g_off, terms);
 
         // compute a map between matrix columns and mesh vertices
         // if hard constraints are used, boundary conditions will
         // map to -1, meaning that they do not correspond to any
         // column in the matrix
-        data.col_map.assign(m.num_verts(),0);
+        std::vector<int> col_map(nv,0);
         if(data.hard_constrain_handles)
         {
-            for(uint vid : data.handles)
-            {
-                data.col_map.at(vid) = -1;
-            }
-        }
-        uint fresh_id = 0;
-        for(uint vid=0; vid<m.num_verts(); ++vid)
-        {
-            if(data.col_map.at(vid)==0)
-            {
-                data.col_map.at(vid) = fresh_id++;
-            }
+            for(uint vid : data.handles) col_map.at(vid) = -1;
         }
-
-        uint nv = m.num_verts();
-        uint nh = data.handles.size();
-        std::vector<Eigen::Triplet<double>> entries;
-        for(uint vid=0; vid<m.num_verts(); ++vid)
+        int fresh_id = 0;
+        for(uint vid=0; vid<nv; ++vid)
         {
-            if(data.col_map.at(vid)<0) continue;
-            double diag = 0;
-            for(uint nbr : m.adj_v2v(vid))
-            {
-                int eid = m.edge_id(vid,nbr);
-                diag += data.w.at(eid);
-                if(data.col_map.at(nbr)<0) continue;
-                entries.emplace_back(data.col_map.at(vid), data.col_map.at(nbr), -data.w.at(eid));
-            }
-            entries.emplace_back(data.col_map.at(vid), data.col_map.at(vid), diag);
+            if(col_map.at(vid)==0) col_map.at(vid) = fresh_id++;
         }
+        data.solver.set_col_map(col_map);
 
+        Eigen::SparseMatrix<double> L = data.solver.stiffness_matrix();
         if(data.hard_constrain_handles)
         {
-            data.A.resize(nv-nh,nv-nh);
-            data.A.setFromTriplets(entries.begin(), entries.end());
-            data.cache.derived().compute(data.A);
+            data.solver.rhs_map.resize(0,0);
+            data.solver.factorize(L);
         }
         else
         {
-            // append soft constraint equations for handles
-            uint off = 0;
-            for(uint vid : data.handles)
-            {
-                assert(vid>=0);
-                entries.emplace_back(nv+off,vid,1.0);
-                off++;
-            }
-            data.A.resize(nv+nh,nv);
-            data.A.setFromTriplets(entries.begin(), entries.end());
-            data.cache.derived().compute(data.A.transpose()*data.A);
+            // least squares: the Laplacian equations L*x = b, plus
+            // one soft constraint equation x_h = h for each handle
+            std::vector<Eigen::Triplet<double>> entries;
+            for(uint i=0; i<nh; ++i) entries.emplace_back(i, data.handles.at(i), 1.0);
+            Eigen::SparseMatrix<double> C(nh,nv);
+            C.setFromTriplets(entries.begin(), entries.end());
+            data.solver.rhs_map = L.transpose();
+            data.solver.factorize(L.transpose()*L + C.transpose()*C);
         }
-    };
-
-    /////////////////////////////////////////////////////////////////////////
-
-    auto local_step = [&]()
-    {
-        PARALLEL_FOR(0, m.num_verts(), 1000, [&](uint vid)
-        {
-            mat3d cov = mat3d::ZERO();
-            for(uint nbr : m.adj_v2v(vid))
-            {
-                int   eid   = m.edge_id(vid,nbr);
-                vec3d e_ref = (data.xyz_ref.at(vid) - data.xyz_ref.at(nbr));
-                vec3d e_cur = (m.vert(vid) - m.vert(nbr));
-
-                cov += data.w.at(eid) * (e_cur * e_ref.transpose());
-            }
-
-            mat3d UU,VV;
-            vec3d S;
-            cov.SVD(UU,S,VV);
-            mat3d I = mat3d::DIAG(1);
-            I(2,2) = (UU*VV.transpose()).det();
-            data.R.at(vid) = UU*I*VV.transpose();
-        });
-    };
+    }
 
-    /////////////////////////////////////////////////////////////////////////
+    // warm start from the current configuration
+    std::vector<vec3d> & x = data.solver.verts();
+    for(uint vid=0; vid<nv; ++vid) x.at(vid) = m.vert(vid);
 
-    auto global_step = [&]()
+    // handles may have moved since the last call
+    if(data.hard_constrain_handles)
     {
-        uint nv   = m.num_verts();
-        uint nh   = data.handles.size();
-        uint size = (data.hard_constrain_handles) ? nv-nh : nv+nh;
-
-        Eigen::VectorXd rhs_x(size);
-        Eigen::VectorXd rhs_y(size);
-        Eigen::VectorXd rhs_z(size);
-
-        for(uint vid=0; vid<m.num_verts(); ++vid)
+        for(uint vid : data.handles)
         {
-            if(data.col_map.at(vid)<0) continue;
-
-            vec3d rhs(0,0,0);
-            for(uint nbr : m.adj_v2v(vid))
-            {
-                mat3d Ravg = (data.R.at(vid)+data.R.at(nbr))/2.0;
-                vec3d e    = (data.xyz_ref.at(vid) - data.xyz_ref.at(nbr));
-                int eid    = m.edge_id(vid,nbr);
-
-                rhs += data.w.at(eid) * Ravg * e;
-
-                if(data.col_map.at(nbr)<0)
-                {
-                    rhs += data.w.at(eid) * vec3d(data.handles_x.at(nbr),
-                                                  data.handles_y.at(nbr),
-                                                  data.handles_z.at(nbr));
-                }
-            }
-            rhs_x[data.col_map.at(vid)] = rhs.x();
-            rhs_y[data.col_map.at(vid)] = rhs.y();
-            rhs_z[data.col_map.at(vid)] = rhs.z();
-        }
-
-        Eigen::VectorXd x,y,z;
-        if(data.hard_constrain_handles)
-        {
-            x = data.cache.solve(rhs_x).eval();
-            y = data.cache.solve(rhs_y).eval();
-            z = data.cache.solve(rhs_z).eval();
-
-            for(uint vid=0; vid<m.num_verts(); ++vid)
-            {
-                if(data.col_map.at(vid)<0) continue;
-                m.vert(vid) = vec3d(x[data.col_map.at(vid)],
-                                    y[data.col_map.at(vid)],
-                                    z[data.col_map.at(vid)]);
-            }
-            for(uint vid : data.handles)
-            {
-                m.vert(vid) = vec3d(data.handles_x.at(vid),
-                                    data.handles_y.at(vid),
-                                    data.handles_z.at(vid));
-            }
+            x.at(vid) = vec3d(data.handles_x.at(vid), data.handles_y.at(vid), data.handles_z.at(vid));
         }
-        else
+        data.solver.rhs_bias.resize(0,0);
+    }
+    else
+    {
+        data.solver.rhs_bias = Eigen::MatrixXd::Zero(nv,3);
+        for(uint vid : data.handles)
         {
-            uint off = 0;
-            for(uint vid : data.handles)
-            {
-                rhs_x[nv+off] = data.handles_x.at(vid);
-                rhs_y[nv+off] = data.handles_y.at(vid);
-                rhs_z[nv+off] = data.handles_z.at(vid);
-                ++off;
-            }
-            x = data.cache.solve(data.A.transpose()*rhs_x).eval();
-            y = data.cache.solve(data.A.transpose()*rhs_y).eval();
-            z = data.cache.solve(data.A.transpose()*rhs_z).eval();
-
-            for(uint vid=0; vid<m.num_verts(); ++vid)
-            {
-                m.vert(vid) = vec3d(x[vid],y[vid],z[vid]);
-            }
+            data.solver.rhs_bias(vid,0) += data.handles_x.at(vid);
+            data.solver.rhs_bias(vid,1) += data.handles_y.at(vid);
+            data.solver.rhs_bias(vid,2) += data.handles_z.at(vid);
         }
-    };
-
-    //////////////////////////////////////////////////////////////////////////
-    ////////////////////////// ACTUAL ALGORITHM //////////////////////////////
-    //////////////////////////////////////////////////////////////////////////
+    }
 
-    if(data.init) init();
+    data.solver.iterate(data.n_iters, data.anderson_window);
 
-    for(uint i=0; i<data.n_iters; ++i)
-    {
-        local_step();
-        global_step();
-    }
+    for(uint vid=0; vid<nv; ++vid) m.vert(vid) = x.at(vid);
     m.update_normals();
 }
 
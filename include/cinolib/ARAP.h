@@ -37,7 +37,7 @@
 #define CINO_ARAP_H
 
 #include <cinolib/meshes/abstract_mesh.h>
-#include <cinolib/linear_solvers.h>
+#include <cinolib/ARAP_solver.h>
 
 namespace cinolib
 {
@@ -47,6 +47,12 @@ namespace cinolib
  *   As-Rigid-As-Possible Surface Modeling
  *   Olga Sorkine-Hornung, Marc Alexa
  *   Eurographics Symposium on Geometry Processing 2007
+ *
+ * Local and global steps are performed by ARAPSolver (see ARAP_solver.h),
+ * with one rotation per vertex. Setting anderson_window > 0 enables Anderson
+ * acceleration, which typically reaches the same energy in fewer iterations.
+ * Acceleration only applies to hard constrained handles: with soft handles
+ * the global step is a least squares problem, and anderson_window is ignored.
 */
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -56,15 +62,11 @@ struct ARAP_data
     uint n_iters = 4;
     bool init = true; // initialize just once (useful for multiple calls, e.g. to make more iterations)
 
-    std::vector<mat3d> R;       // local (per vertex) rotation matrices
-    std::vector<vec3d> xyz_ref; // reference (original) vertex positions
+    uint anderson_window = 0; // Anderson acceleration (0 => off)
 
-    // edge weights
-    std::vector<double> w;
-    int w_type = UNIFORM; // { UNIFORM, COTANGENT }
+    int w_type = UNIFORM; // edge weights { UNIFORM, COTANGENT }
 
-    Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> cache; // factorized matrix
-    Eigen::SparseMatrix<double> A; // a copy of the matrix (to be pre-multiplied to the rhs to form the normal equations)
+    ARAPSolver<3> solver; // factorized matrix, reference edges and per vertex rotations
 
     // deformation handles, separated for x,y,z coords to make solver call easier
     std::vector<uint>     handles;
@@ -73,7 +75,6 @@ struct ARAP_data
     std::map<uint,double> handles_z;
 
     bool hard_constrain_handles = false;
-    std::vector<int> col_map; // column map (to handle hard constrainted handles)
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -34,7 +34,6 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/ARAP_2D_map.h>
-#include <cinolib/parallel_for.h>
 #include <cinolib/tangent_space.h>
 #include <cinolib/lscm.h>
 
@@ -45,134 +44,63 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void ARAP_2D_mapping(Trimesh<M,V,E,P> & m, ARAP_2D_map_data & data)
 {
-    uint bc = m.num_verts()-1;
+    uint nv = m.num_verts();
+    uint bc = nv-1;
 
-    auto init = [&]()
+    if(data.init)
     {
         data.init = false; // don't init next time
 
-        data.uv_ref.resize(m.num_polys()*3);
-        data.uv_loc.resize(m.num_polys()*3);
-        data.uv_out.resize(m.num_verts());
-
-        // compute reference local uv coords
+        // one group of terms per triangle, one term per triangle edge, with
+        // reference edges taken from the triangle flattened in its own frame
+        std::vector<uint> g_off(1,0);
+        std::vector<ARAPSolver<2>::Term> terms;
         for(uint pid=0; pid<m.num_polys(); ++pid)
         {
-            uint off = pid*3;
+            vec2d uv_ref[3];
             tangent_space_2d_coords(m.poly_vert(pid,0),
                                     m.poly_vert(pid,1),
                                     m.poly_vert(pid,2),
-                                    data.uv_ref.at(off),
-                                    data.uv_ref.at(off+1),
-                                    data.uv_ref.at(off+2));
-        }
-
-        // warm start current global uv's with some mapping
-        ScalarField f = LSCM(m);
-        uint nv = m.num_verts();
-        for(uint vid=0; vid<nv; ++vid)
-        {
-            data.uv_out.at(vid) = vec2d(f[vid], f[vid+nv]);
-        }
-
-        // per edge weights
-        data.w.resize(m.num_edges());
-        for(uint eid=0; eid<m.num_edges(); ++eid)
-        {
-            data.w.at(eid) = m.edge_weight(eid,COTANGENT);
-        }
-
-        // Pre-factorize Laplacian matrix.
-        // The Laplacian matrix is VxV, and has rank V-1. For simplicity,
-        // I am fixing the uv coords of the last vertex to (0,0). This
-        // allows to work on a full rank matrix, and also to keep a direct
-        // correspondence between rows/cols in the matrix and vertex ids
-        typedef Eigen::Triplet<double> Entry;
-        std::vector<Entry> entries;
-        for(uint vid=0; vid<m.num_verts()-1; ++vid)
-        {
-            for(uint nbr : m.adj_v2v(vid))
-            {
-                int eid = m.edge_id(vid,nbr);
-                assert(eid>=0);
-                entries.push_back(Entry(vid, vid,  data.w.at(eid)));
-                if(nbr!=bc) entries.push_back(Entry(vid, nbr, -data.w.at(eid)));
-            }
-        }
-        Eigen::SparseMatrix<double> A(m.num_verts()-1, m.num_verts()-1);
-        A.setFromTriplets(entries.begin(), entries.end());
-        data.cache.derived().compute(A);
-    };
-
-    auto local_step = [&]()
-    {
-        PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
-        {
-            // per triangle covariance matrix
-            uint off = 3*pid;
-            mat2d cov = mat2d::ZERO();
-            for(int i=0; i<3; ++i)
+                                    uv_ref[0], uv_ref[1], uv_ref[2]);
+            for(uint i=0; i<3; ++i)
             {
                 uint v0  = m.poly_vert_id(pid,i);
                 uint v1  = m.poly_vert_id(pid,(i+1)%3);
                 int  eid = m.edge_id(v0,v1);
                 assert(eid>=0);
-                vec2d e_cur = data.uv_out.at(v0)    - data.uv_out.at(v1);
-                vec2d e_ref = data.uv_ref.at(off+i) - data.uv_ref.at(off+((i+1)%3));
-                cov += data.w.at(eid) * (e_cur * e_ref.transpose());
+                terms.push_back({v0, v1, m.edge_weight(eid,COTANGENT), uv_ref[i] - uv_ref[(i+1)%3]});
             }
+            g_off.push_back(terms.size());
+        }
+        data.solver.set_terms(nv, g_off, terms);
 
-            // find closest rotation and store rotated point
-            mat2d rot = cov.closest_orthogonal_matrix(true);
-            data.uv_loc.at(off  ) = rot * data.uv_ref.at(off  );
-            data.uv_loc.at(off+1) = rot * data.uv_ref.at(off+1);
-            data.uv_loc.at(off+2) = rot * data.uv_ref.at(off+2);
-        });
-    };
+        // The Laplacian matrix is VxV, and has rank V-1. For simplicity,
+        // I am fixing the uv coords of the last vertex to (0,0). This
+        // allows to work on a full rank matrix, and also to keep a direct
+        // correspondence between rows/cols in the matrix and vertex ids
+        std::vector<int> col_map(nv);
+        for(uint vid=0; vid<nv; ++vid) col_map.at(vid) = vid;
+        col_map.at(bc) = -1;
+        data.solver.set_col_map(col_map);
+        data.solver.factorize(data.solver.stiffness_matrix());
 
-    auto global_step = [&]()
-    {
-        Eigen::VectorXd rhs_u = Eigen::VectorXd::Zero(m.num_verts()-1);
-        Eigen::VectorXd rhs_v = Eigen::VectorXd::Zero(m.num_verts()-1);
-        for(uint vid=0; vid<m.num_verts()-1; ++vid)
-        {
-            for(uint nbr : m.adj_v2v(vid))
-            {
-                int eid = m.edge_id(vid,nbr);
-                for(uint pid : m.adj_e2p(eid))
-                {
-                    uint i = m.poly_vert_offset(pid,vid);
-                    uint j = m.poly_vert_offset(pid,nbr);
-                    assert(i>=0 && i<3);
-                    assert(j>=0 && j<3);
-                    vec2d Re = data.uv_loc.at(pid*3+i) - data.uv_loc.at(pid*3+j);
-                    rhs_u[vid] += data.w.at(eid) * Re[0];
-                    rhs_v[vid] += data.w.at(eid) * Re[1];
-                }
-            }
-        }
-        Eigen::VectorXd u = data.cache.solve(rhs_u);
-        Eigen::VectorXd v = data.cache.solve(rhs_v);
-        for(uint vid=0; vid<m.num_verts()-1; ++vid)
+        // warm start current global uv's with some mapping
+        // (translated so that the last vertex is at the origin)
+        ScalarField f = LSCM(m);
+        data.uv_out.resize(nv);
+        for(uint vid=0; vid<nv; ++vid)
         {
-            data.uv_out[vid] = vec2d(u[vid],v[vid]);
+            data.uv_out.at(vid) = vec2d(f[vid]-f[bc], f[vid+nv]-f[bc+nv]);
         }
-        data.uv_out[bc] = vec2d(0,0); // last vertex
-    };
-
-    //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
-
-    if(data.init) init();
-
-    for(uint i=0; i<data.n_iters; ++i)
-    {
-        local_step();
-        global_step();
     }
 
-    for(uint vid=0; vid<m.num_verts(); ++vid)
+    data.solver.verts() = data.uv_out;
+    data.solver.iterate(data.n_iters, data.anderson_window);
+    data.uv_out = data.solver.verts();
+
+    for(uint vid=0; vid<nv; ++vid)
     {
-        m.vert_data(vid).uvw = data.uv_out[vid].add_coord(0);
+        m.vert_uvw(vid) = data.uv_out[vid].add_coord(0);
     }
 }
 
@@ -37,7 +37,7 @@
 #define CINO_ARAP_2D_MAP_H
 
 #include <cinolib/meshes/trimesh.h>
-#include <cinolib/linear_solvers.h>
+#include <cinolib/ARAP_solver.h>
 
 namespace cinolib
 {
@@ -47,6 +47,10 @@ namespace cinolib
  *   A Local/Global Approach to Mesh Parameterization
  *   Ligang Liu, Lei Zhang, Yin Xu, Craig Gotsman and Steven J. Gortler
  *   Eurographics Symposium on Geometry Processing 2008
+ *
+ * Local and global steps are performed by ARAPSolver (see ARAP_solver.h),
+ * with one rotation per triangle. Setting anderson_window > 0 enables Anderson
+ * acceleration, which typically reaches the same energy in fewer iterations.
 */
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -56,12 +60,11 @@ struct ARAP_2D_map_data
     uint n_iters = 4;
     bool init    = true; // initialize just once (useful for multiple calls, e.g. to make more iterations)
 
-    std::vector<vec2d>  uv_out; // output uv coords
-    std::vector<vec2d>  uv_ref; // per triangle reference uv coords (w.r.t. a local frame)
-    std::vector<vec2d>  uv_loc; // per triangle uv targets (100% rigid)
-    std::vector<double> w;      // edge weights (cotangent)
+    uint anderson_window = 0; // Anderson acceleration (0 => off)
+
+    std::vector<vec2d> uv_out; // output uv coords
 
-    Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> cache; // factorized matrix
+    ARAPSolver<2> solver; // factorized matrix, reference edges and per triangle rotations
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
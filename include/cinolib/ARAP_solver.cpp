@@ -0,0 +1,269 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/ARAP_solver.h>
+#include <cinolib/anderson_acceleration.h>
+#include <cinolib/parallel_for.h>
+#include <cinolib/min_max_inf.h>
+
+namespace cinolib
+{
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::set_terms(const uint                n_verts,
+                              const std::vector<uint> & g_off,
+                              const std::vector<Term> & terms)
+{
+    assert(!g_off.empty() && g_off.back()==terms.size());
+
+    this->g_off = g_off;
+    g_terms.resize(terms.size());
+    for(uint i=0; i<terms.size(); ++i)
+    {
+        const Term & t = terms.at(i);
+        assert(t.a<n_verts && t.b<n_verts);
+        g_terms.at(i) = { t.a, t.b, t.w, t.w*t.e_ref, t.w*t.e_ref.dot(t.e_ref) };
+    }
+    x.resize(n_verts);
+    R.assign(num_groups(), matd::DIAG(1));
+    g_energy.assign(num_groups(), 0);
+    col_map.clear();
+    r_off = {0};
+    r_terms.clear();
+    n_rows = 0;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::set_col_map(const std::vector<int> & col_map)
+{
+    assert(col_map.size()==x.size());
+
+    this->col_map = col_map;
+    n_rows = 0;
+    for(int col : col_map) if(col>=0) ++n_rows;
+
+    // per row stencil of the right hand side (CSR). A term (a,b) of group g
+    // contributes +R_g*w*e_ref to row a, and -R_g*w*e_ref to row b
+    r_off.assign(n_rows+1, 0);
+    for(const GroupTerm & t : g_terms)
+    {
+        if(col_map.at(t.a)>=0) ++r_off.at(col_map.at(t.a)+1);
+        if(col_map.at(t.b)>=0) ++r_off.at(col_map.at(t.b)+1);
+    }
+    for(uint r=0; r<n_rows; ++r) r_off.at(r+1) += r_off.at(r);
+
+    std::vector<uint> pos(r_off.begin(), r_off.end()-1);
+    r_terms.resize(r_off.back());
+    for(uint g=0; g<num_groups(); ++g)
+    for(uint i=g_off.at(g); i<g_off.at(g+1); ++i)
+    {
+        const GroupTerm & t = g_terms.at(i);
+        if(col_map.at(t.a)>=0) r_terms.at(pos.at(col_map.at(t.a))++) = { g, t.b, t.w,  t.we };
+        if(col_map.at(t.b)>=0) r_terms.at(pos.at(col_map.at(t.b))++) = { g, t.a, t.w, -t.we };
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+Eigen::SparseMatrix<double> ARAPSolver<d>::stiffness_matrix() const
+{
+    typedef Eigen::Triplet<double> Entry;
+    std::vector<Entry> entries;
+    entries.reserve(4*g_terms.size());
+    for(const GroupTerm & t : g_terms)
+    {
+        int ra = col_map.at(t.a);
+        int rb = col_map.at(t.b);
+        if(ra>=0)           entries.push_back(Entry(ra, ra,  t.w));
+        if(rb>=0)           entries.push_back(Entry(rb, rb,  t.w));
+        if(ra>=0 && rb>=0)  entries.push_back(Entry(ra, rb, -t.w));
+        if(ra>=0 && rb>=0)  entries.push_back(Entry(rb, ra, -t.w));
+    }
+    Eigen::SparseMatrix<double> A(n_rows, n_rows);
+    A.setFromTriplets(entries.begin(), entries.end());
+    return A;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+bool ARAPSolver<d>::factorize(const Eigen::SparseMatrix<double> & A)
+{
+    assert(A.rows()==n_rows && A.cols()==n_rows);
+    LLT.compute(A);
+    return LLT.info()==Eigen::Success;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::local_step()
+{
+    PARALLEL_FOR(0, num_groups(), 1000, [&](uint g)
+    {
+        matd   cov = matd::ZERO();
+        double E   = 0;
+        for(uint k=g_off[g]; k<g_off[g+1]; ++k)
+        {
+            const GroupTerm & t = g_terms[k];
+            vecd dx = x[t.a] - x[t.b];
+            for(uint i=0; i<d; ++i)
+            for(uint j=0; j<d; ++j) cov(i,j) += dx[i]*t.we[j];
+            E += t.w*dx.dot(dx) + t.e2;
+        }
+        R[g] = cov.closest_orthogonal_matrix(true);
+
+        // sum_t w|dx - R*e|^2 = sum_t w(|dx|^2 + |e|^2) - 2*trace(R^T*cov)
+        for(uint i=0; i<d; ++i)
+        for(uint j=0; j<d; ++j) E -= 2*R[g](i,j)*cov(i,j);
+        g_energy[g] = E;
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::global_step()
+{
+    rhs.resize(n_rows, d);
+    PARALLEL_FOR(0, n_rows, 1000, [&](uint r)
+    {
+        vecd b = vecd::ZERO();
+        for(uint k=r_off[r]; k<r_off[r+1]; ++k)
+        {
+            const RhsTerm & t = r_terms[k];
+            b += R[t.g] * t.we;
+            if(col_map[t.other]<0) b += t.w * x[t.other];
+        }
+        for(uint i=0; i<d; ++i) rhs(r,i) = b[i];
+    });
+    if(rhs_map.size()>0)  rhs = (rhs_map * rhs).eval();
+    if(rhs_bias.size()>0) rhs += rhs_bias;
+
+    sol = LLT.solve(rhs);
+    scatter(sol.data());
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+double ARAPSolver<d>::energy() const
+{
+    double E = 0;
+    for(double e : g_energy) E += e;
+    return E;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::iterate(const uint n_iters, const uint anderson_window)
+{
+    // least squares formulations do not minimize energy() (see header)
+    if(anderson_window==0 || rhs_map.size()>0)
+    {
+        for(uint i=0; i<n_iters; ++i)
+        {
+            local_step();
+            global_step();
+        }
+        return;
+    }
+
+    AndersonAcceleration AA(anderson_window);
+    Eigen::VectorXd u, g, u_next;
+    double E_prev = max_double;
+    for(uint i=0; i<n_iters; ++i)
+    {
+        local_step();
+        double E = energy();
+        if(i>0 && E>E_prev)
+        {
+            // the accelerated iterate increased the energy: fall back to the plain one
+            scatter(g.data());
+            local_step();
+            E = energy();
+            AA.reset();
+        }
+        E_prev = E;
+        gather(u);
+        global_step();
+        g = Eigen::Map<const Eigen::VectorXd>(sol.data(), sol.size());
+        AA.compute(u, g, u_next);
+        scatter(u_next.data());
+    }
+    if(n_iters>0) scatter(g.data()); // the last plain iterate
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::gather(Eigen::VectorXd & u) const
+{
+    u.resize(n_rows*d);
+    for(uint vid=0; vid<x.size(); ++vid)
+    {
+        if(col_map[vid]<0) continue;
+        for(uint i=0; i<d; ++i) u[i*n_rows + col_map[vid]] = x[vid][i];
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint d>
+CINO_INLINE
+void ARAPSolver<d>::scatter(const double * u)
+{
+    // u is column major (one column per coordinate), as the solution of the global step
+    PARALLEL_FOR(0, x.size(), 1000, [&](uint vid)
+    {
+        if(col_map[vid]<0) return;
+        for(uint i=0; i<d; ++i) x[vid][i] = u[i*n_rows + col_map[vid]];
+    });
+}
+
+}
@@ -0,0 +1,154 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_ARAP_SOLVER_H
+#define CINO_ARAP_SOLVER_H
+
+#include <cinolib/geometry/vec_mat.h>
+#include <Eigen/Sparse>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Local/global solver shared by ARAP (surface modelling) and ARAP_2D_mapping
+ * (UV unwrapping). The energy is defined by a set of terms, each one asking an
+ * edge (x_a - x_b) to be as close as possible to a rotated reference edge:
+ *
+ *      E = sum_g sum_{t in g} w_t |x_a - x_b - R_g e_t|^2
+ *
+ * where terms are grouped by the rotation R_g they share (one per vertex for
+ * ARAP, one per triangle for the UV mapping). Vertices can be fixed, and the
+ * global step solves for the free ones only.
+ *
+ *  - local step : per group covariance matrix and closest rotation (closed
+ *                 form polar decomposition, see mat_closest_rot33), in parallel
+ *  - global step: the right hand side is assembled in parallel from a per row
+ *                 stencil precomputed by set_col_map (no edge/adjacency lookups),
+ *                 into buffers that are reused across iterations. All the d
+ *                 coordinates are then solved at once, as a multi column rhs
+ *
+ * The system matrix is given by the caller (stiffness_matrix() provides the one
+ * of the energy above). For least squares formulations (e.g. soft constraints)
+ * the rhs can be pre-multiplied by rhs_map, and a constant term rhs_bias can be
+ * added to it.
+ *
+ * Optionally, iterations can be sped up with Anderson acceleration. In this case
+ * the energy is checked at each iteration, and if the accelerated iterate does
+ * not decrease it, the solver falls back to the plain local/global iterate.
+ * NOTE: acceleration is disabled for least squares formulations (rhs_map set),
+ * as their global step minimizes |A x - b|^2 + |C x - h|^2 rather than the
+ * energy E, and the acceptance test would compare a quantity the iterations
+ * do not decrease. In this case iterate() always performs plain iterations.
+*/
+
+template<uint d>
+class ARAPSolver
+{
+    public:
+
+        typedef mat<d,1,double> vecd;
+        typedef mat<d,d,double> matd;
+
+        struct Term
+        {
+            uint   a, b;  // edge (x_a - x_b)
+            double w;     // weight
+            vecd   e_ref; // reference edge
+        };
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // terms are grouped CSR style: the terms of group g are in [g_off[g], g_off[g+1])
+        void set_terms(const uint                n_verts,
+                       const std::vector<uint> & g_off,
+                       const std::vector<Term> & terms);
+
+        // matrix row of each vertex (-1 for fixed vertices). Must be called after set_terms
+        void set_col_map(const std::vector<int> & col_map);
+
+        // sum_t w_t (e_a - e_b)(e_a - e_b)^T, restricted to the free vertices
+        Eigen::SparseMatrix<double> stiffness_matrix() const;
+
+        bool factorize(const Eigen::SparseMatrix<double> & A);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void   local_step();
+        void   global_step();
+        double energy() const; // energy of the current vertices and rotations (as of the last local step)
+        void   iterate(const uint n_iters, const uint anderson_window = 0); // anderson_window is ignored if rhs_map is set
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint num_rows()   const { return n_rows; }
+        uint num_groups() const { return uint(g_off.size()-1); }
+
+              std::vector<vecd> & verts()           { return x; } // free and fixed vertices
+        const std::vector<vecd> & verts()     const { return x; }
+        const std::vector<matd> & rotations() const { return R; }
+
+        Eigen::SparseMatrix<double> rhs_map;  // optional (if empty it is the identity)
+        Eigen::MatrixXd             rhs_bias; // optional (if empty it is zero)
+
+    protected:
+
+        void gather (Eigen::VectorXd & u) const; // free vertices => vector
+        void scatter(const double * u);          // vector => free vertices
+
+        struct GroupTerm { uint a, b; double w; vecd we; double e2; }; // we = w*e_ref, e2 = w*|e_ref|^2
+        struct RhsTerm   { uint g; uint other; double w; vecd we; };    // row += R_g*we (+ w*x_other, if fixed)
+
+        uint                   n_rows = 0;
+        std::vector<int>       col_map;
+        std::vector<vecd>      x;
+        std::vector<matd>      R;
+        std::vector<double>    g_energy;
+        std::vector<uint>      g_off = {0};
+        std::vector<GroupTerm> g_terms;
+        std::vector<uint>      r_off = {0};
+        std::vector<RhsTerm>   r_terms;
+        Eigen::MatrixXd        rhs;
+        Eigen::MatrixXd        sol;
+        Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> LLT;
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "ARAP_solver.cpp"
+#endif
+
+#endif // CINO_ARAP_SOLVER_H
@@ -34,10 +34,6 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/HKS.h>
-#include <cinolib/laplacian.h>
-#include <cinolib/linear_solvers.h>
-#include <cinolib/scalar_field.h>
-#include <cinolib/vertex_mass.h>
 #include <cinolib/sampling.h>
 
 namespace cinolib
@@ -54,13 +50,43 @@ Eigen::MatrixXd HKS(      AbstractMesh<M,V,E,P> & m,
 {
     if(normalize_mesh) m.normalize_bbox();
 
-    uint n_rows = m.num_verts();
-    uint n_cols = landmarks.size()*n_timesteps;
-    Eigen::MatrixXd A(n_rows,n_cols);
+    if(verbose) std::cout << "HKS: " << landmarks.size() << " landmarks, " << n_timesteps << " time steps" << std::endl;
 
-    Eigen::SparseMatrix<double> L  = laplacian(m, COTANGENT);
-    Eigen::SparseMatrix<double> MM = mass_matrix(m);
+    HeatKernel hk(m);
+    return HKS(hk, landmarks, n_timesteps, false, normalize_columns);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Eigen::MatrixXd HKS(const HeatKernel        & hk,
+                    const std::vector<uint> & landmarks,
+                    const uint                n_timesteps,
+                    const bool                spectral,
+                    const bool                normalize_columns)
+{
+    std::vector<double> timesteps = HKS_timesteps(n_timesteps);
+
+    Eigen::MatrixXd A = spectral ? hk.eval_spectral(timesteps, landmarks)
+                                 : hk.eval_exact(timesteps, landmarks);
+
+    if(normalize_columns) // Useful for visualization but "physically wrong"...
+    {
+        for(int col=0; col<A.cols(); ++col)
+        {
+            double min = A.col(col).minCoeff();
+            double max = A.col(col).maxCoeff();
+            A.col(col) = (A.col(col).array() - min) / (max - min);
+        }
+    }
+    return A;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+CINO_INLINE
+std::vector<double> HKS_timesteps(const uint n_timesteps)
+{
     // This is what Dorian Nogneng and Maks Ovsjanikov do in their reference code for the paper:
     //
     //      Informative Descriptor Preservation via Commutativity for Shape Matching
@@ -68,26 +94,7 @@ Eigen::MatrixXd HKS(      AbstractMesh<M,V,E,P> & m,
     //
     std::vector<double> timesteps = sample_within_interval(log(0.005), log(0.2), n_timesteps);
     for(uint i=0; i<n_timesteps; ++i) timesteps[i] = exp(timesteps[i]);
-
-    uint col = 0;
-    for(auto t : timesteps)
-    {
-        Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> solver(MM - t*L);
-        assert(solver.info() == Eigen::Success);
-
-        for(auto v : landmarks)
-        {
-            if(verbose) std::cout << "column " << col << ": time step " << t << ", landmark " << v << std::endl;
-
-            Eigen::VectorXd rhs = Eigen::VectorXd::Zero(m.num_verts());
-            rhs[v] = 1.0;
-            ScalarField f = solver.solve(rhs).eval();
-            if(normalize_columns) f.normalize_in_01(); // Useful for visualization but "physically wrong"...
-            for(uint vid=0; vid<m.num_verts(); ++vid) A.coeffRef(vid,col) = f[vid];
-            ++col;
-        }
-    }
-    return A;
+    return timesteps;
 }
 
 }
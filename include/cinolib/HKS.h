@@ -37,12 +37,14 @@
 #define CINO_HKS_H
 
 #include <cinolib/meshes/abstract_mesh.h>
+#include <cinolib/heat_kernel.h>
 #include <Eigen/Dense>
 
 namespace cinolib
 {
 
-// Heat Kernel Signature
+// Heat Kernel Signature. Columns are ordered by time step first, and then by landmark.
+// Landmarks are solved in parallel, as a multi column right hand side (see heat_kernel.h)
 
 template<class M, class V, class E, class P>
 CINO_INLINE
@@ -52,6 +54,27 @@ Eigen::MatrixXd HKS(      AbstractMesh<M,V,E,P> & m,
                     const bool                    normalize_mesh = false,
                     const bool                    normalize_columns = false,
                     const bool                    verbose = false);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Same as above, but reuses a heat kernel engine across calls (e.g. on multiple
+// landmark sets). If spectral is true, the eigenbasis of the engine is used in
+// place of linear solves (see HeatKernel::eval_spectral), and must have been
+// computed (or set) before
+
+CINO_INLINE
+Eigen::MatrixXd HKS(const HeatKernel        & hk,
+                    const std::vector<uint> & landmarks,
+                    const uint                n_timesteps,
+                    const bool                spectral,
+                    const bool                normalize_columns = false);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// time steps used by HKS, log-uniformly sampled in [0.005,0.2]
+
+CINO_INLINE
+std::vector<double> HKS_timesteps(const uint n_timesteps);
 }
 
 #ifndef  CINO_STATIC_LIB
@@ -48,6 +48,8 @@ namespace cinolib
  * Fast Poisson Disk Sampling in Arbitrary Dimensions
  * Robert Bridson
  * SIGGRAPH Technical Sketch, 2007
+ *
+ * See Poisson_sampling_parallel.h for a multi-threaded alternative, which also samples surfaces and volumes
 */
 
 template<uint Dim, class Point>
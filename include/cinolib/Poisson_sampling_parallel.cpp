@@ -0,0 +1,499 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/Poisson_sampling_parallel.h>
+#include <cinolib/random_generator.h>
+#include <cinolib/parallel_for.h>
+#include <cinolib/min_max_inf.h>
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace cinolib
+{
+
+template<uint Dim>
+CINO_INLINE
+double Poisson_sampling_parallel_cell_size(const double r_min)
+{
+    return 0.999*r_min/std::sqrt(static_cast<double>(Dim));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint Dim, class Point>
+CINO_INLINE
+void Poisson_sampling_parallel(const Point                                                                                & origin,
+                               const double                                                                                 r_min,
+                               const double                                                                                 r_max,
+                               const std::vector<std::array<int,Dim>>                                                     & cells,
+                               const uint                                                                                   seed,
+                               const std::function<bool(const uint cell_id, const uint round, Point & x, double & r)>     & dart,
+                               std::vector<Point>                                                                         & samples)
+{
+    samples.clear();
+    if(cells.empty()) return;
+
+    // tiles are blocks of T^Dim cells. Since T*step >= r_max, a dart can
+    // only conflict with samples in its own tile or in the adjacent ones
+    double step = Poisson_sampling_parallel_cell_size<Dim>(r_min);
+    int    T    = std::max(1, static_cast<int>(std::ceil(r_max/step)));
+
+    auto tile_of = [T](const std::array<int,Dim> & c)
+    {
+        std::array<int,Dim> t;
+        for(uint i=0; i<Dim; ++i) t[i] = (c[i]>=0) ? c[i]/T : -((-c[i]+T-1)/T);
+        return t;
+    };
+
+    // tiles are hashed (only tiles touched by the domain are allocated). Keys
+    // have a one tile padding on each side, so that neighbors are always valid
+    std::array<int,Dim> t_min, t_max;
+    t_min.fill( max_int);
+    t_max.fill(-max_int);
+    for(const auto & c : cells)
+    {
+        std::array<int,Dim> t = tile_of(c);
+        for(uint i=0; i<Dim; ++i)
+        {
+            t_min[i] = std::min(t_min[i], t[i]);
+            t_max[i] = std::max(t_max[i], t[i]);
+        }
+    }
+    auto tile_key = [&](const std::array<int,Dim> & t)
+    {
+        uint64_t key = 0;
+        for(int i=Dim-1; i>=0; --i) key = key*static_cast<uint64_t>(t_max[i]-t_min[i]+3) + static_cast<uint64_t>(t[i]-t_min[i]+1);
+        return key;
+    };
+
+    // group cells by tile. Cells within each tile are visited in random order, to avoid scanline artifacts
+    std::vector<std::pair<uint64_t,uint64_t>> cell_tile(cells.size());
+    PARALLEL_FOR(0, static_cast<uint>(cells.size()), 10000, [&](uint cid)
+    {
+        uint64_t rnd  = random_uint(seed^random_uint(cid));
+        cell_tile[cid] = std::make_pair(tile_key(tile_of(cells[cid])), (rnd<<32) | cid);
+    });
+    std::sort(cell_tile.begin(), cell_tile.end());
+
+    std::unordered_map<uint64_t,uint>    tile_id;
+    std::vector<std::array<int,Dim>>     tile_pos;
+    std::vector<std::vector<uint>>       tile_cells; // active cells (neither occupied nor exhausted)
+    for(uint i=0; i<cell_tile.size(); ++i)
+    {
+        if(i==0 || cell_tile[i].first!=cell_tile[i-1].first)
+        {
+            tile_id[cell_tile[i].first] = static_cast<uint>(tile_pos.size());
+            tile_pos.push_back(tile_of(cells[cell_tile[i].second & 0xFFFFFFFF]));
+            tile_cells.emplace_back();
+        }
+        tile_cells.back().push_back(static_cast<uint>(cell_tile[i].second & 0xFFFFFFFF));
+    }
+    uint n_tiles = static_cast<uint>(tile_pos.size());
+
+    // neighbor tiles (itself included), and phase groups. Tiles in the same
+    // group are at least two tiles apart, hence no tile can be written by one
+    // thread while being read by another
+    uint n_offsets = 1;
+    for(uint i=0; i<Dim; ++i) n_offsets *= 3;
+    std::vector<std::vector<uint>> tile_nbrs(n_tiles);
+    PARALLEL_FOR(0, n_tiles, 1000, [&](uint tid)
+    {
+        const std::array<int,Dim> & t = tile_pos[tid];
+        tile_nbrs[tid].push_back(tid); // most conflicts are local: test them first
+        for(uint off=0; off<n_offsets; ++off)
+        {
+            if(off==n_offsets/2) continue;
+            std::array<int,Dim> n = t;
+            for(uint i=0, o=off; i<Dim; ++i, o/=3) n[i] += static_cast<int>(o%3)-1;
+            auto it = tile_id.find(tile_key(n));
+            if(it!=tile_id.end()) tile_nbrs[tid].push_back(it->second);
+        }
+    });
+    std::vector<std::vector<uint>> phases(1<<Dim);
+    for(uint tid=0; tid<n_tiles; ++tid)
+    {
+        uint phase = 0;
+        for(uint i=0; i<Dim; ++i) phase |= static_cast<uint>(tile_pos[tid][i]&1)<<i;
+        phases.at(phase).push_back(tid);
+    }
+
+    std::vector<std::vector<Point>>  tile_samples(n_tiles);
+    std::vector<std::vector<double>> tile_radii(n_tiles);
+    size_t n_active = cells.size();
+    for(uint round=0; n_active>0; ++round)
+    {
+        for(const std::vector<uint> & group : phases)
+        {
+            PARALLEL_FOR(0, static_cast<uint>(group.size()), 16, [&](uint i)
+            {
+                uint tid = group.at(i);
+                std::vector<uint> & active = tile_cells.at(tid);
+                uint n_kept = 0;
+                for(uint j=0; j<active.size(); ++j)
+                {
+                    uint   cid = active.at(j);
+                    Point  x;
+                    double r;
+                    if(!dart(cid, round, x, r)) continue; // exhausted
+
+                    bool conflict = false;
+                    bool covered  = false;
+                    for(uint nid : tile_nbrs.at(tid))
+                    {
+                        const std::vector<Point>  & s  = tile_samples.at(nid);
+                        const std::vector<double> & rs = tile_radii.at(nid);
+                        for(uint k=0; k<s.size(); ++k)
+                        {
+                            double rr = std::max(r, rs[k]);
+                            if((x-s[k]).norm_sqrd()<rr*rr)
+                            {
+                                // if the cell is entirely inside the disk of s
+                                // no future dart can land in it: retire it
+                                double d = 0;
+                                for(uint l=0; l<Dim; ++l)
+                                {
+                                    double lo = origin[l] + cells[cid][l]*step;
+                                    double dl = std::max(std::fabs(lo-s[k][l]), std::fabs(lo+step-s[k][l]));
+                                    d += dl*dl;
+                                }
+                                covered  = (d<rs[k]*rs[k]);
+                                conflict = true;
+                                break;
+                            }
+                        }
+                        if(conflict) break;
+                    }
+
+                    if(conflict && !covered) active.at(n_kept++) = cid;
+                    else if(!conflict)
+                    {
+                        tile_samples.at(tid).push_back(x);
+                        tile_radii.at(tid).push_back(r);
+                    }
+                }
+                active.resize(n_kept);
+            });
+        }
+        n_active = 0;
+        for(const auto & tc : tile_cells) n_active += tc.size();
+    }
+
+    size_t n_samples = 0;
+    for(const auto & s : tile_samples) n_samples += s.size();
+    samples.reserve(n_samples);
+    for(const auto & s : tile_samples) samples.insert(samples.end(), s.begin(), s.end());
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint Dim, class Point>
+CINO_INLINE
+void Poisson_sampling_parallel(const double         radius,
+                               const Point          min,
+                               const Point          max,
+                               std::vector<Point> & samples,
+                               const uint           seed,
+                               const uint           max_attempts)
+{
+    double step = Poisson_sampling_parallel_cell_size<Dim>(radius);
+
+    std::array<int,Dim> extent;
+    size_t n_cells = 1;
+    for(uint i=0; i<Dim; ++i)
+    {
+        extent[i] = std::max(1, static_cast<int>(std::ceil((max[i]-min[i])/step)));
+        n_cells  *= extent[i];
+    }
+    std::vector<std::array<int,Dim>> cells(n_cells);
+    std::array<int,Dim> c;
+    c.fill(0);
+    for(size_t cid=0; cid<n_cells; ++cid)
+    {
+        cells[cid] = c;
+        for(uint i=0; i<Dim; ++i)
+        {
+            if(++c[i]<extent[i]) break;
+            c[i] = 0;
+        }
+    }
+
+    // uniform darts in the portion of cell that is inside the box
+    auto dart = [&](const uint cid, const uint round, Point & x, double & r)
+    {
+        if(round>=max_attempts) return false;
+        uint s = random_uint(cid^random_uint(seed+round*2654435769u))*Dim;
+        for(uint i=0; i<Dim; ++i)
+        {
+            double lo = min[i] + cells[cid][i]*step;
+            double hi = std::min(static_cast<double>(max[i]), lo+step);
+            x[i] = random_double(s+i, lo, hi);
+        }
+        r = radius;
+        return true;
+    };
+
+    Poisson_sampling_parallel<Dim,Point>(min, radius, radius, cells, seed, dart, samples);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void Poisson_sampling_parallel(const std::vector<vec3d>  & candidates,
+                               const std::vector<double> & radii,
+                               std::vector<vec3d>        & samples,
+                               const uint                  seed)
+{
+    assert(candidates.size()==radii.size());
+    samples.clear();
+    if(candidates.empty()) return;
+
+    double r_min = *std::min_element(radii.begin(), radii.end());
+    double r_max = *std::max_element(radii.begin(), radii.end());
+    double step  = Poisson_sampling_parallel_cell_size<3>(r_min);
+    vec3d  o( inf_double,  inf_double,  inf_double);
+    vec3d  e(-inf_double, -inf_double, -inf_double);
+    for(const vec3d & p : candidates)
+    {
+        o = o.min(p);
+        e = e.max(p);
+    }
+
+    // cell coordinates are packed in a 64 bit key (mixed radix, with as many
+    // digits per axis as cells). Very small radii w.r.t. the size of the domain
+    // would overflow it (e.g. more than ~2.6M cells per side for a cube)
+    uint64_t n_cells[3];
+    double   n_tot = 1;
+    for(uint j=0; j<3; ++j)
+    {
+        double n_axis = std::floor((e[j]-o[j])/step) + 1;
+        n_cells[j] = static_cast<uint64_t>(std::min(n_axis, static_cast<double>(max_int)));
+        n_tot *= n_axis;
+    }
+    if(n_tot >= 9.2e18 || std::max(n_cells[0], std::max(n_cells[1], n_cells[2])) >= static_cast<uint64_t>(max_int))
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : Poisson_sampling_parallel : too many cells ("
+                  << n_tot << "). The minimum radius (" << r_min << ") is too small w.r.t. the size of the domain" << std::endl;
+        exit(-1);
+    }
+
+    // sort candidates by cell, and randomly within each cell
+    uint n = static_cast<uint>(candidates.size());
+    std::vector<std::pair<uint64_t,uint64_t>> order(n);
+    PARALLEL_FOR(0, n, 10000, [&](uint i)
+    {
+        uint64_t key = 0;
+        for(uint j=0; j<3; ++j)
+        {
+            uint64_t c = std::min(static_cast<uint64_t>((candidates[i][j]-o[j])/step), n_cells[j]-1);
+            key = key*n_cells[j] + c;
+        }
+        order[i].first  = key;
+        order[i].second = (static_cast<uint64_t>(random_uint(seed^random_uint(i)))<<32) | i;
+    });
+    std::sort(order.begin(), order.end());
+
+    // candidates of the same cell are stored contiguously
+    std::vector<vec3d>             x(n);
+    std::vector<double>            r(n);
+    std::vector<std::array<int,3>> cells;
+    std::vector<uint>              beg;
+    for(uint i=0; i<n; ++i)
+    {
+        uint id = static_cast<uint>(order[i].second & 0xFFFFFFFF);
+        x[i] = candidates[id];
+        r[i] = radii[id];
+        if(i==0 || order[i].first!=order[i-1].first)
+        {
+            uint64_t key = order[i].first;
+            int cz = static_cast<int>(key % n_cells[2]); key /= n_cells[2];
+            int cy = static_cast<int>(key % n_cells[1]); key /= n_cells[1];
+            int cx = static_cast<int>(key);
+            cells.push_back({ cx, cy, cz });
+            beg.push_back(i);
+        }
+    }
+    beg.push_back(n);
+
+    auto dart = [&](const uint cid, const uint round, vec3d & p, double & rp)
+    {
+        uint k = beg[cid]+round;
+        if(k>=beg[cid+1]) return false;
+        p  = x[k];
+        rp = r[k];
+        return true;
+    };
+
+    Poisson_sampling_parallel<3,vec3d>(o, r_min, r_max, cells, seed, dart, samples);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Trimesh<M,V,E,P>                       & m,
+                               const std::function<double(const vec3d & p)> & radius,
+                               std::vector<vec3d>                           & samples,
+                               const uint                                     seed,
+                               const double                                   oversampling)
+{
+    // number of candidates per triangle, with random rounding
+    std::vector<uint> offset(m.num_polys()+1, 0);
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        vec3d  c = (m.poly_vert(pid,0) + m.poly_vert(pid,1) + m.poly_vert(pid,2))/3.0;
+        double r = radius(c);
+        double n = oversampling*m.poly_area(pid)/(r*r);
+        offset[pid+1] = static_cast<uint>(n) + ((random_double(seed^random_uint(pid)) < n-std::floor(n)) ? 1 : 0);
+    });
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    std::vector<vec3d>  candidates(offset.back());
+    std::vector<double> radii(offset.back());
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        vec3d v0 = m.poly_vert(pid,0);
+        vec3d e1 = m.poly_vert(pid,1) - v0;
+        vec3d e2 = m.poly_vert(pid,2) - v0;
+        for(uint i=offset[pid]; i<offset[pid+1]; ++i)
+        {
+            uint   s = random_uint(seed+i)*2;
+            double u = random_double(s);
+            double v = random_double(s+1);
+            if(u+v>1)
+            {
+                u = 1-u;
+                v = 1-v;
+            }
+            candidates[i] = v0 + u*e1 + v*e2;
+            radii[i]      = radius(candidates[i]);
+        }
+    });
+
+    Poisson_sampling_parallel(candidates, radii, samples, seed);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Trimesh<M,V,E,P> & m,
+                               const double             radius,
+                               std::vector<vec3d>     & samples,
+                               const uint               seed,
+                               const double             oversampling)
+{
+    Poisson_sampling_parallel(m, [radius](const vec3d &){ return radius; }, samples, seed, oversampling);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Tetmesh<M,V,E,F,P>                     & m,
+                               const std::function<double(const vec3d & p)> & radius,
+                               std::vector<vec3d>                           & samples,
+                               const uint                                     seed,
+                               const double                                   oversampling)
+{
+    // number of candidates per tetrahedron, with random rounding
+    std::vector<uint> offset(m.num_polys()+1, 0);
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        vec3d  c = (m.poly_vert(pid,0) + m.poly_vert(pid,1) + m.poly_vert(pid,2) + m.poly_vert(pid,3))/4.0;
+        double r = radius(c);
+        double n = oversampling*m.poly_volume(pid)/(r*r*r);
+        offset[pid+1] = static_cast<uint>(n) + ((random_double(seed^random_uint(pid)) < n-std::floor(n)) ? 1 : 0);
+    });
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    std::vector<vec3d>  candidates(offset.back());
+    std::vector<double> radii(offset.back());
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        vec3d v0 = m.poly_vert(pid,0);
+        vec3d e1 = m.poly_vert(pid,1) - v0;
+        vec3d e2 = m.poly_vert(pid,2) - v0;
+        vec3d e3 = m.poly_vert(pid,3) - v0;
+        for(uint i=offset[pid]; i<offset[pid+1]; ++i)
+        {
+            // Generating Random Points in a Tetrahedron
+            // C.Rocchini and P.Cignoni - Journal of Graphics Tools (2000)
+            uint   seed_i = random_uint(seed+i)*3;
+            double s = random_double(seed_i);
+            double t = random_double(seed_i+1);
+            double u = random_double(seed_i+2);
+            if(s+t>1)
+            {
+                s = 1-s;
+                t = 1-t;
+            }
+            if(t+u>1)
+            {
+                double tmp = u;
+                u = 1-s-t;
+                t = 1-tmp;
+            }
+            else if(s+t+u>1)
+            {
+                double tmp = u;
+                u = s+t+u-1;
+                s = 1-t-tmp;
+            }
+            candidates[i] = v0 + s*e1 + t*e2 + u*e3;
+            radii[i]      = radius(candidates[i]);
+        }
+    });
+
+    Poisson_sampling_parallel(candidates, radii, samples, seed);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Tetmesh<M,V,E,F,P> & m,
+                               const double               radius,
+                               std::vector<vec3d>       & samples,
+                               const uint                 seed,
+                               const double               oversampling)
+{
+    Poisson_sampling_parallel(m, [radius](const vec3d &){ return radius; }, samples, seed, oversampling);
+}
+
+}
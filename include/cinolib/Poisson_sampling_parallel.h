@@ -0,0 +1,168 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_POISSON_SAMPLING_PARALLEL
+#define CINO_POISSON_SAMPLING_PARALLEL
+
+#include <cinolib/meshes/trimesh.h>
+#include <cinolib/meshes/tetmesh.h>
+#include <array>
+#include <functional>
+
+namespace cinolib
+{
+
+/* Parallel Poisson disk sampling of boxes, surfaces and volumes.
+ *
+ * Space is partitioned into a grid of cells small enough to contain at most one
+ * sample, and cells are grouped into tiles at least as large as the maximum
+ * sampling radius. Tiles are split into 2^Dim phase groups (depending on the
+ * parity of their coordinates), such that tiles in the same group are never
+ * adjacent and can be processed concurrently without synchronization: a dart
+ * thrown inside a tile can only conflict with samples in the tile itself and in
+ * its neighbors, which belong to other phase groups. The algorithm proceeds in
+ * rounds: at each round each empty cell receives one dart, which is accepted if
+ * it does not conflict with existing samples. Only tiles touched by the domain
+ * are allocated (sparse hashed storage), so that surfaces can be sampled without
+ * allocating the full volumetric grid.
+ *
+ * Results are deterministic for a given seed, regardless of the number of threads.
+ *
+ * For boxes, darts are drawn uniformly in the cells, and max_attempts is the number
+ * of rounds (i.e., darts per cell). For meshes, darts are picked from a precomputed
+ * dense set of candidate points (oversampling/r^2 candidates per unit area for surfaces,
+ * oversampling/r^3 per unit volume for volumes), and processed in random order, as in:
+ *
+ *     Parallel Poisson Disk Sampling
+ *     Li-Yi Wei
+ *     ACM SIGGRAPH (2008)
+ *
+ *     Efficient and Flexible Sampling with Blue Noise Properties of Triangular Meshes
+ *     M.Corsini, P.Cignoni, R.Scopigno
+ *     IEEE Transactions on Visualization and Computer Graphics (2012)
+ *
+ * Mesh samplers accept a radius field r(p) that controls the local sampling density
+ * (the function must be thread safe). Two samples p,q are in conflict if their distance
+ * is below max(r(p),r(q)). Distances are Euclidean also on surfaces.
+*/
+
+template<uint Dim, class Point>
+CINO_INLINE
+void Poisson_sampling_parallel(const double         radius,
+                               const Point          min,
+                               const Point          max,
+                               std::vector<Point> & samples,
+                               const uint           seed = 0,
+                               const uint           max_attempts = 30);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Trimesh<M,V,E,P>                       & m,
+                               const std::function<double(const vec3d & p)> & radius,
+                               std::vector<vec3d>                           & samples,
+                               const uint                                     seed = 0,
+                               const double                                   oversampling = 10);
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Trimesh<M,V,E,P> & m,
+                               const double             radius,
+                               std::vector<vec3d>     & samples,
+                               const uint               seed = 0,
+                               const double             oversampling = 10);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Tetmesh<M,V,E,F,P>                     & m,
+                               const std::function<double(const vec3d & p)> & radius,
+                               std::vector<vec3d>                           & samples,
+                               const uint                                     seed = 0,
+                               const double                                   oversampling = 10);
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void Poisson_sampling_parallel(const Tetmesh<M,V,E,F,P> & m,
+                               const double               radius,
+                               std::vector<vec3d>       & samples,
+                               const uint                 seed = 0,
+                               const double               oversampling = 10);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Selects a Poisson disk subset of a given set of candidate points, each with its own sampling radius.
+// Candidates are processed in random order. This is the backend of the mesh samplers above. The
+// program exits with an error if the grid of cells of size ~r_min over the candidates is so fine
+// that cell ids do not fit in 64 bits (e.g. more than ~2.6M cells per side for a cube)
+CINO_INLINE
+void Poisson_sampling_parallel(const std::vector<vec3d>  & candidates,
+                               const std::vector<double> & radii,
+                               std::vector<vec3d>        & samples,
+                               const uint                  seed = 0);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Core of all the samplers above. cells are the integer coordinates of the non empty cells of a grid
+// with the given origin and step Poisson_sampling_parallel_cell_size(r_min), and r_min, r_max bound
+// the sampling radius over the domain. At each round, dart(cell_id, round, x, r) generates a candidate x
+// (with radius r) for the cell cells[cell_id], or returns false if the cell has no more candidates.
+// Rounds continue until all cells are either occupied or exhausted
+template<uint Dim, class Point>
+CINO_INLINE
+void Poisson_sampling_parallel(const Point                                                                                & origin,
+                               const double                                                                                 r_min,
+                               const double                                                                                 r_max,
+                               const std::vector<std::array<int,Dim>>                                                     & cells,
+                               const uint                                                                                   seed,
+                               const std::function<bool(const uint cell_id, const uint round, Point & x, double & r)>     & dart,
+                               std::vector<Point>                                                                         & samples);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// side of a grid cell that can contain at most one sample
+template<uint Dim>
+CINO_INLINE
+double Poisson_sampling_parallel_cell_size(const double r_min);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "Poisson_sampling_parallel.cpp"
+#endif
+
+#endif // CINO_POISSON_SAMPLING_PARALLEL
@@ -0,0 +1,359 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/QEM_simplification.h>
+#include <cinolib/parallel_for.h>
+#include <array>
+#include <queue>
+#include <unordered_set>
+
+namespace cinolib
+{
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void QEM_simplify(const Trimesh<M,V,E,P> & m,
+                  const uint               target_polys,
+                  ProgressiveMesh        & pm,
+                  const bool               preserve_marked_features,
+                  const double             feature_weight)
+{
+    // the simplification works on plain arrays, so that vertex and triangle
+    // ids are never renumbered (Trimesh::edge_collapse would compact them)
+    std::vector<vec3d> pos = m.vector_verts();
+    std::vector<uint>  tris(3*m.num_polys());
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        tris[3*pid+0] = m.poly_vert_id(pid,0);
+        tris[3*pid+1] = m.poly_vert_id(pid,1);
+        tris[3*pid+2] = m.poly_vert_id(pid,2);
+    }
+    pm = ProgressiveMesh(pos, tris);
+
+    uint nv = m.num_verts();
+    std::vector<std::vector<uint>> v2t(nv); // incident triangles (dead ones are removed lazily)
+    for(uint vid=0; vid<nv; ++vid) v2t[vid] = m.adj_v2p(vid);
+    std::vector<bool> t_alive(m.num_polys(), true);
+    std::vector<bool> v_alive(nv, true);
+    std::vector<uint> stamp(nv, 0); // bumped at each change of a vertex, to detect obsolete heap entries
+    uint n_polys = m.num_polys();
+
+    // feature edges, and number of feature edges incident to each vertex
+    auto key = [](uint a, uint b) -> uint64_t
+    {
+        if(a>b) std::swap(a,b);
+        return (uint64_t(a)<<32) | uint64_t(b);
+    };
+    std::unordered_set<uint64_t> features;
+    std::vector<uint> f_deg(nv, 0);
+    for(uint eid=0; eid<m.num_edges(); ++eid)
+    {
+        if(m.edge_is_boundary(eid) || !m.edge_is_manifold(eid) ||
+           (preserve_marked_features && (m.edge_data(eid).flags[MARKED] || m.edge_data(eid).flags[CREASE])))
+        {
+            uint v0 = m.edge_vert_id(eid,0);
+            uint v1 = m.edge_vert_id(eid,1);
+            features.insert(key(v0,v1));
+            ++f_deg[v0];
+            ++f_deg[v1];
+        }
+    }
+    auto is_corner = [&](const uint vid) -> bool { return f_deg[vid]>0 && f_deg[vid]!=2; };
+
+    // quadrics, stored as the upper triangle of a symmetric 4x4 matrix
+    typedef std::array<double,10> Quadric;
+    auto add_plane = [](Quadric & q, const vec3d & n, const double d, const double w)
+    {
+        q[0] += w*n[0]*n[0]; q[1] += w*n[0]*n[1]; q[2] += w*n[0]*n[2]; q[3] += w*n[0]*d;
+        q[4] += w*n[1]*n[1]; q[5] += w*n[1]*n[2]; q[6] += w*n[1]*d;
+        q[7] += w*n[2]*n[2]; q[8] += w*n[2]*d;
+        q[9] += w*d*d;
+    };
+    auto error = [](const Quadric & q, const vec3d & p) -> double
+    {
+        return     q[0]*p[0]*p[0] + 2*q[1]*p[0]*p[1] + 2*q[2]*p[0]*p[2] + 2*q[3]*p[0]
+                 +   q[4]*p[1]*p[1] + 2*q[5]*p[1]*p[2] + 2*q[6]*p[1]
+                 +   q[7]*p[2]*p[2] + 2*q[8]*p[2]
+                 +   q[9];
+    };
+
+    // fundamental quadrics (face planes weighted by area) plus
+    // penalty planes orthogonal to the faces along the features
+    std::vector<Quadric> Q(nv);
+    PARALLEL_FOR(0, nv, 1000, [&](uint vid)
+    {
+        Quadric & q = Q[vid];
+        q.fill(0.0);
+        for(uint pid : m.adj_v2p(vid))
+        {
+            vec3d  n = (m.poly_vert(pid,1)-m.poly_vert(pid,0)).cross(m.poly_vert(pid,2)-m.poly_vert(pid,0));
+            double l = n.norm();
+            if(l==0) continue;
+            n /= l;
+            add_plane(q, n, -n.dot(m.poly_vert(pid,0)), 0.5*l);
+        }
+        for(uint eid : m.adj_v2e(vid))
+        {
+            if(features.count(key(m.edge_vert_id(eid,0), m.edge_vert_id(eid,1)))==0) continue;
+            vec3d e = m.edge_vert(eid,1) - m.edge_vert(eid,0);
+            for(uint pid : m.adj_e2p(eid))
+            {
+                vec3d n = (m.poly_vert(pid,1)-m.poly_vert(pid,0)).cross(m.poly_vert(pid,2)-m.poly_vert(pid,0));
+                vec3d c = e.cross(n);
+                double l = c.norm();
+                if(l==0) continue;
+                c /= l;
+                add_plane(q, c, -c.dot(m.vert(vid)), feature_weight*e.norm_sqrd());
+            }
+        }
+    });
+
+    // collapse candidates (min heap of costs)
+    struct Candidate
+    {
+        double cost;
+        double length; // breaks ties (e.g. on flat regions) in favor of short edges
+        uint   keep, rem;
+        uint   s_keep, s_rem;
+        vec3d  pos;
+        bool operator<(const Candidate & c) const
+        {
+            return (cost!=c.cost) ? (cost > c.cost) : (length > c.length);
+        }
+    };
+
+    auto make_candidate = [&](const uint a, const uint b, Candidate & c) -> bool
+    {
+        bool fa = f_deg[a]>0;
+        bool fb = f_deg[b]>0;
+        if(fa && fb && (features.count(key(a,b))==0 || (is_corner(a) && is_corner(b)))) return false;
+
+        Quadric q;
+        for(uint i=0; i<10; ++i) q[i] = Q[a][i] + Q[b][i];
+
+        if(is_corner(a) || (fa && !fb))
+        {
+            c.keep = a;
+            c.rem  = b;
+            c.pos  = pos[a];
+        }
+        else if(is_corner(b) || (fb && !fa))
+        {
+            c.keep = b;
+            c.rem  = a;
+            c.pos  = pos[b];
+        }
+        else
+        {
+            c.keep = std::min(a,b);
+            c.rem  = std::max(a,b);
+
+            // optimal placement, if the quadric is well conditioned.
+            // Otherwise, the best among the endpoints and the midpoint
+            mat3d  A({q[0], q[1], q[2],
+                      q[1], q[4], q[5],
+                      q[2], q[5], q[7]});
+            double s = std::fabs(q[0]) + std::fabs(q[4]) + std::fabs(q[7]);
+            if(std::fabs(A.det()) > 1e-10*s*s*s)
+            {
+                c.pos = A.inverse() * vec3d(-q[3], -q[6], -q[8]);
+            }
+            else
+            {
+                vec3d  mid   = 0.5*(pos[a]+pos[b]);
+                double e_a   = error(q, pos[a]);
+                double e_b   = error(q, pos[b]);
+                double e_mid = error(q, mid);
+                c.pos = (e_mid<=e_a && e_mid<=e_b) ? mid : ((e_a<=e_b) ? pos[a] : pos[b]);
+            }
+        }
+        c.cost   = std::max(0.0, error(q, c.pos));
+        c.length = pos[a].dist_sqrd(pos[b]);
+        c.s_keep = stamp[c.keep];
+        c.s_rem  = stamp[c.rem];
+        return true;
+    };
+
+    std::vector<Candidate> init(m.num_edges());
+    std::vector<uint8_t>   valid(m.num_edges());
+    PARALLEL_FOR(0, m.num_edges(), 1000, [&](uint eid)
+    {
+        valid[eid] = make_candidate(m.edge_vert_id(eid,0), m.edge_vert_id(eid,1), init[eid]);
+    });
+    uint n_valid = 0;
+    for(uint eid=0; eid<m.num_edges(); ++eid) if(valid[eid]) init[n_valid++] = init[eid];
+    init.resize(n_valid);
+    std::priority_queue<Candidate> heap(std::less<Candidate>(), std::move(init));
+
+    // one ring of a vertex (alive triangles only)
+    auto one_ring = [&](const uint vid, std::vector<uint> & ring)
+    {
+        ring.clear();
+        for(uint tid : v2t[vid])
+        {
+            if(!t_alive[tid]) continue;
+            for(uint i=0; i<3; ++i) if(tris[3*tid+i]!=vid) ring.push_back(tris[3*tid+i]);
+        }
+        std::sort(ring.begin(), ring.end());
+        ring.erase(std::unique(ring.begin(), ring.end()), ring.end());
+    };
+
+    auto drop_dead_tris = [&](const uint vid)
+    {
+        auto & l = v2t[vid];
+        l.erase(std::remove_if(l.begin(), l.end(), [&](const uint tid){ return !t_alive[tid]; }), l.end());
+    };
+
+    std::vector<uint> ring_keep, ring_rem, shared, opp, common, changed;
+    while(n_polys>target_polys && !heap.empty())
+    {
+        Candidate c = heap.top();
+        heap.pop();
+
+        if(!v_alive[c.keep] || !v_alive[c.rem])                     continue;
+        if(stamp[c.keep]!=c.s_keep || stamp[c.rem]!=c.s_rem) continue;
+
+        // topological check (link condition): the only vertices adjacent to
+        // both endpoints must be the tips of the triangles incident to the edge
+        shared.clear();
+        opp.clear();
+        for(uint tid : v2t[c.rem])
+        {
+            if(!t_alive[tid]) continue;
+            const uint * t = &tris[3*tid];
+            if(t[0]!=c.keep && t[1]!=c.keep && t[2]!=c.keep) continue;
+            shared.push_back(tid);
+            for(uint i=0; i<3; ++i) if(t[i]!=c.keep && t[i]!=c.rem) opp.push_back(t[i]);
+        }
+        if(shared.empty() || shared.size()>2) continue;
+        if(opp.size()==2 && opp[0]==opp[1]) continue;
+        one_ring(c.keep, ring_keep);
+        one_ring(c.rem,  ring_rem);
+        common.clear();
+        std::set_intersection(ring_keep.begin(), ring_keep.end(), ring_rem.begin(), ring_rem.end(), std::back_inserter(common));
+        if(common.size()!=opp.size()) continue;
+
+        // geometric check: no triangle can flip or degenerate
+        bool flips = false;
+        for(uint vid : {c.keep, c.rem})
+        {
+            for(uint tid : v2t[vid])
+            {
+                if(!t_alive[tid] || std::find(shared.begin(), shared.end(), tid)!=shared.end()) continue;
+                const uint * t = &tris[3*tid];
+                vec3d p[3] = { pos[t[0]], pos[t[1]], pos[t[2]] };
+                vec3d n_old = (p[1]-p[0]).cross(p[2]-p[0]);
+                for(uint i=0; i<3; ++i) if(t[i]==vid) p[i] = c.pos;
+                vec3d n_new = (p[1]-p[0]).cross(p[2]-p[0]);
+                if(n_new.dot(n_old)<=0) { flips = true; break; }
+            }
+            if(flips) break;
+        }
+        if(flips) continue;
+
+        // collapse
+        for(uint tid : shared) t_alive[tid] = false;
+        n_polys -= uint(shared.size());
+        pm.add_collapse(c.keep, c.rem, c.pos, shared);
+
+        for(uint tid : v2t[c.rem])
+        {
+            if(!t_alive[tid]) continue;
+            for(uint i=0; i<3; ++i) if(tris[3*tid+i]==c.rem) tris[3*tid+i] = c.keep;
+            v2t[c.keep].push_back(tid);
+        }
+        v2t[c.rem].clear();
+        v2t[c.rem].shrink_to_fit();
+        drop_dead_tris(c.keep);
+        for(uint vid : opp) drop_dead_tris(vid);
+
+        pos[c.keep] = c.pos;
+        for(uint i=0; i<10; ++i) Q[c.keep][i] += Q[c.rem][i];
+        v_alive[c.rem] = false;
+        ++stamp[c.keep];
+        ++stamp[c.rem];
+
+        // move the features of rem to keep. Vertices that see two of their
+        // feature edges merge into one change status, and must be updated too
+        changed.assign(1, c.keep);
+        for(uint vid : ring_rem)
+        {
+            if(features.erase(key(c.rem,vid))==0) continue;
+            --f_deg[c.rem];
+            --f_deg[vid];
+            if(vid==c.keep) continue;
+            if(features.insert(key(c.keep,vid)).second)
+            {
+                ++f_deg[c.keep];
+                ++f_deg[vid];
+            }
+            else
+            {
+                ++stamp[vid];
+                changed.push_back(vid);
+            }
+        }
+
+        // refresh the costs of all the edges around the updated vertices
+        for(uint vid : changed)
+        {
+            one_ring(vid, ring_keep);
+            for(uint nbr : ring_keep)
+            {
+                Candidate cc;
+                if(make_candidate(vid, nbr, cc)) heap.push(cc);
+            }
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void QEM_simplify(Trimesh<M,V,E,P> & m,
+                  const uint         target_polys,
+                  const bool         preserve_marked_features)
+{
+    ProgressiveMesh pm;
+    QEM_simplify(m, target_polys, pm, preserve_marked_features);
+
+    std::vector<vec3d> verts;
+    std::vector<uint>  tris;
+    pm.extract(pm.num_levels()-1, verts, tris);
+    m = Trimesh<M,V,E,P>(verts, tris);
+}
+
+}
@@ -0,0 +1,91 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_QEM_SIMPLIFICATION_H
+#define CINO_QEM_SIMPLIFICATION_H
+
+#include <cinolib/meshes/trimesh.h>
+#include <cinolib/progressive_mesh.h>
+
+namespace cinolib
+{
+
+/* Priority driven simplification of a triangle mesh, based on the quadric error
+ * metric described in:
+ *
+ *     Surface Simplification Using Quadric Error Metrics
+ *     M.Garland, P.S.Heckbert
+ *     ACM SIGGRAPH (1997)
+ *
+ * Edges are collapsed in order of increasing quadric error, and the costs of the
+ * edges around each collapsed vertex are refreshed incrementally (heap entries
+ * made obsolete by a collapse are discarded lazily). Collapses that would change
+ * the topology (link condition) or flip triangles are rejected. The simplification
+ * stops when the mesh has at most target_polys triangles, or no edge can be
+ * collapsed any more.
+ *
+ * Boundary edges are always preserved as features. If preserve_marked_features is
+ * true, also the edges flagged as MARKED or CREASE are. Feature edges can only be
+ * collapsed along the feature lines they belong to: penalty planes orthogonal to
+ * the adjacent triangles (scaled by feature_weight) keep the vertices on the lines,
+ * vertices incident to one feature line are never pulled away from it, and the
+ * corners (vertices with one or more than two incident feature edges) never move.
+ *
+ * The whole sequence of collapses is recorded into a ProgressiveMesh, from which
+ * any intermediate level of detail can be extracted (see progressive_mesh.h)
+*/
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void QEM_simplify(const Trimesh<M,V,E,P> & m,
+                  const uint               target_polys,
+                  ProgressiveMesh        & pm,
+                  const bool               preserve_marked_features = true,
+                  const double             feature_weight = 1e3);
+
+// in place variant: m is replaced by the simplified mesh (attributes are not preserved)
+template<class M, class V, class E, class P>
+CINO_INLINE
+void QEM_simplify(Trimesh<M,V,E,P> & m,
+                  const uint         target_polys,
+                  const bool         preserve_marked_features = true);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "QEM_simplification.cpp"
+#endif
+
+#endif // CINO_QEM_SIMPLIFICATION_H
@@ -34,6 +34,7 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/RBF_Hermite.h>
+#include <cinolib/parallel_for.h>
 
 namespace cinolib
 {
@@ -75,9 +76,11 @@ Hermite_RBF<RBF>::Hermite_RBF(const std::vector<vec3d> & points,
             uint jj = 4*j;
             Eigen::Vector3d diff = p-center.col(j);
             double len=diff.norm();
-            if(len==0)
+            if(len==0) // limit for len->0 (for radial kernels with zero first derivative at the origin)
             {
                 A.template block<4,4>(ii,jj).setZero();
+                A(ii,jj) = RBF::eval_f(0);
+                A.template block<3,3>(ii+1,jj+1).diagonal().array() = RBF::eval_ddf(0);
             }
             else
             {
@@ -108,7 +111,10 @@ CINO_INLINE
 ScalarField Hermite_RBF<RBF>::eval(const std::vector<vec3d> & plist) const
 {
     ScalarField f(uint(plist.size()));
-    for(uint i=0; i<plist.size(); ++i) f[i] = eval(plist.at(i));
+    PARALLEL_FOR(0, plist.size(), 100, [&](const uint i)
+    {
+        f[i] = eval(plist.at(i));
+    });
     return f;
 }
 
@@ -124,11 +130,8 @@ double Hermite_RBF<RBF>::eval(const vec3d & p) const
     {
         Eigen::Vector3d diff = pp-center.col(i);
         double l = diff.norm();
-        if(l>0)
-        {
-            val += alpha(i) * RBF::eval_f(l);
-            val += beta.col(i).dot(diff)*RBF::eval_df(l)/l;
-        }
+        val += alpha(i) * RBF::eval_f(l);
+        if(l>0) val += beta.col(i).dot(diff)*RBF::eval_df(l)/l;
     }
     return val;
 }
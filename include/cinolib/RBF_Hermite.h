@@ -60,6 +60,10 @@ namespace cinolib
  *     A Closed-Form Formulation of HRBF-Based Surface Reconstruction
  *     S. Liu, C.C.L. Wang, G. Brunnett, J. Wang
  *     Computer-Aided Design (2016)
+ *
+ * The system is dense and costs O(n^3), hence this class is meant for a few thousands
+ * points at most. For larger point sets, use the partition of unity scheme implemented
+ * in RBF_Hermite_PU.h
 */
 
 template<class RBF>
@@ -73,7 +77,7 @@ class Hermite_RBF
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        ScalarField eval     (const std::vector<vec3d> & plist) const; // evaluate RBF at points plist
+        ScalarField eval     (const std::vector<vec3d> & plist) const; // evaluate RBF at points plist (in parallel)
         double      eval     (const vec3d & p) const;                  // evaluate RBF at point p
         vec3d       eval_grad(const vec3d & p) const;                  // evaluate nabla RBF at point p
 
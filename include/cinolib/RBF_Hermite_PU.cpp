@@ -0,0 +1,365 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/RBF_Hermite_PU.h>
+#include <cinolib/parallel_for.h>
+#include <numeric>
+#include <queue>
+
+namespace cinolib
+{
+
+template<class RBF>
+CINO_INLINE
+Hermite_RBF_PU<RBF>::Hermite_RBF_PU(const std::vector<vec3d> & points,
+                                    const std::vector<vec3d> & normals,
+                                    const uint                 points_per_patch,
+                                    const double               overlap,
+                                    const uint                 max_depth)
+{
+    assert(points.size()==normals.size());
+    assert(points_per_patch>1 && overlap>1);
+    if(points.empty()) return;
+
+    // recursively split the (cubic) bounding box of the points, sorting point ids
+    // so that the points of each cell occupy a contiguous range of the ids array
+    std::vector<uint> ids(points.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    std::vector<uint> beg(1,0), end(1,uint(points.size())), depth(1,0);
+    {
+        AABB bb(points);
+        vec3d  c = bb.center();
+        double h = std::max(bb.delta().max_entry()*0.5*1.001, 1e-10); // half side
+        Node root;
+        root.box = AABB(c-vec3d(h,h,h), c+vec3d(h,h,h));
+        nodes.push_back(root);
+    }
+    std::vector<uint> leaves;
+    for(uint nid=0; nid<nodes.size(); ++nid)
+    {
+        if(end[nid]-beg[nid]<=points_per_patch || depth[nid]==max_depth)
+        {
+            if(end[nid]>beg[nid]) leaves.push_back(nid);
+            continue;
+        }
+
+        // partition the points into the 8 octants (counting sort on the octant code)
+        vec3d c = nodes[nid].box.center();
+        auto octant = [&](const uint vid) -> uint
+        {
+            const vec3d & p = points.at(vid);
+            return (p.x()>c.x()) | ((p.y()>c.y())<<1) | ((p.z()>c.z())<<2);
+        };
+        uint count[9] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+        for(uint i=beg[nid]; i<end[nid]; ++i) ++count[octant(ids[i])+1];
+        for(uint i=1; i<9; ++i) count[i] += count[i-1];
+        std::vector<uint> tmp(end[nid]-beg[nid]);
+        uint off[8];
+        std::copy(count, count+8, off);
+        for(uint i=beg[nid]; i<end[nid]; ++i) tmp[off[octant(ids[i])]++] = ids[i];
+        std::copy(tmp.begin(), tmp.end(), ids.begin()+beg[nid]);
+
+        nodes[nid].first_child = int(nodes.size());
+        for(uint i=0; i<8; ++i)
+        {
+            vec3d p0 = nodes[nid].box.min;
+            vec3d p1 = c;
+            if(i&1) { p0.x() = c.x(); p1.x() = nodes[nid].box.max.x(); }
+            if(i&2) { p0.y() = c.y(); p1.y() = nodes[nid].box.max.y(); }
+            if(i&4) { p0.z() = c.z(); p1.z() = nodes[nid].box.max.z(); }
+            Node child;
+            child.box = AABB(p0,p1);
+            nodes.push_back(child);
+            beg.push_back(beg[nid]+count[i]);
+            end.push_back(beg[nid]+count[i+1]);
+            depth.push_back(depth[nid]+1);
+        }
+    }
+
+    // the points inside a sphere, found by traversing the hierarchy
+    auto points_in_sphere = [&](const vec3d & c, const double r, std::vector<uint> & res)
+    {
+        res.clear();
+        std::vector<uint> stack(1,0);
+        while(!stack.empty())
+        {
+            uint nid = stack.back();
+            stack.pop_back();
+            if(nodes[nid].box.dist_sqrd(c)>r*r) continue;
+            if(nodes[nid].first_child>=0)
+            {
+                for(int i=0; i<8; ++i) stack.push_back(nodes[nid].first_child+i);
+            }
+            else
+            {
+                for(uint i=beg[nid]; i<end[nid]; ++i) if(points.at(ids[i]).dist_sqrd(c)<r*r) res.push_back(ids[i]);
+            }
+        }
+    };
+
+    // setup and solve the local interpolation problems (in parallel)
+    uint   min_points = std::min(points_per_patch, uint(points.size()));
+    double min_radius = nodes[0].box.diag()*0.5/double(1<<std::min(max_depth,30u));
+    patches.resize(leaves.size());
+    patch_center.resize(leaves.size());
+    patch_radius.resize(leaves.size());
+    for(uint i=0; i<leaves.size(); ++i) nodes[leaves[i]].patch = int(i);
+    PARALLEL_FOR(0, leaves.size(), 4, [&](const uint i)
+    {
+        // the support is fit to the bounding box of the points in the cell rather than to
+        // the cell itself, otherwise large cells with few points would produce huge supports
+        uint  nid = leaves[i];
+        AABB  box;
+        for(uint j=beg[nid]; j<end[nid]; ++j) box.push(points.at(ids[j]));
+        vec3d  c = box.center();
+        double r = std::max(overlap*box.diag()*0.5, min_radius);
+        std::vector<uint> in;
+        points_in_sphere(c, r, in);
+        while(in.size()<min_points) // enlarge sparsely sampled patches
+        {
+            r *= overlap;
+            points_in_sphere(c, r, in);
+        }
+        // coincident points would make the local system singular (scans often contain duplicates)
+        std::sort(in.begin(), in.end(), [&](const uint a, const uint b) { return points.at(a)<points.at(b); });
+        in.erase(std::unique(in.begin(), in.end(), [&](const uint a, const uint b) { return points.at(a)==points.at(b); }), in.end());
+        std::vector<vec3d> p(in.size()), n(in.size());
+        for(uint j=0; j<in.size(); ++j)
+        {
+            p[j] = (points.at(in[j])-c)/r;
+            n[j] = normals.at(in[j]);
+        }
+        patches[i]      = Hermite_RBF<RBF>(p,n);
+        patch_center[i] = c;
+        patch_radius[i] = r;
+    });
+
+    // bottom-up computation of support boxes and representative patches
+    // (children always follow their parent in the nodes vector)
+    for(int nid=int(nodes.size())-1; nid>=0; --nid)
+    {
+        Node & node = nodes[nid];
+        if(node.patch>=0)
+        {
+            vec3d  c = patch_center[node.patch];
+            double r = patch_radius[node.patch];
+            node.support = AABB(c-vec3d(r,r,r), c+vec3d(r,r,r));
+            node.rep     = node.patch;
+        }
+        else if(node.first_child>=0)
+        {
+            double best_d = inf_double;
+            for(int i=0; i<8; ++i)
+            {
+                const Node & child = nodes[node.first_child+i];
+                if(child.rep<0) continue; // empty subtree
+                node.support.push(child.support);
+                double d = node.box.center().dist_sqrd(patch_center[child.rep]);
+                if(d<best_d)
+                {
+                    best_d   = d;
+                    node.rep = child.rep;
+                }
+            }
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class RBF>
+CINO_INLINE
+ScalarField Hermite_RBF_PU<RBF>::eval(const std::vector<vec3d> & plist) const
+{
+    ScalarField f(uint(plist.size()));
+    PARALLEL_FOR(0, plist.size(), 100, [&](const uint i)
+    {
+        f[i] = eval(plist.at(i));
+    });
+    return f;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class RBF>
+CINO_INLINE
+double Hermite_RBF_PU<RBF>::eval(const vec3d & p) const
+{
+    if(patches.empty()) return 0;
+
+    std::vector<uint> ids;
+    patches_at(p, ids);
+
+    double num = 0;
+    double den = 0;
+    for(uint pid : ids)
+    {
+        double r = patch_radius[pid];
+        double w = WendlandRBF::eval_f(p.dist(patch_center[pid])/r);
+        if(w>0)
+        {
+            num += w*r*patches[pid].eval((p-patch_center[pid])/r);
+            den += w;
+        }
+    }
+    if(den>0) return num/den;
+
+    // not covered by any support: extrapolate the closest patch
+    uint pid = closest_patch(p);
+    return patch_radius[pid]*patches[pid].eval((p-patch_center[pid])/patch_radius[pid]);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class RBF>
+CINO_INLINE
+vec3d Hermite_RBF_PU<RBF>::eval_grad(const vec3d & p) const
+{
+    if(patches.empty()) return vec3d(0,0,0);
+
+    std::vector<uint> ids;
+    patches_at(p, ids);
+
+    // grad(sum w_i f_i / sum w_i) = (sum (grad(w_i) f_i + w_i grad(f_i)) - f grad(sum w_i)) / sum w_i
+    double num = 0, den = 0;
+    vec3d  grad_num(0,0,0), grad_den(0,0,0);
+    for(uint pid : ids)
+    {
+        double r = patch_radius[pid];
+        vec3d  d = p-patch_center[pid];
+        double l = d.norm();
+        double w = WendlandRBF::eval_f(l/r);
+        if(w>0)
+        {
+            vec3d  q  = d/r;
+            double fi = r*patches[pid].eval(q);
+            vec3d  gw = (l>0) ? d*(WendlandRBF::eval_df(l/r)/(r*l)) : vec3d(0,0,0);
+            num      += w*fi;
+            den      += w;
+            grad_num += gw*fi + patches[pid].eval_grad(q)*w;
+            grad_den += gw;
+        }
+    }
+    if(den>0) return (grad_num - grad_den*(num/den))/den;
+
+    // not covered by any support: extrapolate the closest patch
+    uint pid = closest_patch(p);
+    return patches[pid].eval_grad((p-patch_center[pid])/patch_radius[pid]);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class RBF>
+CINO_INLINE
+void Hermite_RBF_PU<RBF>::patches_at(const vec3d & p, std::vector<uint> & ids) const
+{
+    ids.clear();
+    std::vector<uint> stack(1,0);
+    while(!stack.empty())
+    {
+        const Node & node = nodes[stack.back()];
+        stack.pop_back();
+        if(!node.support.contains(p)) continue;
+        if(node.first_child>=0)
+        {
+            for(int i=0; i<8; ++i) stack.push_back(node.first_child+i);
+        }
+        else if(node.patch>=0 && p.dist_sqrd(patch_center[node.patch])<patch_radius[node.patch]*patch_radius[node.patch])
+        {
+            ids.push_back(node.patch);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// best first search over the cell hierarchy (patch centers lie inside their cell),
+// initialized with the closest representative patch along the path to the cell that
+// contains p. The search is approximate: it returns a patch at most 25% farther than
+// the closest one. This has no practical impact on the extrapolated values, but avoids
+// visiting the whole tree when p is almost equidistant from many patches (e.g. the
+// center of a sphere)
+template<class RBF>
+CINO_INLINE
+uint Hermite_RBF_PU<RBF>::closest_patch(const vec3d & p) const
+{
+    uint   best   = 0;
+    double best_d = inf_double;
+    auto test = [&](const int pid)
+    {
+        if(pid<0) return;
+        double d = p.dist_sqrd(patch_center[pid]);
+        if(d<best_d)
+        {
+            best_d = d;
+            best   = uint(pid);
+        }
+    };
+
+    vec3d q   = nodes[0].box.point_closest_to(p);
+    int   nid = 0;
+    while(nodes[nid].first_child>=0)
+    {
+        vec3d c = nodes[nid].box.center();
+        int   first = nodes[nid].first_child;
+        for(int i=0; i<8; ++i) test(nodes[first+i].rep);
+        nid = first + ((q.x()>c.x()) | ((q.y()>c.y())<<1) | ((q.z()>c.z())<<2));
+    }
+    test(nodes[nid].rep);
+
+    typedef std::pair<double,uint> Obj; // (distance lower bound, node)
+    std::priority_queue<Obj,std::vector<Obj>,std::greater<Obj>> pq;
+    pq.push(std::make_pair(nodes[0].box.dist_sqrd(p),0));
+    const double eps = 1.25*1.25; // squared
+    while(!pq.empty() && pq.top().first*eps<best_d)
+    {
+        const Node & node = nodes[pq.top().second];
+        pq.pop();
+        if(node.first_child>=0)
+        {
+            for(int i=0; i<8; ++i)
+            {
+                const Node & child = nodes[node.first_child+i];
+                if(child.rep<0) continue; // no patches below
+                double d = child.box.dist_sqrd(p);
+                if(d*eps<best_d) pq.push(std::make_pair(d, uint(node.first_child+i)));
+            }
+        }
+        else test(node.patch);
+    }
+    return best;
+}
+
+}
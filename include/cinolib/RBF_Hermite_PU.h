@@ -0,0 +1,125 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_RBF_HERMITE_PU_H
+#define CINO_RBF_HERMITE_PU_H
+
+#include <cinolib/RBF_Hermite.h>
+#include <cinolib/RBF_kernels.h>
+#include <cinolib/geometry/aabb.h>
+
+namespace cinolib
+{
+
+/* Partition of unity variant of Hermite RBF interpolation, meant for large point sets
+ * (e.g. surface reconstruction from scans with millions of oriented points).
+ *
+ * The bounding box of the points is recursively split into octants until each cell
+ * contains at most points_per_patch points. Each non empty cell becomes a patch: a
+ * spherical support enclosing the bounding box of the points in the cell, enlarged by
+ * overlap (and further, if needed, until it contains at least points_per_patch points),
+ * inside which a local (dense) Hermite RBF interpolates all the points in the support. The global implicit function is the blend of the local ones,
+ * weighted with Wendland's compactly supported kernel
+ *
+ *     f(p) = sum_i w_i(p) f_i(p) / sum_i w_i(p)
+ *
+ * Local systems are small and independent, hence the construction is linear in the
+ * number of points and runs in parallel. Evaluation only visits the handful of patches
+ * whose support contains the query point (found by traversing the cell hierarchy), and
+ * falls back to the closest patch for points that are not covered by any support.
+ * Both methods are thread safe, hence f can be directly plugged into voxelize, or used
+ * to evaluate the scalar field of a tetmesh to be fed to marching_tets.
+ *
+ * Reference academic resource for the partition of unity approach is:
+ *
+ *     Multi-level partition of unity implicits
+ *     Y. Ohtake, A. Belyaev, M. Alexa, G. Turk, H.P. Seidel
+ *     ACM Transactions on Graphics (2003)
+*/
+
+template<class RBF>
+class Hermite_RBF_PU
+{
+    public:
+
+        Hermite_RBF_PU(){}
+        Hermite_RBF_PU(const std::vector<vec3d> & points,
+                       const std::vector<vec3d> & normals,
+                       const uint                 points_per_patch = 24,
+                       const double               overlap          = 1.25,
+                       const uint                 max_depth        = 16);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        ScalarField eval     (const std::vector<vec3d> & plist) const; // evaluate RBF at points plist (in parallel)
+        double      eval     (const vec3d & p) const;                  // evaluate RBF at point p
+        vec3d       eval_grad(const vec3d & p) const;                  // evaluate nabla RBF at point p
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint num_patches() const { return uint(patches.size()); }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        struct Node
+        {
+            AABB box;               // octant
+            AABB support;           // bounding box of the supports of all the patches below this node
+            int  first_child = -1;  // index of the first of the 8 children in nodes (-1 for leaves)
+            int  patch       = -1;  // for leaves: index of the patch (-1 for empty cells)
+            int  rep         = -1;  // representative patch of the subtree (-1 if there are no patches below)
+        };
+
+        // each local interpolant is computed in coordinates normalized w.r.t. its support
+        // (i.e. q = (p-center)/radius) and scaled back by radius, so that all interpolants
+        // have the same units and their gradient matches the input normals
+        std::vector<Hermite_RBF<RBF>> patches;
+        std::vector<vec3d>            patch_center;
+        std::vector<double>           patch_radius;
+        std::vector<Node>             nodes; // cell hierarchy (nodes[0] is the root)
+
+    protected:
+
+        void patches_at    (const vec3d & p, std::vector<uint> & ids) const; // patches whose support contains p
+        uint closest_patch (const vec3d & p) const; // fallback for points not covered by any support
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "RBF_Hermite_PU.cpp"
+#endif
+
+#endif // CINO_RBF_HERMITE_PU_H
@@ -47,6 +47,18 @@ class CubicRBF
     static inline double eval_ddf(const double x) { return 6*x;   } // second derivative
 };
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Wendland's C2 compactly supported kernel (support radius 1)
+// Also used as blending weight in partition of unity schemes (see RBF_Hermite_PU.h)
+class WendlandRBF
+{
+    public:
+    static inline double eval_f  (const double x) { return (x<1) ? (1-x)*(1-x)*(1-x)*(1-x)*(4*x+1) : 0; }
+    static inline double eval_df (const double x) { return (x<1) ? -20*x*(1-x)*(1-x)*(1-x)         : 0; } // first  derivative
+    static inline double eval_ddf(const double x) { return (x<1) ? 20*(1-x)*(1-x)*(4*x-1)          : 0; } // second derivative
+};
+
 }
 
 #endif // CINO_RBF_KERNELS_H
@@ -104,7 +104,7 @@ void ambient_occlusion(AbstractPolygonMesh<M,V,E,P> & m, AO_data & data)
     for(uint pid=0; pid<m.num_polys(); ++pid)
     {
         // https://stats.stackexchange.com/questions/214877/is-there-a-formula-for-an-s-shaped-curve-with-domain-and-range-0-1
-        m.poly_data(pid).AO = 1.f/(1.f+std::pow(ao_m.at(pid)/(1.f-ao_m.at(pid)),-data.contrast));
+        m.poly_AO(pid) = 1.f/(1.f+std::pow(ao_m.at(pid)/(1.f-ao_m.at(pid)),-data.contrast));
     }
 
     if(data.with_floor)
@@ -120,7 +120,7 @@ void ambient_occlusion(AbstractPolygonMesh<M,V,E,P> & m, AO_data & data)
         for(uint pid=0; pid<data.floor.num_polys(); ++pid)
         {
             // https://stats.stackexchange.com/questions/214877/is-there-a-formula-for-an-s-shaped-curve-with-domain-and-range-0-1
-            data.floor.poly_data(pid).AO = 1.f/(1.f+std::pow(ao_f.at(pid)/(1.f-ao_f.at(pid)),-data.contrast_floor));
+            data.floor.poly_AO(pid) = 1.f/(1.f+std::pow(ao_f.at(pid)/(1.f-ao_f.at(pid)),-data.contrast_floor));
         }
     }
 }
@@ -148,7 +148,7 @@ void ambient_occlusion(AbstractPolyhedralMesh<M,V,E,F,P> & m, AO_data & data)
     ambient_occlusion(srf,data);
     for(uint pid=0; pid<srf.num_polys(); ++pid)
     {
-        m.face_data(fmap.at(pid)).AO = srf.poly_data(pid).AO;
+        m.face_AO(fmap.at(pid)) = srf.poly_AO(pid);
     }
 }
 
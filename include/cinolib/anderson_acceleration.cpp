@@ -0,0 +1,72 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/anderson_acceleration.h>
+#include <algorithm>
+
+namespace cinolib
+{
+
+CINO_INLINE
+void AndersonAcceleration::compute(const Eigen::VectorXd & u,
+                                   const Eigen::VectorXd & g,
+                                         Eigen::VectorXd & u_next)
+{
+    Eigen::VectorXd f = g - u;
+
+    if(iter==0)
+    {
+        dF.resize(u.size(), window);
+        dG.resize(u.size(), window);
+        u_next = g;
+    }
+    else
+    {
+        uint col = (iter-1)%window;
+        dF.col(col) = f - f_prev;
+        dG.col(col) = g - g_prev;
+
+        // u' = G(u) - dG * theta, with theta = argmin |f - dF * theta|
+        uint k = std::min(iter, window);
+        Eigen::VectorXd theta = dF.leftCols(k).colPivHouseholderQr().solve(f);
+        u_next = g - dG.leftCols(k) * theta;
+    }
+
+    f_prev = f;
+    g_prev = g;
+    ++iter;
+}
+
+}
@@ -0,0 +1,87 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_ANDERSON_ACCELERATION_H
+#define CINO_ANDERSON_ACCELERATION_H
+
+#include <cinolib/cino_inline.h>
+#include <sys/types.h>
+#include <Eigen/Dense>
+
+namespace cinolib
+{
+
+/* Anderson acceleration for fixed point iterations u' = G(u), as described in:
+ *
+ *   Anderson Acceleration for Geometry Optimization and Physics Simulation
+ *   Yue Peng, Bailin Deng, Juyong Zhang, Fanyu Geng, Wenjie Qin, Ligang Liu
+ *   ACM Transactions on Graphics (SIGGRAPH), 2018
+ *
+ * At each step the caller passes the current iterate u and its image G(u),
+ * and gets back the next iterate, which is a combination of the images of
+ * the last (up to) window iterates. The method does not know anything about
+ * the underlying energy, hence callers are expected to check for its decrease
+ * and, if it does not, to fall back to the plain iterate G(u) and call reset().
+*/
+
+class AndersonAcceleration
+{
+    public:
+
+        explicit AndersonAcceleration(const uint window = 5) : window(window) {}
+
+        void reset() { iter = 0; }
+
+        void compute(const Eigen::VectorXd & u,
+                     const Eigen::VectorXd & g,   // G(u)
+                           Eigen::VectorXd & u_next);
+
+    protected:
+
+        uint            window;
+        uint            iter = 0;
+        Eigen::VectorXd f_prev; // previous residual G(u)-u
+        Eigen::VectorXd g_prev; // previous image G(u)
+        Eigen::MatrixXd dF;     // differences of residuals (circular buffer, one per column)
+        Eigen::MatrixXd dG;     // differences of images    (circular buffer, one per column)
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "anderson_acceleration.cpp"
+#endif
+
+#endif // CINO_ANDERSON_ACCELERATION_H
@@ -82,7 +82,7 @@ void canonical_polygonal_schema(      Trimesh<M,V,E,P>  & m_in,
             uint v0 = m_in.edge_vert_id(eid,0);
             uint v1 = m_in.edge_vert_id(eid,1);
             if(m_in.vert_is_boundary(v0) && m_in.vert_is_boundary(v1) &&
-              (m_in.vert_data(v0).label==m_in.vert_data(v1).label))
+              (m_in.vert_label(v0)==m_in.vert_label(v1)))
             {
                 split_list.push_back(eid);
             }
@@ -91,8 +91,8 @@ void canonical_polygonal_schema(      Trimesh<M,V,E,P>  & m_in,
         {
             // restore edge flags and labels around the perimeter of the CPS
             m_in.edge_data(eid).flags[MARKED] = true;
-            m_in.edge_data(eid).label = std::max(m_in.vert_data(m_in.edge_vert_id(eid,0)).label,
-                                                 m_in.vert_data(m_in.edge_vert_id(eid,1)).label);
+            m_in.edge_label(eid) = std::max(m_in.vert_label(m_in.edge_vert_id(eid,0)),
+                                                 m_in.vert_label(m_in.edge_vert_id(eid,1)));
         }
     }
     if(!split_list.empty())
@@ -87,7 +87,7 @@ void compute_coarse_quad_layout(Quadmesh<M,V,E,P> & m)
         bfs_on_dual_w_edge_barriers(m, pid, on_domain_border, patch);
         for(uint p : patch)
         {
-            m.poly_data(p).label  = patch_id;
+            m.poly_label(p)  = patch_id;
             m.poly_data(p).flags[MARKED] = true;
         }
         ++patch_id;
@@ -151,7 +151,7 @@ void compute_coarse_hex_layout(Hexmesh<M,V,E,P> & m)
         bfs_on_dual_w_face_barriers(m, pid, on_domain_border, patch);
         for(uint p : patch)
         {
-            m.poly_data(p).label  = patch_id;
+            m.poly_label(p)  = patch_id;
             m.poly_data(p).flags[MARKED] = true;
         }
         ++patch_id;
@@ -52,9 +52,8 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 ScalarField divergence(const AbstractPolygonMesh<M,V,E,P> & m, ScalarField & f)
 {
-    Eigen::SparseMatrix<double> G    = gradient_matrix(m);
-    VectorField                 grad = G * f;
-    ScalarField                 div  = G.transpose() * grad;
+    GradientOperator G(m);
+    ScalarField      div = G.div(G.grad(f));
     return div;
 }
 
@@ -64,9 +63,8 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 ScalarField divergence(const AbstractPolyhedralMesh<M,V,E,F,P> & m, ScalarField & f)
 {
-    Eigen::SparseMatrix<double> G    = gradient_matrix(m);
-    VectorField                 grad = G * f;
-    ScalarField                 div  = G.transpose() * grad;
+    GradientOperator G(m);
+    ScalarField      div = G.div(G.grad(f));
     return div;
 }
 
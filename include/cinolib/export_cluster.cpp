@@ -57,7 +57,7 @@ void export_cluster(const AbstractPolygonMesh<M,V,E,P>  & m,
     uint fresh_vid = 0;
     for(uint pid=0; pid<m.num_polys(); ++pid)
     {
-        if(CONTAINS(labels,m.poly_data(pid).label))
+        if(CONTAINS(labels,m.poly_label(pid)))
         {
             std::vector<uint> p;
             for(uint off=0; off<m.verts_per_poly(pid); ++off)
@@ -161,7 +161,7 @@ void export_cluster(const AbstractPolyhedralMesh<M,V,E,F,P>  & m,
         uint fresh_vid = 0;
         for(uint pid=0; pid<m.num_polys(); ++pid)
         {
-            if(CONTAINS(labels, m.poly_data(pid).label))
+            if(CONTAINS(labels, m.poly_label(pid)))
             {
                 std::vector<uint> p;
                 for(uint off=0; off<m.verts_per_poly(pid); ++off)
@@ -207,7 +207,7 @@ void export_cluster(const AbstractPolyhedralMesh<M,V,E,F,P>  & m,
             bool has_label = false;
             for(uint pid : m.adj_f2p(fid))
             {
-                if(CONTAINS(labels,m.poly_data(pid).label)) has_label = true;
+                if(CONTAINS(labels,m.poly_label(pid))) has_label = true;
             }
             if (has_label) f_list.push_back(fid);
         }
@@ -242,7 +242,7 @@ void export_cluster(const AbstractPolyhedralMesh<M,V,E,F,P>  & m,
 
         for(uint pid=0; pid<m.num_polys(); ++pid)
         {
-            if(CONTAINS(labels, m.poly_data(pid).label))
+            if(CONTAINS(labels, m.poly_label(pid)))
             {
                 std::vector<uint> p;
                 std::vector<bool> w;
@@ -50,7 +50,7 @@ void export_mesh_from_clusters(const AbstractPolygonMesh<M,V,E,P> & m,
     for(uint eid=0; eid<m.num_edges(); ++eid)
     {
         std::unordered_set<int> labels;
-        for(uint pid : m.adj_e2p(eid)) labels.insert(m.poly_data(pid).label);
+        for(uint pid : m.adj_e2p(eid)) labels.insert(m.poly_label(pid));
 
         if(m.edge_valence(eid)==labels.size())
         {
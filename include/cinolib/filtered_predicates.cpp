@@ -0,0 +1,180 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/filtered_predicates.h>
+#include <cinolib/predicates.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace cinolib
+{
+
+// results are computed in round-to-nearest and then moved one ulp outwards,
+// which is enough to enclose the exact result of a single operation
+
+CINO_INLINE
+Interval operator+(const Interval & a, const Interval & b)
+{
+    return { std::nextafter(a.lo + b.lo, -std::numeric_limits<double>::infinity()),
+             std::nextafter(a.hi + b.hi,  std::numeric_limits<double>::infinity()) };
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Interval operator-(const Interval & a, const Interval & b)
+{
+    return { std::nextafter(a.lo - b.hi, -std::numeric_limits<double>::infinity()),
+             std::nextafter(a.hi - b.lo,  std::numeric_limits<double>::infinity()) };
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Interval operator*(const Interval & a, const Interval & b)
+{
+    double p0 = a.lo*b.lo;
+    double p1 = a.lo*b.hi;
+    double p2 = a.hi*b.lo;
+    double p3 = a.hi*b.hi;
+    return { std::nextafter(std::min({p0,p1,p2,p3}), -std::numeric_limits<double>::infinity()),
+             std::nextafter(std::max({p0,p1,p2,p3}),  std::numeric_limits<double>::infinity()) };
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// returns the certified sign of orient2d (+1,-1), or 0 if the filter fails
+template<class T>
+CINO_INLINE
+int orient2d_interval_filter(const T * pa,
+                             const T * pb,
+                             const T * pc,
+                                   bool & all_doubles)
+{
+    Interval ax = IntervalTraits<T>::to_interval(pa[0]);
+    Interval ay = IntervalTraits<T>::to_interval(pa[1]);
+    Interval bx = IntervalTraits<T>::to_interval(pb[0]);
+    Interval by = IntervalTraits<T>::to_interval(pb[1]);
+    Interval cx = IntervalTraits<T>::to_interval(pc[0]);
+    Interval cy = IntervalTraits<T>::to_interval(pc[1]);
+
+    all_doubles = (ax.lo==ax.hi && ay.lo==ay.hi &&
+                   bx.lo==bx.hi && by.lo==by.hi &&
+                   cx.lo==cx.hi && cy.lo==cy.hi);
+
+    Interval det = (ax - cx)*(by - cy) - (ay - cy)*(bx - cx);
+    if(det.lo>0) return  1;
+    if(det.hi<0) return -1;
+    return 0; // uncertain (NaNs also end up here)
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+int orient2d_exact_sign(const T * pa,
+                        const T * pb,
+                        const T * pc,
+                        const bool all_doubles)
+{
+#ifdef CINOLIB_USES_SHEWCHUK_PREDICATES
+    if(all_doubles)
+    {
+        double a[2] = { IntervalTraits<T>::to_interval(pa[0]).lo, IntervalTraits<T>::to_interval(pa[1]).lo };
+        double b[2] = { IntervalTraits<T>::to_interval(pb[0]).lo, IntervalTraits<T>::to_interval(pb[1]).lo };
+        double c[2] = { IntervalTraits<T>::to_interval(pc[0]).lo, IntervalTraits<T>::to_interval(pc[1]).lo };
+        double det  = orient2d(a,b,c);
+        return (det>0) ? 1 : ((det<0) ? -1 : 0);
+    }
+#else
+    (void)all_doubles;
+#endif
+    T det = (pa[0] - pc[0])*(pb[1] - pc[1]) - (pa[1] - pc[1])*(pb[0] - pc[0]);
+    return (det>0) ? 1 : ((det<0) ? -1 : 0);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+int orient2d_sign(const T * pa,
+                  const T * pb,
+                  const T * pc)
+{
+    bool all_doubles;
+    int  s = orient2d_interval_filter(pa, pb, pc, all_doubles);
+    if(s!=0) return s;
+    return orient2d_exact_sign(pa, pb, pc, all_doubles);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+uint orient2d_sign_batch(const T    * coords,
+                         const uint   stride,
+                         const uint * tris,
+                         const uint   n_tris,
+                               int  * res)
+{
+    // first pass: interval filter only. Uncertain predicates are collected and
+    // evaluated exactly in a second pass, keeping the first loop tight
+    std::vector<uint> uncertain;
+    std::vector<bool> all_doubles;
+    for(uint i=0; i<n_tris; ++i)
+    {
+        bool d;
+        res[i] = orient2d_interval_filter(coords + tris[3*i  ]*stride,
+                                          coords + tris[3*i+1]*stride,
+                                          coords + tris[3*i+2]*stride, d);
+        if(res[i]==0)
+        {
+            uncertain.push_back(i);
+            all_doubles.push_back(d);
+        }
+    }
+    for(uint j=0; j<uncertain.size(); ++j)
+    {
+        uint i = uncertain[j];
+        res[i] = orient2d_exact_sign(coords + tris[3*i  ]*stride,
+                                     coords + tris[3*i+1]*stride,
+                                     coords + tris[3*i+2]*stride, all_doubles[j]);
+    }
+    return uncertain.size();
+}
+
+}
@@ -0,0 +1,122 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_FILTERED_PREDICATES_H
+#define CINO_FILTERED_PREDICATES_H
+
+#include <sys/types.h>
+#include <cinolib/cino_inline.h>
+
+namespace cinolib
+{
+
+/* Sign of the orient2d predicate on points with exact coordinates (e.g. the
+ * rationals used by the mapping algorithms AFM and Stripe Embedding), evaluated
+ * with a cascade of increasingly expensive (and increasingly rare) stages:
+ *
+ *  1) interval filter: the predicate is evaluated with interval arithmetic on
+ *     the double approximations of the coordinates. If the resulting interval
+ *     does not contain zero, its sign is the sign of the predicate. This stage
+ *     does not allocate any memory;
+ *
+ *  2) expansion arithmetic: if all the coordinates are exactly representable as
+ *     doubles, the exact orient2d by Shewchuk is used (only if the symbol
+ *     CINOLIB_USES_SHEWCHUK_PREDICATES is defined at compilation time);
+ *
+ *  3) the predicate is evaluated with the number type T itself.
+ *
+ * For lazy rationals (CGAL_Q) this avoids the construction of an expression DAG
+ * (and of the associated big rationals) for every test, as most predicates are
+ * certified by the first stage.
+ *
+ * Any number type can be used, as long as IntervalTraits<T> is specialized to
+ * provide a conservative interval approximation of its values (see rationals.h)
+ *
+ * All functions return +1 (CCW), -1 (CW) or 0 (collinear)
+*/
+
+struct Interval
+{
+    double lo, hi;
+};
+
+CINO_INLINE Interval operator+(const Interval & a, const Interval & b);
+CINO_INLINE Interval operator-(const Interval & a, const Interval & b);
+CINO_INLINE Interval operator*(const Interval & a, const Interval & b);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+struct IntervalTraits
+{
+    // must be specialized for each number type T
+    static Interval to_interval(const T & x);
+};
+
+template<>
+struct IntervalTraits<double>
+{
+    static Interval to_interval(const double & x) { return { x, x }; }
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+int orient2d_sign(const T * pa,
+                  const T * pb,
+                  const T * pc);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// evaluates orient2d on a batch of triangles, defined as triplets of vertex ids.
+// Coordinates of vertex v start at coords[v*stride]. Returns the number of
+// predicates that could not be certified by the interval filter
+//
+template<class T>
+CINO_INLINE
+uint orient2d_sign_batch(const T    * coords,
+                         const uint   stride,
+                         const uint * tris,
+                         const uint   n_tris,
+                               int  * res);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "filtered_predicates.cpp"
+#endif
+
+#endif // CINO_FILTERED_PREDICATES_H
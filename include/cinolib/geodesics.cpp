@@ -64,7 +64,7 @@ ScalarField compute_geodesics(      Mesh              & m,
 
     Eigen::SparseMatrix<double> L   = laplacian(m, laplacian_mode);
     Eigen::SparseMatrix<double> MM  = mass_matrix(m);
-    Eigen::SparseMatrix<double> G   = gradient_matrix(m);
+    GradientOperator            G(m);
     Eigen::VectorXd             rhs = Eigen::VectorXd::Zero(m.num_verts());
 
     for(uint vid : heat_charges) rhs[vid] = 1.0;
@@ -72,7 +72,7 @@ ScalarField compute_geodesics(      Mesh              & m,
     ScalarField heat(m.num_verts());
     solve_square_system(MM - time * L, rhs, heat);
 
-    VectorField grad = G * heat;
+    VectorField grad = G.grad(heat);
     grad.normalize();
 
     ScalarField geodesics(m.num_verts());
@@ -83,11 +83,11 @@ ScalarField compute_geodesics(      Mesh              & m,
     {
         std::map<uint,double> bcs;
         for(uint vid : heat_charges) bcs[vid] = 1.0;
-        solve_square_system_with_bc(-L, G.transpose() * grad, geodesics, bcs, SIMPLICIAL_LDLT);
+        solve_square_system_with_bc(-L, G.div(grad), geodesics, bcs, SIMPLICIAL_LDLT);
     }
     else
     {
-        solve_square_system(-L, G.transpose() * grad, geodesics, SIMPLICIAL_LDLT);
+        solve_square_system(-L, G.div(grad), geodesics, SIMPLICIAL_LDLT);
     }
 
     // restore original scale and position
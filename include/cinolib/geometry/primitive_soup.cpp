@@ -0,0 +1,546 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/geometry/primitive_soup.h>
+#include <cinolib/geometry/triangle_utils.h>
+#include <cinolib/geometry/tetrahedron_utils.h>
+#include <cinolib/Moller_Trumbore_intersection.h>
+#include <cinolib/predicates.h>
+
+namespace cinolib
+{
+
+template<uint N>
+CINO_INLINE
+void SimplexSoup<N>::push(const uint id, const vec3d v[])
+{
+    assert(!is_reference() && "cannot push elements in a soup that references external vertices");
+    for(uint j=0; j<N; ++j)
+    {
+        xyz.push_back(v[j][0]);
+        xyz.push_back(v[j][1]);
+        xyz.push_back(v[j][2]);
+    }
+    ids.push_back(id);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+void SimplexSoup<N>::update(const uint i, const vec3d v[])
+{
+    assert(!is_reference() && "the elements of this soup move with the vertices they reference");
+    assert(i<size());
+    for(uint j=0; j<N; ++j)
+    {
+        xyz[3*(N*i+j)  ] = v[j][0];
+        xyz[3*(N*i+j)+1] = v[j][1];
+        xyz[3*(N*i+j)+2] = v[j][2];
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+void SimplexSoup<N>::reference(const std::vector<vec3d> & verts,
+                               const std::vector<uint>  & conn,
+                               const std::vector<uint>  & ids)
+{
+    assert(xyz.empty() && "cannot reference external vertices in a soup that owns its elements");
+    assert(conn.size()%N==0);
+    assert(!conn.empty() || N==1);
+    assert(ids.empty() || ids.size()==(conn.empty() ? verts.size() : conn.size()/N));
+    this->ext_verts = &verts;
+    this->conn      = conn;
+    this->ids       = ids;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+void SimplexSoup<N>::reserve(const uint n)
+{
+    if(is_reference()) return;
+    xyz.reserve(3*N*n);
+    ids.reserve(n);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+void SimplexSoup<N>::clear()
+{
+    xyz.clear();
+    conn.clear();
+    ids.clear();
+    ext_verts = nullptr;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+uint SimplexSoup<N>::size() const
+{
+    if(is_reference())
+    {
+        // a point soup with no connectivity references all the vertices
+        return conn.empty() ? (uint)ext_verts->size() : (uint)conn.size()/N;
+    }
+    return (uint)xyz.size()/(3*N);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+uint SimplexSoup<N>::id(const uint i) const
+{
+    return ids.empty() ? i : ids[i];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+const double * SimplexSoup<N>::vert_ptr(const uint i, const uint j) const
+{
+    assert(i<size() && j<N);
+    if(is_reference())
+    {
+        uint vid = conn.empty() ? i : conn[N*i+j];
+        return (*ext_verts)[vid].ptr();
+    }
+    return &xyz[3*(N*i+j)];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+vec3d SimplexSoup<N>::vert(const uint i, const uint j) const
+{
+    return vec3d(vert_ptr(i,j));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+AABB SimplexSoup<N>::aabb(const uint i) const
+{
+    AABB box;
+    for(uint j=0; j<N; ++j) box.push(vert(i,j));
+    return box;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<uint N>
+CINO_INLINE
+size_t SimplexSoup<N>::memory_in_bytes() const
+{
+    return sizeof(*this)                      +
+           xyz.capacity()  * sizeof(double) +
+           conn.capacity() * sizeof(uint)   +
+           ids.capacity()  * sizeof(uint);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+//:::::::::::::::::::::::::::::::: POINTS ::::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<>
+CINO_INLINE
+vec3d SimplexSoup<1>::point_closest_to(const uint i, const vec3d & /*p*/) const
+{
+    return vert(i,0);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<1>::contains(const uint i, const vec3d & p, const bool /*strict*/) const
+{
+    return p.dist_sqrd(vert(i,0))==0;
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<1>::intersects_ray(const uint, const vec3d &, const vec3d &, double &, vec3d &) const
+{
+    assert(false && "TODO");
+    return false;
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<1>::intersects_segment(const uint i, const vec3d s[], const bool ignore_if_valid_complex) const
+{
+    auto res = point_in_segment_3d(vert_ptr(i,0), s[0].ptr(), s[1].ptr());
+    if(ignore_if_valid_complex) return (res==STRICTLY_INSIDE);
+    return (res!=STRICTLY_OUTSIDE);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<1>::intersects_triangle(const uint i, const vec3d t[], const bool ignore_if_valid_complex) const
+{
+    auto res = point_in_triangle_3d(vert_ptr(i,0), t[0].ptr(), t[1].ptr(), t[2].ptr());
+    if(ignore_if_valid_complex) return (res==STRICTLY_INSIDE || res>=ON_EDGE0);
+    return (res!=STRICTLY_OUTSIDE);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::: SEGMENTS :::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Real Time Collision Detection", Section 5.1.2
+template<>
+CINO_INLINE
+vec3d SimplexSoup<2>::point_closest_to(const uint i, const vec3d & p) const
+{
+    vec3d v0 = vert(i,0);
+    vec3d u  = vert(i,1) - v0;
+
+    // project p onto v0v1, but deferring divide by dot(u,u)
+    double t = (p-v0).dot(u);
+    if(t<=0) return v0;
+
+    double den = u.dot(u);
+    if(t>=den) return v0 + u;
+
+    t = t/den;
+    return v0 + t*u;
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<2>::contains(const uint i, const vec3d & p, const bool strict) const
+{
+    int where = point_in_segment_3d(p.ptr(), vert_ptr(i,0), vert_ptr(i,1));
+    if(strict) return (where==STRICTLY_INSIDE);
+    return (where>=STRICTLY_INSIDE);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<2>::intersects_ray(const uint, const vec3d &, const vec3d &, double &, vec3d &) const
+{
+    assert(false && "TODO");
+    return false;
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<2>::intersects_segment(const uint i, const vec3d s[], const bool ignore_if_valid_complex) const
+{
+    auto res = segment_segment_intersect_3d(vert_ptr(i,0), vert_ptr(i,1), s[0].ptr(), s[1].ptr());
+    if(ignore_if_valid_complex) return (res > SIMPLICIAL_COMPLEX);
+    return (res>=SIMPLICIAL_COMPLEX);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<2>::intersects_triangle(const uint i, const vec3d t[], const bool ignore_if_valid_complex) const
+{
+    auto res = segment_triangle_intersect_3d(vert_ptr(i,0), vert_ptr(i,1), t[0].ptr(), t[1].ptr(), t[2].ptr());
+    if(ignore_if_valid_complex) return (res > SIMPLICIAL_COMPLEX);
+    return (res>=SIMPLICIAL_COMPLEX);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::: TRIANGLES ::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<>
+CINO_INLINE
+vec3d SimplexSoup<3>::point_closest_to(const uint i, const vec3d & p) const
+{
+    return triangle_closest_point(p, vert(i,0), vert(i,1), vert(i,2));
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<3>::contains(const uint i, const vec3d & p, const bool strict) const
+{
+    int where = point_in_triangle_3d(p.ptr(), vert_ptr(i,0), vert_ptr(i,1), vert_ptr(i,2));
+    if(strict) return (where==STRICTLY_INSIDE);
+    return (where>=STRICTLY_INSIDE);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<3>::intersects_ray(const uint i, const vec3d & p, const vec3d & dir, double & t, vec3d & pos) const
+{
+    bool  hits_backside;
+    bool  coplanar;
+    vec3d bary;
+    if(Moller_Trumbore_intersection(p, dir, vert(i,0), vert(i,1), vert(i,2), hits_backside, coplanar, t, bary) && t>=0)
+    {
+        pos = p + t * dir;
+        return true;
+    }
+    return false;
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<3>::intersects_segment(const uint i, const vec3d s[], const bool ignore_if_valid_complex) const
+{
+    auto res = segment_triangle_intersect_3d(s[0].ptr(), s[1].ptr(), vert_ptr(i,0), vert_ptr(i,1), vert_ptr(i,2));
+    if(ignore_if_valid_complex) return (res > SIMPLICIAL_COMPLEX);
+    return (res>=SIMPLICIAL_COMPLEX);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<3>::intersects_triangle(const uint i, const vec3d t[], const bool ignore_if_valid_complex) const
+{
+    auto res = triangle_triangle_intersect_3d(vert_ptr(i,0), vert_ptr(i,1), vert_ptr(i,2), t[0].ptr(), t[1].ptr(), t[2].ptr());
+    if(ignore_if_valid_complex) return (res > SIMPLICIAL_COMPLEX);
+    return (res>=SIMPLICIAL_COMPLEX);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::::: TETS :::::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<>
+CINO_INLINE
+vec3d SimplexSoup<4>::point_closest_to(const uint i, const vec3d & p) const
+{
+    return tetrahedron_closest_point(p, vert(i,0), vert(i,1), vert(i,2), vert(i,3));
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<4>::contains(const uint i, const vec3d & p, const bool strict) const
+{
+    int where = point_in_tet(p.ptr(), vert_ptr(i,0), vert_ptr(i,1), vert_ptr(i,2), vert_ptr(i,3));
+    if(strict) return (where==STRICTLY_INSIDE);
+    return (where>=STRICTLY_INSIDE);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<4>::intersects_ray(const uint i, const vec3d & p, const vec3d & dir, double & t, vec3d & pos) const
+{
+    vec3d  v[4] = { vert(i,0), vert(i,1), vert(i,2), vert(i,3) };
+    bool   backside;
+    bool   coplanar;
+    vec3d  bary;
+    double tt[4] = { -1, -1, -1, -1 };
+    Moller_Trumbore_intersection(p, dir, v[0], v[2], v[1], backside, coplanar, tt[0], bary);
+    Moller_Trumbore_intersection(p, dir, v[0], v[1], v[3], backside, coplanar, tt[1], bary);
+    Moller_Trumbore_intersection(p, dir, v[0], v[3], v[2], backside, coplanar, tt[2], bary);
+    Moller_Trumbore_intersection(p, dir, v[1], v[2], v[3], backside, coplanar, tt[3], bary);
+    // NOTE: here tt is used as a boolean flag for intersection. If an intersection occurs,
+    // the corresponding tt value will become positive
+    if(*std::max_element(tt, tt+4)>=0)
+    {
+        // the smallest positive tt locates the correct intersection point
+        t = inf_double;
+        for(uint i=0; i<4; ++i)
+        {
+            if(tt[i]>0 && tt[i]<t) t = tt[i];
+        }
+        pos = p + t*dir;
+        return true;
+    }
+    return false;
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<4>::intersects_segment(const uint i, const vec3d s[], const bool ignore_if_valid_complex) const
+{
+    auto res = segment_tet_intersect_3d(s[0].ptr(), s[1].ptr(), vert_ptr(i,0), vert_ptr(i,1), vert_ptr(i,2), vert_ptr(i,3));
+    if(ignore_if_valid_complex) return (res > SIMPLICIAL_COMPLEX);
+    return (res>=SIMPLICIAL_COMPLEX);
+}
+
+template<>
+CINO_INLINE
+bool SimplexSoup<4>::intersects_triangle(const uint, const vec3d [], const bool) const
+{
+    assert(false && "TODO!");
+    return false;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+//:::::::::::::::::::::::::::::::: SPHERES :::::::::::::::::::::::::::::::
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void SphereSoup::push(const uint id, const vec3d & c, const double r)
+{
+    centers.push_back(c[0]);
+    centers.push_back(c[1]);
+    centers.push_back(c[2]);
+    radii.push_back(r);
+    ids.push_back(id);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void SphereSoup::update(const uint i, const vec3d & c, const double r)
+{
+    centers[3*i  ] = c[0];
+    centers[3*i+1] = c[1];
+    centers[3*i+2] = c[2];
+    radii[i]       = r;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void SphereSoup::reserve(const uint n)
+{
+    centers.reserve(3*n);
+    radii.reserve(n);
+    ids.reserve(n);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void SphereSoup::clear()
+{
+    centers.clear();
+    radii.clear();
+    ids.clear();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+vec3d SphereSoup::center(const uint i) const
+{
+    return vec3d(&centers[3*i]);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+AABB SphereSoup::aabb(const uint i) const
+{
+    vec3d  c = center(i);
+    double r = radii[i];
+    return AABB(c - vec3d(r,r,r), c + vec3d(r,r,r));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+size_t SphereSoup::memory_in_bytes() const
+{
+    return sizeof(*this)                        +
+           centers.capacity() * sizeof(double) +
+           radii.capacity()   * sizeof(double) +
+           ids.capacity()     * sizeof(uint);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+vec3d SphereSoup::point_closest_to(const uint i, const vec3d & p) const
+{
+    vec3d  c = center(i);
+    vec3d  d = p - c;
+    double l = d.norm();
+    if(l<=radii[i]) return p; // p is inside the (solid) sphere
+    return c + d*(radii[i]/l);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool SphereSoup::contains(const uint i, const vec3d & p, const bool strict) const
+{
+    if(strict) return p.dist(center(i)) <  radii[i];
+    else       return p.dist(center(i)) <= radii[i];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// first non negative solution of |p + t*dir - c|^2 = r^2
+CINO_INLINE
+bool SphereSoup::intersects_ray(const uint i, const vec3d & p, const vec3d & dir, double & t, vec3d & pos) const
+{
+    vec3d  pc   = p - center(i);
+    double a    = dir.dot(dir);
+    double b    = 2.0 * dir.dot(pc);
+    double c    = pc.dot(pc) - radii[i]*radii[i];
+    double disc = b*b - 4.0*a*c;
+    if(a==0 || disc<0) return false;
+    double sq = std::sqrt(disc);
+    double t0 = (-b - sq)/(2.0*a);
+    double t1 = (-b + sq)/(2.0*a);
+    t = (t0>=0) ? t0 : t1;
+    if(t<0) return false;
+    pos = p + t*dir;
+    return true;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool SphereSoup::intersects_segment(const uint i, const vec3d s[], const bool /*ignore_if_valid_complex*/) const
+{
+    // Real Time Collision Detection", Section 5.1.2
+    vec3d  c = center(i);
+    vec3d  u = s[1] - s[0];
+    double t = (c-s[0]).dot(u);
+    double l = u.dot(u);
+    vec3d  q = (t<=0) ? s[0] : ((t>=l) ? s[1] : s[0] + u*(t/l));
+    return q.dist_sqrd(c) <= radii[i]*radii[i];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool SphereSoup::intersects_triangle(const uint i, const vec3d t[], const bool /*ignore_if_valid_complex*/) const
+{
+    vec3d c = center(i);
+    vec3d q = triangle_closest_point(c, t[0], t[1], t[2]);
+    return q.dist_sqrd(c) <= radii[i]*radii[i];
+}
+
+}
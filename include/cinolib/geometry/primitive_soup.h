@@ -0,0 +1,158 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_PRIMITIVE_SOUP_H
+#define CINO_PRIMITIVE_SOUP_H
+
+#include <cinolib/geometry/aabb.h>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Homogeneous containers of geometric primitives, meant to populate spatial data
+ * structures (see SoupOctree) without paying for one heap allocated, polymorphic
+ * SpatialDataStructureItem per element.
+ *
+ * A SimplexSoup<N> stores simplices with N vertices (points, segments, triangles, tets)
+ * in one of two modes:
+ *
+ *  i)  OWNED     : push() copies the vertex coordinates in a flat array of doubles (3*N per element)
+ *  ii) REFERENCE : reference() points to an external vertex array (e.g. m.vector_verts())
+ *                  and only stores the element connectivity. Coordinates are never copied,
+ *                  hence moving the vertices of the mesh moves the soup as well. The
+ *                  external array must outlive the soup and must not be reallocated.
+ *
+ * Queries have the same semantics of their counterparts in Point, Segment, Triangle
+ * and Tetrahedron, but are resolved at compile time and operate on the i-th element.
+*/
+
+template<uint N>
+class SimplexSoup
+{
+    public:
+
+        explicit SimplexSoup() {}
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void push     (const uint id, const vec3d v[]);
+        void update   (const uint i,  const vec3d v[]); // OWNED mode only: moves the vertices of the i-th element
+        void reference(const std::vector<vec3d> & verts,
+                       const std::vector<uint>  & conn, // N vertex ids per element (may be empty for points)
+                       const std::vector<uint>  & ids = std::vector<uint>()); // if empty, the id of an element is its index
+        void reserve  (const uint n);
+        void clear    ();
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint           size()                            const;
+        bool           empty()                           const { return size()==0; }
+        bool           is_reference()                    const { return ext_verts!=nullptr; }
+        uint           id      (const uint i)            const;
+        const double * vert_ptr(const uint i, const uint j) const;
+        vec3d          vert    (const uint i, const uint j) const;
+        AABB           aabb    (const uint i)            const;
+        size_t         memory_in_bytes()                 const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        vec3d point_closest_to   (const uint i, const vec3d & p) const;
+        bool  contains           (const uint i, const vec3d & p, const bool strict) const;
+        bool  intersects_ray     (const uint i, const vec3d & p, const vec3d & dir, double & t, vec3d & pos) const;
+        bool  intersects_segment (const uint i, const vec3d s[], const bool ignore_if_valid_complex) const;
+        bool  intersects_triangle(const uint i, const vec3d t[], const bool ignore_if_valid_complex) const;
+
+    protected:
+
+        std::vector<double>        xyz;                 // OWNED mode: 3*N coordinates per element
+        std::vector<uint>          conn;                // REFERENCE mode: N vertex ids per element
+        std::vector<uint>          ids;                 // user defined id for each element
+        const std::vector<vec3d> * ext_verts = nullptr; // REFERENCE mode: external vertex array
+};
+
+typedef SimplexSoup<1> PointSoup;
+typedef SimplexSoup<2> SegmentSoup;
+typedef SimplexSoup<3> TriangleSoup;
+typedef SimplexSoup<4> TetSoup;
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Solid spheres, stored as flat centers and radii
+class SphereSoup
+{
+    public:
+
+        explicit SphereSoup() {}
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void push   (const uint id, const vec3d & c, const double r);
+        void update (const uint i,  const vec3d & c, const double r);
+        void reserve(const uint n);
+        void clear  ();
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint   size()                 const { return (uint)radii.size(); }
+        bool   empty()                const { return radii.empty(); }
+        uint   id    (const uint i)   const { return ids.at(i); }
+        vec3d  center(const uint i)   const;
+        double radius(const uint i)   const { return radii.at(i); }
+        AABB   aabb  (const uint i)   const;
+        size_t memory_in_bytes()      const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        vec3d point_closest_to   (const uint i, const vec3d & p) const;
+        bool  contains           (const uint i, const vec3d & p, const bool strict) const;
+        bool  intersects_ray     (const uint i, const vec3d & p, const vec3d & dir, double & t, vec3d & pos) const;
+        bool  intersects_segment (const uint i, const vec3d s[], const bool ignore_if_valid_complex) const;
+        bool  intersects_triangle(const uint i, const vec3d t[], const bool ignore_if_valid_complex) const;
+
+    protected:
+
+        std::vector<double> centers; // 3 coordinates per sphere
+        std::vector<double> radii;
+        std::vector<uint>   ids;
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "primitive_soup.cpp"
+#endif
+
+#endif // CINO_PRIMITIVE_SOUP_H
@@ -950,6 +950,10 @@ template<uint d, typename T>
 CINO_INLINE
 void mat_closest_orth_mat(const T m[][d], T n[][d], const bool force_pos_det)
 {
+    // closed form rotations for the 2x2 and 3x3 cases (e.g. ARAP local steps)
+    if(force_pos_det && d==2) { mat_closest_rot22<T>(m[0], n[0]); return; }
+    if(force_pos_det && d==3 && mat_closest_rot33<T>(m[0], n[0])) return;
+
     T U[d][d], S[d], V[d][d];
     mat_svd<d,d,T>(m,U,S,V);
     T Vt[d][d];
@@ -968,6 +972,61 @@ void mat_closest_orth_mat(const T m[][d], T n[][d], const bool force_pos_det)
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+// rotation R = [c -s; s c] maximizing trace(R^T m), that is, the
+// closest rotation to the 2x2 row-major matrix m (Frobenius norm)
+template<typename T>
+CINO_INLINE
+void mat_closest_rot22(const T m[], T n[])
+{
+    T c = m[0] + m[3];
+    T s = m[2] - m[1];
+    T l = std::sqrt(c*c + s*s);
+    if(l>0) { c/=l; s/=l; }
+    else    { c=1;  s=0;  }
+    n[0] = c; n[1] = -s;
+    n[2] = s; n[3] =  c;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// closest rotation to the 3x3 row-major matrix m, in closed form (no iterative SVD).
+// Being v0 the dominant eigenvector of m^T m and u0 = m*v0/|m*v0|, the rotation maps
+// v0 to u0, and the planes orthogonal to v0 and u0 onto each other. The in-plane
+// rotation is the closest rotation to the restriction of m, which is a 2x2 problem.
+// This is the same as U*diag(1,1,det(U*V^T))*V^T, with U,V from the SVD of m.
+// Returns false (leaving n untouched) if m is null
+template<typename T>
+CINO_INLINE
+bool mat_closest_rot33(const T m[], T n[])
+{
+    typedef Eigen::Matrix<T,3,3,Eigen::RowMajor> M;
+    typedef Eigen::Matrix<T,3,1>                 V;
+    Eigen::Map<const M> A(m);
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix<T,3,3>> eig;
+    eig.computeDirect(A.transpose()*A);
+    V v0 = eig.eigenvectors().col(2); // eigenvalues are sorted in increasing order
+    V u0 = A*v0;
+    T l0 = u0.norm();
+    if(l0==0) return false;
+    u0 /= l0;
+    // right handed frames (p,q,v0) and (s,t,u0)
+    V p = v0.unitOrthogonal();
+    V q = v0.cross(p);
+    V s = u0.unitOrthogonal();
+    V t = u0.cross(s);
+    V Ap = A*p;
+    V Aq = A*q;
+    T m2[4] = { s.dot(Ap), s.dot(Aq),
+                t.dot(Ap), t.dot(Aq) };
+    T n2[4];
+    mat_closest_rot22<T>(m2, n2);
+    Eigen::Map<M> R(n);
+    R = u0*v0.transpose() + (n2[0]*s + n2[2]*t)*p.transpose() + (n2[1]*s + n2[3]*t)*q.transpose();
+    return true;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<uint d, typename T>
 CINO_INLINE
 void mat_solve_Cramer(const T m[][d], const T b[], T x[])
@@ -555,17 +555,17 @@ void SurfaceMeshControls<Mesh>::header_ambient_occlusion(const bool open)
                 {
                     for(uint pid=0; pid<ao_data.floor.num_polys(); ++pid)
                     {
-                        if(ao_data.floor.poly_data(pid).AO>0.95)
+                        if(ao_data.floor.poly_AO(pid)>0.95)
                         {
-                            ao_data.floor.poly_data(pid).AO = 1.f;
+                            ao_data.floor.poly_AO(pid) = 1.f;
                         }
                         else
                         {
                             for(uint nbr : ao_data.floor.adj_p2p(pid))
                             {
-                                ao_data.floor.poly_data(pid).AO += ao_data.floor.poly_data(nbr).AO;
+                                ao_data.floor.poly_AO(pid) += ao_data.floor.poly_AO(nbr);
                             }
-                            ao_data.floor.poly_data(pid).AO /= double(ao_data.floor.adj_p2p(pid).size()+1);
+                            ao_data.floor.poly_AO(pid) /= double(ao_data.floor.adj_p2p(pid).size()+1);
                         }
                     }
                     ao_data.floor.updateGL();
@@ -688,7 +688,7 @@ void SurfaceMeshControls<Mesh>::header_debug(const bool open)
                 {
                     if(m->vert_is_visible(vid))
                     {
-                        vec3d n = m->vert_data(vid).normal;
+                        vec3d n = m->vert_normal(vid);
                         vec3d p = m->vert(vid);
                         vert_normals.push_seg(p, p+(n*l));
                     }
@@ -712,7 +712,7 @@ void SurfaceMeshControls<Mesh>::header_debug(const bool open)
                 {
                     if(!m->poly_data(pid).flags[HIDDEN])
                     {
-                        vec3d n = m->poly_data(pid).normal;
+                        vec3d n = m->poly_normal(pid);
                         vec3d c = m->poly_centroid(pid);
                         poly_normals.push_seg(c, c+(n*l));
                     }
@@ -685,17 +685,17 @@ void VolumeMeshControls<Mesh>::header_ambient_occlusion(const bool open)
                 {
                     for(uint pid=0; pid<ao_data.floor.num_polys(); ++pid)
                     {
-                        if(ao_data.floor.poly_data(pid).AO>0.95)
+                        if(ao_data.floor.poly_AO(pid)>0.95)
                         {
-                            ao_data.floor.poly_data(pid).AO = 1.f;
+                            ao_data.floor.poly_AO(pid) = 1.f;
                         }
                         else
                         {
                             for(uint nbr : ao_data.floor.adj_p2p(pid))
                             {
-                                ao_data.floor.poly_data(pid).AO += ao_data.floor.poly_data(nbr).AO;
+                                ao_data.floor.poly_AO(pid) += ao_data.floor.poly_AO(nbr);
                             }
-                            ao_data.floor.poly_data(pid).AO /= double(ao_data.floor.adj_p2p(pid).size()+1);
+                            ao_data.floor.poly_AO(pid) /= double(ao_data.floor.adj_p2p(pid).size()+1);
                         }
                     }
                     ao_data.floor.updateGL();
@@ -827,7 +827,7 @@ void VolumeMeshControls<Mesh>::header_debug(const bool open)
                 {
                     if(m->vert_is_visible(vid))
                     {
-                        vec3d n = m->vert_data(vid).normal;
+                        vec3d n = m->vert_normal(vid);
                         vec3d p = m->vert(vid);
                         vert_normals.push_seg(p, p+(n*l));
                     }
@@ -936,7 +936,7 @@ void VolumeMeshControls<Mesh>::header_actions(const bool open)
                 if(m->face_is_on_srf(fid))continue;
                 uint p0 = m->adj_f2p(fid).front();
                 uint p1 = m->adj_f2p(fid).back();
-                m->face_data(fid).flags[MARKED] = (m->poly_data(p0).label!=m->poly_data(p1).label);
+                m->face_data(fid).flags[MARKED] = (m->poly_label(p0)!=m->poly_label(p1));
             }
             for(uint eid=0; eid<m->num_edges(); ++eid)
             {
@@ -60,8 +60,8 @@ void gluing_scheme_force_normal_form(Trimesh<M,V,E,P>  & m,
             uint v1 = m.edge_vert_id(eid,1);
             if(!m.edge_data(eid).flags[MARKED])
             {
-                int l0 = m.vert_data(v0).label;
-                int l1 = m.vert_data(v1).label;
+                int l0 = m.vert_label(v0);
+                int l1 = m.vert_label(v1);
                 if((l0>=0 && l1>=0)         ||
                    (l0>=0 && v1==data.root) ||
                    (l1>=0 && v0==data.root))
@@ -86,16 +86,16 @@ void gluing_scheme_force_normal_form(Trimesh<M,V,E,P>  & m,
     {
         for(uint eid=0; eid<m.num_edges(); ++eid)
         {
-            if(m.edge_data(eid).flags[MARKED] && m.edge_data(eid).label==loop_id)
+            if(m.edge_data(eid).flags[MARKED] && m.edge_label(eid)==loop_id)
             {
                 m.edge_data(eid).flags[MARKED] = false;
-                m.edge_data(eid).label = -1;
+                m.edge_label(eid) = -1;
                 uint v0 = m.edge_vert_id(eid,0);
                 uint v1 = m.edge_vert_id(eid,1);
                 m.vert_data(v0 ).flags[MARKED] = false;
                 m.vert_data(v1 ).flags[MARKED] = false;
-                m.vert_data(v0 ).label = -1;
-                m.vert_data(v1 ).label = -1;
+                m.vert_label(v0 ) = -1;
+                m.vert_label(v1 ) = -1;
             }
         }
     };
@@ -106,7 +106,7 @@ void gluing_scheme_force_normal_form(Trimesh<M,V,E,P>  & m,
     auto trace_loop = [&](const uint beg, const uint end) -> bool
     {
         std::vector<bool> mask(m.num_verts());
-        for(uint vid=0; vid<m.num_verts(); ++vid) mask.at(vid) = (m.vert_data(vid).label>=0);
+        for(uint vid=0; vid<m.num_verts(); ++vid) mask.at(vid) = (m.vert_label(vid)>=0);
         mask.at(data.root) = true;
 
         std::vector<uint> path;
@@ -123,12 +123,12 @@ void gluing_scheme_force_normal_form(Trimesh<M,V,E,P>  & m,
             m.edge_data(eid).flags[MARKED] = true;
             m.vert_data(v0 ).flags[MARKED] = true;
             m.vert_data(v1 ).flags[MARKED] = true;
-            m.edge_data(eid).label = fresh_loop_id;
-            m.vert_data(v0 ).label = fresh_loop_id;
-            m.vert_data(v1 ).label = fresh_loop_id;
+            m.edge_label(eid) = fresh_loop_id;
+            m.vert_label(v0 ) = fresh_loop_id;
+            m.vert_label(v1 ) = fresh_loop_id;
         }
         m.vert_data(data.root).flags[MARKED] = false;
-        m.vert_data(data.root).label = -1;
+        m.vert_label(data.root) = -1;
         ++fresh_loop_id;
         return true;
     };
@@ -140,11 +140,11 @@ void gluing_scheme_force_normal_form(Trimesh<M,V,E,P>  & m,
     {
         for(uint vid=0; vid<m.num_verts(); ++vid)
         {
-            if(m.vert_data(vid).label==old_id) m.vert_data(vid).label = new_id;
+            if(m.vert_label(vid)==old_id) m.vert_label(vid) = new_id;
         }
         for(uint eid=0; eid<m.num_edges(); ++eid)
         {
-            if(m.edge_data(eid).label==old_id) m.edge_data(eid).label = new_id;
+            if(m.edge_label(eid)==old_id) m.edge_label(eid) = new_id;
         }
     };
 
@@ -300,7 +300,7 @@ std::vector<int> radial_sorting(Trimesh<M,V,E,P>  & m,
         if(full || m.edge_data(eid).flags[MARKED])
         {
             uint vid = m.vert_opposite_to(eid,data.root);
-            rs.push_back(m.vert_data(vid).label);
+            rs.push_back(m.vert_label(vid));
             if(full) rs.push_back(vid);
         }
     }
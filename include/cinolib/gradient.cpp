@@ -42,6 +42,7 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/gradient.h>
+#include <cinolib/parallel_for.h>
 
 namespace cinolib
 {
@@ -52,80 +53,143 @@ typedef Eigen::Triplet<double> Entry;
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-Eigen::SparseMatrix<double> gradient_matrix(const AbstractPolygonMesh<M,V,E,P> & m, const bool per_poly)
+void gradient_corner_terms(const AbstractPolygonMesh<M,V,E,P> & m,
+                                 std::vector<uint>            & p_off,
+                                 std::vector<uint>            & c_vid,
+                                 std::vector<vec3d>           & terms,
+                                 std::vector<double>          & p_area)
 {
-    if(per_poly)
+    p_off.resize(m.num_polys()+1);
+    p_off[0] = 0;
+    for(uint pid=0; pid<m.num_polys(); ++pid) p_off[pid+1] = p_off[pid] + m.verts_per_poly(pid);
+    c_vid.resize(p_off.back());
+    terms.resize(p_off.back());
+    p_area.resize(m.num_polys());
+
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
     {
-        Eigen::SparseMatrix<double> G(m.num_polys()*3, m.num_verts());
-        std::vector<Entry> entries;
+        p_area[pid] = std::max(m.poly_area(pid), 1e-5) * 2.0; // (2 is the average term : two verts for each edge)
+        vec3d n     = m.poly_normal(pid);
+        uint  nc    = m.verts_per_poly(pid);
+        uint  beg   = p_off[pid];
 
-        for(uint pid=0; pid<m.num_polys(); ++pid)
+        for(uint off=0; off<nc; ++off)
         {
-            double area = std::max(m.poly_area(pid), 1e-5) * 2.0; // (2 is the average term : two verts for each edge)
-            vec3d n     = m.poly_data(pid).normal;
+            uint  prev = m.poly_vert_id(pid,off);
+            uint  curr = m.poly_vert_id(pid,(off+1)%nc);
+            uint  next = m.poly_vert_id(pid,(off+2)%nc);
+            vec3d u    = m.vert(next) - m.vert(curr);
+            vec3d v    = m.vert(curr) - m.vert(prev);
+            vec3d u_90 = u.cross(n); u_90.normalize();
+            vec3d v_90 = v.cross(n); v_90.normalize();
 
-            for(uint off=0; off<m.verts_per_poly(pid); ++off)
+            // insertion sort by vertex id (elements have very few corners)
+            uint i = beg + off;
+            while(i>beg && c_vid[i-1]>curr)
             {
-                uint  prev = m.poly_vert_id(pid,off);
-                uint  curr = m.poly_vert_id(pid,(off+1)%m.verts_per_poly(pid));
-                uint  next = m.poly_vert_id(pid,(off+2)%m.verts_per_poly(pid));
-                vec3d u    = m.vert(next) - m.vert(curr);
-                vec3d v    = m.vert(curr) - m.vert(prev);
-                vec3d u_90 = u.cross(n); u_90.normalize();
-                vec3d v_90 = v.cross(n); v_90.normalize();
-
-                vec3d per_vert_sum_over_edge_normals = u_90 * u.norm() + v_90 * v.norm();
-                per_vert_sum_over_edge_normals /= area;
-
-                uint row = 3 * pid;
-                entries.push_back(Entry(row, curr, per_vert_sum_over_edge_normals.x())); ++row;
-                entries.push_back(Entry(row, curr, per_vert_sum_over_edge_normals.y())); ++row;
-                entries.push_back(Entry(row, curr, per_vert_sum_over_edge_normals.z()));
+                c_vid[i] = c_vid[i-1];
+                terms[i] = terms[i-1];
+                --i;
             }
+            c_vid[i] = curr;
+            terms[i] = u_90 * u.norm() + v_90 * v.norm();
         }
+    });
+}
 
-        G.setFromTriplets(entries.begin(), entries.end());
-        return G;
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+Eigen::SparseMatrix<double> gradient_matrix(const AbstractPolygonMesh<M,V,E,P> & m, const bool per_poly)
+{
+    if(per_poly)
+    {
+        return GradientOperator(m).matrix();
     }
     else // per vertex
     {
-        Eigen::SparseMatrix<double> G(m.num_verts()*3, m.num_verts());
-        std::vector<Entry> entries;
+        // row vid gathers the terms of all the corners of the polygons incident to vid. Rows
+        // are filled in parallel directly in CSR format, with an upper bound of their size
+        // (duplicated columns are summed, in the same order Eigen::setFromTriplets would)
+        std::vector<uint>   p_off, c_vid;
+        std::vector<vec3d>  terms;
+        std::vector<double> p_area;
+        gradient_corner_terms(m, p_off, c_vid, terms, p_area);
+
+        uint nv = m.num_verts();
+        std::vector<uint> row_beg(nv+1, 0);
+        for(uint vid=0; vid<nv; ++vid)
+        {
+            uint n = 0;
+            for(uint pid : m.adj_v2p(vid)) n += p_off[pid+1] - p_off[pid];
+            row_beg[vid+1] = row_beg[vid] + n;
+        }
+        std::vector<uint>  cols(row_beg.back());
+        std::vector<vec3d> vals(row_beg.back());
+        std::vector<uint>  row_size(nv);
 
-        for(uint vid=0; vid<m.num_verts(); ++vid)
+        PARALLEL_FOR(0, nv, 1000, [&](uint vid)
         {
-            std::vector<std::pair<uint,vec3d>> vert_contr;
-            double area=0.f;
+            double area = 0.0;
+            for(uint pid : m.adj_v2p(vid)) area += p_area[pid];
+
+            uint beg = row_beg[vid];
+            uint end = beg;
             for(uint pid : m.adj_v2p(vid))
             {
-                area   += std::max(m.poly_area(pid), 1e-5) * 2.0;
-                vec3d n = m.poly_data(pid).normal;
-
-                for(uint off=0; off<m.verts_per_poly(pid); ++off)
+                for(uint c=p_off[pid]; c<p_off[pid+1]; ++c)
                 {
-                    uint  prev = m.poly_vert_id(pid,off);
-                    uint  curr = m.poly_vert_id(pid,(off+1)%m.verts_per_poly(pid));
-                    uint  next = m.poly_vert_id(pid,(off+2)%m.verts_per_poly(pid));
-                    vec3d u    = m.vert(next) - m.vert(curr);
-                    vec3d v    = m.vert(curr) - m.vert(prev);
-                    vec3d u_90 = u.cross(n); u_90.normalize();
-                    vec3d v_90 = v.cross(n); v_90.normalize();
-
-                    // note: Eigen::setFromTriplets will take care of summing contributs w.r.t. multiple polys
-                    vert_contr.push_back(std::make_pair(curr, u_90*u.norm()+v_90*v.norm()));
+                    vec3d val(terms[c].x()/area, terms[c].y()/area, terms[c].z()/area);
+                    uint  i = beg;
+                    while(i<end && cols[i]!=c_vid[c]) ++i;
+                    if(i<end) vals[i] += val; else
+                    {
+                        // keep columns sorted
+                        while(i>beg && cols[i-1]>c_vid[c])
+                        {
+                            cols[i] = cols[i-1];
+                            vals[i] = vals[i-1];
+                            --i;
+                        }
+                        cols[i] = c_vid[c];
+                        vals[i] = val;
+                        ++end;
+                    }
                 }
             }
-            uint row = vid * 3;
-            for(auto c : vert_contr)
+            row_size[vid] = end - beg;
+        });
+
+        uint nnz = 0;
+        for(uint vid=0; vid<nv; ++vid) nnz += 3*row_size[vid];
+
+        Eigen::SparseMatrix<double,Eigen::RowMajor> G(nv*3, nv);
+        G.resizeNonZeros(nnz);
+        int    *outer = G.outerIndexPtr();
+        int    *inner = G.innerIndexPtr();
+        double *value = G.valuePtr();
+        outer[0] = 0;
+        for(uint vid=0; vid<nv; ++vid)
+        for(uint i=0; i<3; ++i)
+        {
+            outer[3*vid+i+1] = outer[3*vid+i] + row_size[vid];
+        }
+
+        PARALLEL_FOR(0, nv, 1000, [&](uint vid)
+        {
+            for(uint i=0; i<3; ++i)
             {
-                entries.push_back(Entry(row  , c.first, c.second.x()/area));
-                entries.push_back(Entry(row+1, c.first, c.second.y()/area));
-                entries.push_back(Entry(row+2, c.first, c.second.z()/area));
+                uint dst = outer[3*vid+i];
+                for(uint j=0; j<row_size[vid]; ++j)
+                {
+                    inner[dst+j] = cols [row_beg[vid]+j];
+                    value[dst+j] = vals[row_beg[vid]+j][i];
+                }
             }
-        }
+        });
 
-        G.setFromTriplets(entries.begin(), entries.end());
-        return G;
+        return Eigen::SparseMatrix<double>(G);
     }
 }
 
@@ -135,92 +199,239 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 Eigen::SparseMatrix<double> gradient_matrix(const AbstractPolyhedralMesh<M,V,E,F,P> & m, const bool per_poly)
 {
-    if(per_poly)
-    {
-        Eigen::SparseMatrix<double> G(m.num_polys()*3, m.num_verts());
-        std::vector<Entry> entries;
+    Eigen::SparseMatrix<double> G = GradientOperator(m).matrix();
+    if(per_poly) return G;
 
-        for(uint pid=0; pid<m.num_polys(); ++pid)
+    // per vert
+    Eigen::SparseMatrix<double> A(m.num_verts()*3, m.num_polys()*3);
+    std::vector<Entry> entries;
+
+    for(uint vid=0;vid<m.num_verts();++vid)
+    {
+        double total_volume=0;
+        for(uint pid : m.adj_v2p(vid))
+        {
+            total_volume += m.poly_volume(pid);
+        }
+        uint row = 3*vid;
+        for(uint pid : m.adj_v2p(vid))
         {
-            double vol = std::max(m.poly_volume(pid), 1e-5);
+            uint col=3*pid;
+            entries.push_back(Entry(row,  col,   m.poly_volume(pid)/total_volume));
+            entries.push_back(Entry(row+1,col+1, m.poly_volume(pid)/total_volume));
+            entries.push_back(Entry(row+2,col+2, m.poly_volume(pid)/total_volume));
+        }
+    }
+    A.setFromTriplets(entries.begin(), entries.end());
+    return A*G;
+}
 
-            for(uint vid : m.adj_p2v(pid))
-            {
-                vec3d per_vert_sum_over_f_normals(0,0,0);
-                for(uint fid : m.adj_p2f(pid))
-                {
-                    if (m.face_contains_vert(fid,vid))
-                    {
-                        vec3d  n   = m.poly_face_normal(pid,fid);
-                        double a   = m.face_area(fid);
-                        double avg = static_cast<double>(m.verts_per_face(fid));
-                        per_vert_sum_over_f_normals += (n*a)/avg;
-                    }
-                }
-                per_vert_sum_over_f_normals /= vol;
-                uint row = 3 * pid;
-                entries.push_back(Entry(row, vid, per_vert_sum_over_f_normals.x())); ++row;
-                entries.push_back(Entry(row, vid, per_vert_sum_over_f_normals.y())); ++row;
-                entries.push_back(Entry(row, vid, per_vert_sum_over_f_normals.z()));
-            }
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+GradientOperator::GradientOperator(const AbstractPolygonMesh<M,V,E,P> & m)
+{
+    std::vector<vec3d>  terms;
+    std::vector<double> p_area;
+    gradient_corner_terms(m, p_off, c_vid, terms, p_area);
+
+    nv = m.num_verts();
+    cx.resize(c_vid.size());
+    cy.resize(c_vid.size());
+    cz.resize(c_vid.size());
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        for(uint c=p_off[pid]; c<p_off[pid+1]; ++c)
+        {
+            vec3d g = terms[c];
+            g /= p_area[pid];
+            cx[c] = g.x();
+            cy[c] = g.y();
+            cz[c] = g.z();
         }
+    });
+    finalize();
+}
 
-        G.setFromTriplets(entries.begin(), entries.end());
-        return G;
-    }
-    else // per vert
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+GradientOperator::GradientOperator(const AbstractPolyhedralMesh<M,V,E,F,P> & m)
+{
+    nv = m.num_verts();
+    p_off.resize(m.num_polys()+1);
+    p_off[0] = 0;
+    for(uint pid=0; pid<m.num_polys(); ++pid) p_off[pid+1] = p_off[pid] + m.verts_per_poly(pid);
+    c_vid.resize(p_off.back());
+    cx.resize(p_off.back());
+    cy.resize(p_off.back());
+    cz.resize(p_off.back());
+
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
     {
-        Eigen::SparseMatrix<double> G(m.num_polys()*3, m.num_verts());
-        std::vector<Entry> entries;
+        double vol = std::max(m.poly_volume(pid), 1e-5);
+        uint   beg = p_off[pid];
+        uint   end = beg;
 
-        for(uint pid=0; pid<m.num_polys(); ++pid)
+        for(uint vid : m.adj_p2v(pid))
         {
-            double vol = std::max(m.poly_volume(pid), 1e-5);
-
-            for(uint vid : m.adj_p2v(pid))
+            vec3d per_vert_sum_over_f_normals(0,0,0);
+            for(uint fid : m.adj_p2f(pid))
             {
-                vec3d per_vert_sum_over_f_normals(0,0,0);
-                for(uint fid : m.adj_p2f(pid))
+                if (m.face_contains_vert(fid,vid))
                 {
-                    if (m.face_contains_vert(fid,vid))
-                    {
-                        vec3d  n   = m.poly_face_normal(pid,fid);
-                        double a   = m.face_area(fid);
-                        double avg = static_cast<double>(m.verts_per_face(fid));
-                        per_vert_sum_over_f_normals += (n*a)/avg;
-                    }
+                    vec3d  n   = m.poly_face_normal(pid,fid);
+                    double a   = m.face_area(fid);
+                    double avg = static_cast<double>(m.verts_per_face(fid));
+                    per_vert_sum_over_f_normals += (n*a)/avg;
                 }
-                per_vert_sum_over_f_normals /= vol;
-                uint row = 3 * pid;
-                entries.push_back(Entry(row, vid, per_vert_sum_over_f_normals.x())); ++row;
-                entries.push_back(Entry(row, vid, per_vert_sum_over_f_normals.y())); ++row;
-                entries.push_back(Entry(row, vid, per_vert_sum_over_f_normals.z()));
             }
+            per_vert_sum_over_f_normals /= vol;
+
+            // insertion sort by vertex id (elements have very few corners)
+            uint i = end++;
+            while(i>beg && c_vid[i-1]>vid)
+            {
+                c_vid[i] = c_vid[i-1];
+                cx[i]    = cx[i-1];
+                cy[i]    = cy[i-1];
+                cz[i]    = cz[i-1];
+                --i;
+            }
+            c_vid[i] = vid;
+            cx[i]    = per_vert_sum_over_f_normals.x();
+            cy[i]    = per_vert_sum_over_f_normals.y();
+            cz[i]    = per_vert_sum_over_f_normals.z();
         }
-        G.setFromTriplets(entries.begin(), entries.end());
+    });
+    finalize();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void GradientOperator::finalize()
+{
+    // vert to corner incidence (corners are listed by increasing element id)
+    uint nc = uint(c_vid.size());
+    c_pid.resize(nc);
+    for(uint pid=0; pid<num_polys(); ++pid)
+    for(uint c=p_off[pid]; c<p_off[pid+1]; ++c) c_pid[c] = pid;
+
+    v_off.assign(nv+1, 0);
+    for(uint c=0; c<nc; ++c) ++v_off[c_vid[c]+1];
+    for(uint vid=0; vid<nv; ++vid) v_off[vid+1] += v_off[vid];
+    v_corners.resize(nc);
+    std::vector<uint> pos(v_off.begin(), v_off.end()-1);
+    for(uint c=0; c<nc; ++c) v_corners[pos[c_vid[c]]++] = c;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        Eigen::SparseMatrix<double> A(m.num_verts()*3, m.num_polys()*3);
-        entries.clear();
+CINO_INLINE
+void GradientOperator::grad(const double * f, double * g) const
+{
+    const uint   * vid = c_vid.data();
+    const double * x   = cx.data();
+    const double * y   = cy.data();
+    const double * z   = cz.data();
 
-        for(uint vid=0;vid<m.num_verts();++vid)
+    PARALLEL_FOR(0, num_polys(), 1000, [&](uint pid)
+    {
+        double gx = 0.0, gy = 0.0, gz = 0.0;
+        for(uint c=p_off[pid]; c<p_off[pid+1]; ++c)
         {
-            double total_volume=0;
-            for(uint pid : m.adj_v2p(vid))
-            {
-                total_volume += m.poly_volume(pid);
-            }
-            uint row = 3*vid;
-            for(uint pid : m.adj_v2p(vid))
-            {
-                uint col=3*pid;
-                entries.push_back(Entry(row,  col,   m.poly_volume(pid)/total_volume));
-                entries.push_back(Entry(row+1,col+1, m.poly_volume(pid)/total_volume));
-                entries.push_back(Entry(row+2,col+2, m.poly_volume(pid)/total_volume));
-            }
+            double fc = f[vid[c]];
+            gx += x[c] * fc;
+            gy += y[c] * fc;
+            gz += z[c] * fc;
         }
-        A.setFromTriplets(entries.begin(), entries.end());
-        return A*G;
+        g[3*pid  ] = gx;
+        g[3*pid+1] = gy;
+        g[3*pid+2] = gz;
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void GradientOperator::div(const double * g, double * f) const
+{
+    PARALLEL_FOR(0, nv, 1000, [&](uint vid)
+    {
+        double sum = 0.0;
+        for(uint i=v_off[vid]; i<v_off[vid+1]; ++i)
+        {
+            uint c   = v_corners[i];
+            uint row = 3*c_pid[c];
+            sum += cx[c] * g[row  ];
+            sum += cy[c] * g[row+1];
+            sum += cz[c] * g[row+2];
+        }
+        f[vid] = sum;
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Eigen::VectorXd GradientOperator::grad(const Eigen::VectorXd & f) const
+{
+    assert(f.size() == nv);
+    Eigen::VectorXd g(3*num_polys());
+    grad(f.data(), g.data());
+    return g;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Eigen::VectorXd GradientOperator::div(const Eigen::VectorXd & g) const
+{
+    assert(g.size() == 3*num_polys());
+    Eigen::VectorXd f(nv);
+    div(g.data(), f.data());
+    return f;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Eigen::SparseMatrix<double> GradientOperator::matrix() const
+{
+    // rows are known in advance (three per element, one entry per corner),
+    // hence the matrix is filled directly in CSR format, in parallel
+    Eigen::SparseMatrix<double,Eigen::RowMajor> G(3*num_polys(), nv);
+    G.resizeNonZeros(3*c_vid.size());
+    int    *outer = G.outerIndexPtr();
+    int    *inner = G.innerIndexPtr();
+    double *value = G.valuePtr();
+
+    for(uint pid=0; pid<num_polys(); ++pid)
+    {
+        uint n = p_off[pid+1] - p_off[pid];
+        outer[3*pid  ] = 3*p_off[pid];
+        outer[3*pid+1] = 3*p_off[pid] + n;
+        outer[3*pid+2] = 3*p_off[pid] + 2*n;
     }
+    outer[3*num_polys()] = 3*c_vid.size();
+
+    PARALLEL_FOR(0, num_polys(), 1000, [&](uint pid)
+    {
+        uint n = p_off[pid+1] - p_off[pid];
+        for(uint j=0; j<n; ++j)
+        {
+            uint c   = p_off[pid]+j;
+            uint dst = 3*p_off[pid]+j;
+            inner[dst    ] = c_vid[c]; value[dst    ] = cx[c];
+            inner[dst+  n] = c_vid[c]; value[dst+  n] = cy[c];
+            inner[dst+2*n] = c_vid[c]; value[dst+2*n] = cz[c];
+        }
+    });
+
+    return Eigen::SparseMatrix<double>(G);
 }
 
 }
@@ -87,6 +87,74 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 Eigen::SparseMatrix<double> gradient_matrix(const AbstractPolyhedralMesh<M,V,E,F,P> & m, const bool per_poly = true);
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+/* Matrix free version of the (per element) gradient matrix. The operator stores
+ * one gradient coefficient (a 3D vector) and one vertex index for each corner of
+ * each element, and applies the gradient (G*f) and its transpose (G^T*g, i.e.
+ * the divergence used in the heat method) on the fly. Both products run in
+ * parallel and do not require any matrix assembly, hence they are well suited
+ * for callers that only need to apply the operator a few times.
+ *
+ * Results are the same that would be obtained multiplying by the matrix returned
+ * by gradient_matrix(m), which can also be obtained from the operator with matrix()
+ * Note that the operator does not track the mesh: if vertices move, it must be
+ * constructed again.
+*/
+
+class GradientOperator
+{
+    public:
+
+        GradientOperator() {}
+
+        template<class M, class V, class E, class P>
+        GradientOperator(const AbstractPolygonMesh<M,V,E,P> & m);
+
+        template<class M, class V, class E, class F, class P>
+        GradientOperator(const AbstractPolyhedralMesh<M,V,E,F,P> & m);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void grad(const double * f, double * g) const; // f has one entry per vertex, g three per element
+        void div (const double * g, double * f) const; // G^T*g
+
+        Eigen::VectorXd grad(const Eigen::VectorXd & f) const;
+        Eigen::VectorXd div (const Eigen::VectorXd & g) const;
+
+        Eigen::SparseMatrix<double> matrix() const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint num_verts() const { return nv; }
+        uint num_polys() const { return p_off.empty() ? 0 : uint(p_off.size()-1); }
+
+    protected:
+
+        void finalize();
+
+        uint                nv = 0;
+        std::vector<uint>   p_off;      // corners of element pid are in [p_off[pid], p_off[pid+1]), sorted by vertex id
+        std::vector<uint>   c_vid;      // vertex of each corner
+        std::vector<double> cx, cy, cz; // gradient coefficient of each corner
+        std::vector<uint>   v_off;      // corners incident to vertex vid are v_corners[v_off[vid]...v_off[vid+1]]
+        std::vector<uint>   v_corners;
+        std::vector<uint>   c_pid;      // element of each corner
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Green-Gauss terms of each polygon corner (i.e. the sum of the normals of the two incident edges,
+// scaled by their length), stored per polygon as in GradientOperator. p_area contains twice the area
+// of each polygon (2 is the average term : two verts for each edge)
+template<class M, class V, class E, class P>
+CINO_INLINE
+void gradient_corner_terms(const AbstractPolygonMesh<M,V,E,P> & m,
+                                 std::vector<uint>            & p_off,
+                                 std::vector<uint>            & c_vid,
+                                 std::vector<vec3d>           & terms,
+                                 std::vector<double>          & p_area);
+
 }
 
 #ifndef  CINO_STATIC_LIB
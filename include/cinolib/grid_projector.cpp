@@ -96,10 +96,10 @@ double grid_projector(      Hexmesh<M1,V1,E1,F1,P1> & m,
         }
         switch(count)
         {
-            case 0  : m.vert_data(vid).label = REGULAR; break;
-            case 1  : m.vert_data(vid).label = CORNER;  break;
-            case 2  : m.vert_data(vid).label = LINE;    break;
-            default : m.vert_data(vid).label = CORNER;
+            case 0  : m.vert_label(vid) = REGULAR; break;
+            case 1  : m.vert_label(vid) = CORNER;  break;
+            case 2  : m.vert_label(vid) = LINE;    break;
+            default : m.vert_label(vid) = CORNER;
         }
     }
 
@@ -142,7 +142,7 @@ double grid_projector(      Hexmesh<M1,V1,E1,F1,P1> & m,
         {
             Proj proj;
             proj.vid    = vid;
-            switch(m.vert_data(vid).label)
+            switch(m.vert_label(vid))
             {
                 case REGULAR : proj.target = (m.vert_is_on_srf(vid)) ? o_srf.closest_point(verts.at(vid)) : verts.at(vid); break;
                 case CORNER  : proj.target = o_corners.closest_point(verts.at(vid)); break;
@@ -0,0 +1,159 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/heat_kernel.h>
+#include <cinolib/laplacian.h>
+#include <cinolib/vertex_mass.h>
+#include <cinolib/parallel_for.h>
+#ifdef CINOLIB_USES_SPECTRA
+#include <cinolib/matrix_eigenfunctions.h>
+#endif
+#include <algorithm>
+#include <thread>
+
+namespace cinolib
+{
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+HeatKernel::HeatKernel(const AbstractMesh<M,V,E,P> & m)
+{
+    L  = cinolib::laplacian(m, COTANGENT);
+    MM = cinolib::mass_matrix(m);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Eigen::MatrixXd HeatKernel::eval_exact(const std::vector<double> & timesteps,
+                                       const std::vector<uint>   & landmarks,
+                                       const bool                  parallel) const
+{
+    uint nv = uint(L.rows());
+    uint nl = uint(landmarks.size());
+    Eigen::MatrixXd A(nv, timesteps.size()*nl);
+
+    // landmarks are split in blocks of contiguous columns, one per thread. Each
+    // block is solved as a single multi column right hand side
+    uint n_threads = parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    uint n_blocks  = std::max(1u, std::min(nl, n_threads));
+    uint blk_size  = (nl + n_blocks - 1) / n_blocks;
+
+    for(uint i=0; i<timesteps.size(); ++i)
+    {
+        Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> solver(MM - timesteps.at(i)*L);
+        assert(solver.info() == Eigen::Success);
+
+        PARALLEL_FOR(0, n_blocks, 2, [&](uint b)
+        {
+            uint beg = b*blk_size;
+            uint end = std::min(nl, beg+blk_size);
+            if(beg>=end) return;
+            Eigen::MatrixXd rhs = Eigen::MatrixXd::Zero(nv, end-beg);
+            for(uint j=beg; j<end; ++j) rhs(landmarks.at(j), j-beg) = 1.0;
+            A.middleCols(i*nl+beg, end-beg) = solver.solve(rhs);
+        });
+    }
+    return A;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+#ifdef CINOLIB_USES_SPECTRA
+CINO_INLINE
+bool HeatKernel::compute_eigenbasis(const uint n_eigs)
+{
+    // the generalized problem -L*phi = lambda*M*phi is turned into a standard
+    // symmetric one by scaling with the inverse square root of the (diagonal)
+    // mass matrix: S = M^-1/2 * (-L) * M^-1/2, with phi = M^-1/2 * psi
+    uint nv = uint(L.rows());
+    Eigen::VectorXd m_inv_sqrt = MM.diagonal().cwiseSqrt().cwiseInverse();
+    Eigen::SparseMatrix<double> S = -(m_inv_sqrt.asDiagonal() * L * m_inv_sqrt.asDiagonal());
+
+    std::vector<double> f, f_min, f_max;
+    if(!matrix_eigenfunctions(S, true, int(n_eigs), f, f_min, f_max)) return false;
+
+    Eigen::MatrixXd psi = Eigen::Map<Eigen::MatrixXd>(f.data(), nv, n_eigs);
+    Eigen::VectorXd lambda(n_eigs);
+    for(uint i=0; i<n_eigs; ++i)
+    {
+        // Rayleigh quotient (psi is unit length)
+        lambda[i] = std::max(0.0, psi.col(i).dot(S * psi.col(i)));
+    }
+    set_eigenbasis(lambda, m_inv_sqrt.asDiagonal() * psi);
+    return true;
+}
+#endif
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void HeatKernel::set_eigenbasis(const Eigen::VectorXd & eigenvalues,
+                                const Eigen::MatrixXd & eigenvectors)
+{
+    assert(eigenvectors.rows()==L.rows());
+    assert(eigenvectors.cols()==eigenvalues.size());
+    evals = eigenvalues;
+    evecs = eigenvectors;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Eigen::MatrixXd HeatKernel::eval_spectral(const std::vector<double> & timesteps,
+                                          const std::vector<uint>   & landmarks,
+                                          const bool                  exponential) const
+{
+    assert(has_eigenbasis());
+
+    // A = Phi * R, where column (t,v) of R is g(t*Lambda) * Phi^T * e_v, with
+    // g(x) = 1/(1+x) (implicit Euler) or exp(-x) (heat kernel)
+    uint k  = uint(evecs.cols());
+    uint nl = uint(landmarks.size());
+    Eigen::MatrixXd R(k, timesteps.size()*nl);
+    for(uint i=0; i<timesteps.size(); ++i)
+    {
+        Eigen::VectorXd g = -timesteps.at(i)*evals;
+        if(exponential) g = g.array().exp();
+        else            g = (1.0 - g.array()).inverse();
+        for(uint j=0; j<nl; ++j)
+        {
+            R.col(i*nl+j) = g.cwiseProduct(evecs.row(landmarks.at(j)).transpose());
+        }
+    }
+    return evecs * R;
+}
+
+}
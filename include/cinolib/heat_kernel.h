@@ -0,0 +1,122 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_HEAT_KERNEL_H
+#define CINO_HEAT_KERNEL_H
+
+#include <cinolib/meshes/abstract_mesh.h>
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+namespace cinolib
+{
+
+/* Heat diffusion from a set of source vertices (landmarks), evaluated at multiple
+ * time steps. This is the engine behind HKS, and computes, for each time step t
+ * and landmark v, the function
+ *
+ *      u = (M - t*L)^-1 * e_v
+ *
+ * where L is the cotangent Laplacian, M the (lumped) mass matrix and e_v the
+ * indicator vector of v. There are two modes of evaluation:
+ *
+ *  - exact   : the matrix M - t*L is factorized once per time step, and all the
+ *              landmarks are solved as a single multi column right hand side,
+ *              split in blocks that are processed in parallel.
+ *
+ *  - spectral: a truncated basis of k generalized eigenfunctions L*phi = -lambda*M*phi
+ *              (M-orthonormal) is computed once. Since (M - t*L)^-1 = Phi*(I + t*Lambda)^-1*Phi^T,
+ *              any number of time steps and landmarks is then evaluated with a single
+ *              dense matrix product, with no further linear solves. The result is the
+ *              low frequency approximation of the exact one, and converges to it as k grows.
+ *              The basis can be computed with Spectra (see matrix_eigenfunctions), or
+ *              provided by the user (e.g. if it is already available from other tasks).
+ *
+ * Results are matrices with one row per vertex, and one column for each (time step,
+ * landmark) pair, ordered by time step first, and then by landmark.
+*/
+
+class HeatKernel
+{
+    public:
+
+        template<class M, class V, class E, class P>
+        explicit HeatKernel(const AbstractMesh<M,V,E,P> & m);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        Eigen::MatrixXd eval_exact(const std::vector<double> & timesteps,
+                                   const std::vector<uint>   & landmarks,
+                                   const bool                  parallel = true) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+#ifdef CINOLIB_USES_SPECTRA
+        bool compute_eigenbasis(const uint n_eigs); // false if Spectra did not converge
+#endif
+        void set_eigenbasis(const Eigen::VectorXd & eigenvalues,   // k (non negative)
+                            const Eigen::MatrixXd & eigenvectors); // #verts x k (M-orthonormal)
+
+        bool                    has_eigenbasis() const { return evecs.cols()>0; }
+        const Eigen::VectorXd & eigenvalues()    const { return evals; }
+        const Eigen::MatrixXd & eigenvectors()   const { return evecs; }
+
+        // if exponential is true, the actual heat kernel Phi*exp(-t*Lambda)*Phi^T is evaluated
+        // in place of the (implicit Euler) one above. It is smoother, hence better approximated
+        // by a truncated basis, but it has no exact counterpart
+        Eigen::MatrixXd eval_spectral(const std::vector<double> & timesteps,
+                                      const std::vector<uint>   & landmarks,
+                                      const bool                  exponential = false) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        const Eigen::SparseMatrix<double> & laplacian()   const { return L;  }
+        const Eigen::SparseMatrix<double> & mass_matrix() const { return MM; }
+
+    protected:
+
+        Eigen::SparseMatrix<double> L;
+        Eigen::SparseMatrix<double> MM;
+        Eigen::VectorXd             evals;
+        Eigen::MatrixXd             evecs;
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "heat_kernel.cpp"
+#endif
+
+#endif // CINO_HEAT_KERNEL_H
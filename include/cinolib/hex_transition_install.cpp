@@ -106,9 +106,9 @@ int find_min_ref(const Polyhedralmesh<M,V,E,F,P> & m, const uint vid)
     int min_ref = max_int;
     for(uint pid : m.adj_v2p(vid))
     {
-        if(m.poly_data(pid).label < min_ref)
+        if(m.poly_label(pid) < min_ref)
         {
-            min_ref = m.poly_data(pid).label;
+            min_ref = m.poly_label(pid);
         }
     }
     return min_ref;
@@ -125,9 +125,9 @@ int find_max_ref(const Polyhedralmesh<M,V,E,F,P> & m, const uint vid)
     int max_ref = -1;
     for(uint pid : m.adj_v2p(vid))
     {
-        if(m.poly_data(pid).label > max_ref)
+        if(m.poly_label(pid) > max_ref)
         {
-            max_ref = m.poly_data(pid).label;
+            max_ref = m.poly_label(pid);
         }
     }
     return max_ref;
@@ -192,7 +192,7 @@ void mark_concave_vert(const Polyhedralmesh<M,V,E,F,P>     & m,
     {
         for(uint pid : m.adj_v2p(vid))
         {
-            if(m.poly_data(pid).label == min_ref)
+            if(m.poly_label(pid) == min_ref)
             {
                 adj_polys_cluster.insert(pid);
             }
@@ -271,7 +271,7 @@ void mark_concave_vert(const Polyhedralmesh<M,V,E,F,P>     & m,
             std::set<uint> refs;
             for(uint adj : m.adj_v2p(middle_vid))
             {
-                refs.insert(m.poly_data(adj).label);
+                refs.insert(m.poly_label(adj));
             }
 
             if(refs.size() > 1)
@@ -342,7 +342,7 @@ void mark_concave_vert(const Polyhedralmesh<M,V,E,F,P>     & m,
                             std::set<uint> refs;
                             for(uint adj : m.adj_v2p(middle_vid))
                             {
-                                refs.insert(m.poly_data(adj).label);
+                                refs.insert(m.poly_label(adj));
                             }
                             if(refs.size() > 1)
                             {
@@ -367,11 +367,11 @@ void mark_concave_vert(const Polyhedralmesh<M,V,E,F,P>     & m,
                 }
                 else
                 {
-                    uint curr_ref = m.poly_data(pid).label;
+                    uint curr_ref = m.poly_label(pid);
                     std::set<uint> refs;
                     for(uint adj : m.adj_v2p(vid)){
-                        if(m.poly_data(adj).label >= curr_ref){
-                            refs.insert(m.poly_data(adj).label);
+                        if(m.poly_label(adj) >= curr_ref){
+                            refs.insert(m.poly_label(adj));
                         }
                     }
                     if(refs.size() >= 2) info.t_verts.push_back(m.vert(vid));
@@ -439,7 +439,7 @@ void mark_concave_edge(const Polyhedralmesh<M,V,E,F,P>     & m,
     int ref = 0;
     for(uint pid : m.adj_v2p(t_verts[0])){
         if(m.poly_contains_vert(pid, t_verts[1])){
-            ref = m.poly_data(pid).label;
+            ref = m.poly_label(pid);
             break;
         }
     }
@@ -451,8 +451,8 @@ void mark_concave_edge(const Polyhedralmesh<M,V,E,F,P>     & m,
         std::set<int> refs;
         for(uint pid : m.adj_v2p(vid))
         {
-            if(ref <= m.poly_data(pid).label)
-                refs.insert(m.poly_data(pid).label);
+            if(ref <= m.poly_label(pid))
+                refs.insert(m.poly_label(pid));
         }
         if(refs.size() == 2)
         {
@@ -474,7 +474,7 @@ void mark_concave_edge(const Polyhedralmesh<M,V,E,F,P>     & m,
     for(uint pid : m.adj_v2p(conc_edge_vid))
     {
         if(!(m.poly_contains_vert(pid, t_verts[0]) && m.poly_contains_vert(pid, t_verts[1]))) continue;
-        if(m.poly_data(pid).label == min_ref)
+        if(m.poly_label(pid) == min_ref)
         {
             auto query = poly2scheme.find(pid);
             if(query == poly2scheme.end() || query->second.type == HexTransition::FLAT || query->second.type == HexTransition::FLAT_CONVEX){
@@ -507,7 +507,7 @@ void mark_concave_edge(const Polyhedralmesh<M,V,E,F,P>     & m,
                 std::set<uint> refs;
                 for(uint adj : m.adj_v2p(middle_vid))
                 {
-                    refs.insert(m.poly_data(adj).label);
+                    refs.insert(m.poly_label(adj));
                 }
                 if(refs.size() > 1)
                 {
@@ -531,7 +531,7 @@ void mark_concave_edge(const Polyhedralmesh<M,V,E,F,P>     & m,
     {
         for(uint pid : m.adj_v2p(t_verts[i]))
         {
-            if(m.poly_contains_vert(pid, conc_edge_vid) || m.poly_data(pid).label != min_ref) continue;
+            if(m.poly_contains_vert(pid, conc_edge_vid) || m.poly_label(pid) != min_ref) continue;
             if(poly2scheme.find(pid) == poly2scheme.end())
             {
                 SchemeInfo info;
@@ -607,7 +607,7 @@ void mark_convex(const Polyhedralmesh<M,V,E,F,P>     & m,
 
     for(uint pid : m.adj_v2p(conv_edge_vert))
     {
-        if(m.poly_data(pid).label == min_ref)
+        if(m.poly_label(pid) == min_ref)
         {
             if(m.poly_contains_vert(pid, t_verts[0]) || m.poly_contains_vert(pid, t_verts[1])) continue;
 
@@ -692,7 +692,7 @@ void mark_flat(const Polyhedralmesh<M,V,E,F,P>     & m,
 
     for(uint pid : m.adj_v2p(t_vert))
     {
-        if(m.poly_data(pid).label == min_ref)
+        if(m.poly_label(pid) == min_ref)
         {
             if(poly2scheme.find(pid) == poly2scheme.end())
             {
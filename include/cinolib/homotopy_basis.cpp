@@ -200,7 +200,7 @@ void detach_loops(Trimesh<M,V,E,P>  & m,
         uint val_2 = 0; // 2 or more
         for(uint eid : m.adj_v2e(vid))
         {
-            switch(m.edge_data(eid).label)
+            switch(m.edge_label(eid))
             {
                 case -1: assert(false); break;
                 case  0:                break;
@@ -249,7 +249,7 @@ uint detach_loops(Trimesh<M,V,E,P>  & m,
     std::vector<std::pair<int,uint>> loop_edges; // { #loops , eid }
     for(uint eid : e_star)
     {
-        int n_loops = m.edge_data(eid).label;
+        int n_loops = m.edge_label(eid);
         if(n_loops>0) loop_edges.push_back(std::make_pair(n_loops,eid));
     }
     assert(loop_edges.size()>=3);
@@ -343,7 +343,7 @@ uint detach_loops_by_vert_split(Trimesh<M,V,E,P>  & m,
     uint v_mid  = m.vert_shared(e_out, e_in);
     uint v_in   = m.vert_opposite_to(e_in, v_mid);
     uint v_out  = m.vert_opposite_to(e_out, v_mid);
-    int  val_in = m.edge_data(e_in).label;
+    int  val_in = m.edge_label(e_in);
 
     uint star_size = m.vert_valence(v_mid);
     data.refinement_stats.vert_val_max  = std::max(data.refinement_stats.vert_val_max, star_size);
@@ -354,7 +354,7 @@ uint detach_loops_by_vert_split(Trimesh<M,V,E,P>  & m,
     for(uint eid : m.adj_v2e(v_mid))
     {
         if(eid==e_in || eid==e_out) continue;
-        int val = m.edge_data(eid).label;
+        int val = m.edge_label(eid);
         if(val>0) others.push_back(std::make_pair(m.vert_opposite_to(eid,v_mid),val));
     }
 
@@ -364,8 +364,8 @@ uint detach_loops_by_vert_split(Trimesh<M,V,E,P>  & m,
     m.vert(v_new) = new_pos;
 
     // reset loop topology inside the refined umbrella
-    for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).label = 0;
-    for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).label = 0;
+    for(uint eid : m.adj_v2e(v_mid)) m.edge_label(eid) = 0;
+    for(uint eid : m.adj_v2e(v_new)) m.edge_label(eid) = 0;
 
     int e_in_new  = m.edge_id(v_in,  v_new);
     int e_out_new = m.edge_id(v_out, v_new);
@@ -383,23 +383,23 @@ uint detach_loops_by_vert_split(Trimesh<M,V,E,P>  & m,
         if(e_old>=0)
         {
             assert(e_new==-1);
-            m.edge_data(e_old).label  = val;
-            m.edge_data(e_out).label += val;
+            m.edge_label(e_old)  = val;
+            m.edge_label(e_out) += val;
         }
         else
         {
             assert(e_new>=0);
             assert(e_old==-1);
-            m.edge_data(e_new).label  = val;
-            m.edge_data(e_out_new).label += val;
+            m.edge_label(e_new)  = val;
+            m.edge_label(e_out_new) += val;
         }
     }
 
     // restore loop info on { e_in , e_out }
-    if(m.edge_data(e_out_new).label==0)
+    if(m.edge_label(e_out_new)==0)
     {
-        m.edge_data(e_in_new).label  = val_in;
-        m.edge_data(e_out_new).label = val_in;
+        m.edge_label(e_in_new)  = val_in;
+        m.edge_label(e_out_new) = val_in;
     }
     else
     {
@@ -412,9 +412,9 @@ uint detach_loops_by_vert_split(Trimesh<M,V,E,P>  & m,
         // around v_mid starting from e_out, therefore at least on
         // side of { e_in, e_out } there can't be another edge traversed
         // by a loop
-        assert(m.edge_data(e_out).label==0);
-        m.edge_data(e_in).label  = val_in;
-        m.edge_data(e_out).label = val_in;
+        assert(m.edge_label(e_out)==0);
+        m.edge_label(e_in)  = val_in;
+        m.edge_label(e_out) = val_in;
 
         // v_mid is at the same side of the triangle strip. switch vertex positions...
         std::swap(m.vert(v_mid),m.vert(v_new));
@@ -427,15 +427,15 @@ uint detach_loops_by_vert_split(Trimesh<M,V,E,P>  & m,
     m.update_v_normal(v_new);
 
     // update flags
-    for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).flags[MARKED] = m.edge_data(eid).label>0;
-    for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).flags[MARKED] = m.edge_data(eid).label>0;
+    for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).flags[MARKED] = m.edge_label(eid)>0;
+    for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).flags[MARKED] = m.edge_label(eid)>0;
 
     // next one ring to process...
     uint count = 0;
-    for(uint eid : m.adj_v2e(v_mid)) if(m.edge_data(eid).label>0) ++count;
+    for(uint eid : m.adj_v2e(v_mid)) if(m.edge_label(eid)>0) ++count;
     if(count>2) return v_mid;
     count = 0;
-    for(uint eid : m.adj_v2e(v_new)) if(m.edge_data(eid).label>0) ++count;
+    for(uint eid : m.adj_v2e(v_new)) if(m.edge_label(eid)>0) ++count;
     if(count>2) return v_new;
     return v_out;
 }
@@ -459,8 +459,8 @@ uint detach_loops_by_edge_split(Trimesh<M,V,E,P>        & m,
     uint v_mid   = m.vert_shared(e_in, e_out);
     uint v_in    = m.vert_opposite_to(e_in, v_mid);
     uint v_out   = m.vert_opposite_to(e_out, v_mid);
-    int  val_in  = m.edge_data(e_in).label;
-    int  val_out = m.edge_data(e_out).label;
+    int  val_in  = m.edge_label(e_in);
+    int  val_out = m.edge_label(e_out);
     assert(val_in>0);
     assert(val_out > val_in);
 
@@ -472,7 +472,7 @@ uint detach_loops_by_edge_split(Trimesh<M,V,E,P>        & m,
     for(uint i=1; i<edge_fan.size()-1; ++i)
     {
         uint eid = edge_fan.at(i);
-        assert(m.edge_data(eid).label==0);
+        assert(m.edge_label(eid)==0);
         // optimally place newly inserted vertex according to the valence balance between the two disjoint paths
         vec3d A = m.vert(v_mid);
         vec3d B = m.vert(m.vert_opposite_to(eid, v_mid));
@@ -482,7 +482,7 @@ uint detach_loops_by_edge_split(Trimesh<M,V,E,P>        & m,
         //std::cout << t << std::endl;
         uint v_new = m.edge_split(eid, C);
         new_chain.push_back(v_new);
-        for(uint nbr : m.adj_v2e(v_new)) m.edge_data(nbr).label = 0;
+        for(uint nbr : m.adj_v2e(v_new)) m.edge_label(nbr) = 0;
     }
     new_chain.push_back(v_in);
 
@@ -490,21 +490,21 @@ uint detach_loops_by_edge_split(Trimesh<M,V,E,P>        & m,
     {
         int eid = m.edge_id(*i,*j);
         assert(eid>=0);
-        assert(m.edge_data(eid).label==0);
-        m.edge_data(eid).label=val_in;
+        assert(m.edge_label(eid)==0);
+        m.edge_label(eid)=val_in;
     }
 
-    m.edge_data(e_in).label   = 0;
-    m.edge_data(e_out).label -= val_in;
-    assert(m.edge_data(e_out).label>0);
+    m.edge_label(e_in)   = 0;
+    m.edge_label(e_out) -= val_in;
+    assert(m.edge_label(e_out)>0);
 
     // update flags
-    for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).flags[MARKED] = m.edge_data(eid).label>0;
-    for(uint v_new : new_chain) for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).flags[MARKED] = m.edge_data(eid).label>0;
+    for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).flags[MARKED] = m.edge_label(eid)>0;
+    for(uint v_new : new_chain) for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).flags[MARKED] = m.edge_label(eid)>0;
 
     // next one ring to process...
     uint count = 0;
-    for(uint eid : m.adj_v2e(v_mid)) if(m.edge_data(eid).label>0) ++count;
+    for(uint eid : m.adj_v2e(v_mid)) if(m.edge_label(eid)>0) ++count;
     if(count>2) return v_mid;
     return v_out;
 }
@@ -542,8 +542,8 @@ uint detach_loops_by_poly_split(Trimesh<M,V,E,P>  & /*m*/,
     //uint v_in      = m.vert_opposite_to(e_in, v_mid);
     //uint v_out     = m.vert_opposite_to(e_out, v_mid);
     // int pid       = m.poly_id(e_in, e_out);     assert(pid>=0);
-    // int val_in    = m.edge_data(e_in).label;    assert(val_in>0);
-    // int val_out   = m.edge_data(e_out).label;   assert(val_out>val_in);
+    // int val_in    = m.edge_label(e_in);    assert(val_in>0);
+    // int val_out   = m.edge_label(e_out);   assert(val_out>val_in);
     //uint v_new     = m.poly_split(pid);
     // int e_in_new  = m.edge_id(v_in, v_new);     assert(e_in_new>=0);
     // int e_out_new = m.edge_id(v_out, v_new);    assert(e_out_new>=0);
@@ -553,15 +553,15 @@ uint detach_loops_by_poly_split(Trimesh<M,V,E,P>  & /*m*/,
     //data.refinement_stats.vert_val_max  = std::max(data.refinement_stats.vert_val_max, star_size);
     //data.refinement_stats.vert_val_avg += star_size;
 
-    //m.edge_data(e_in).label      = 0;
-    //m.edge_data(e_out).label    -= val_in;
-    //m.edge_data(e_in_new).label  = val_in;
-    //m.edge_data(e_out_new).label = val_in;
-    //m.edge_data(e_dummy).label   = 0;
+    //m.edge_label(e_in)      = 0;
+    //m.edge_label(e_out)    -= val_in;
+    //m.edge_label(e_in_new)  = val_in;
+    //m.edge_label(e_out_new) = val_in;
+    //m.edge_label(e_dummy)   = 0;
 
     //// update flags
-    //for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).flags[MARKED] = m.edge_data(eid).label>0;
-    //for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).flags[MARKED] = m.edge_data(eid).label>0;
+    //for(uint eid : m.adj_v2e(v_mid)) m.edge_data(eid).flags[MARKED] = m.edge_label(eid)>0;
+    //for(uint eid : m.adj_v2e(v_new)) m.edge_data(eid).flags[MARKED] = m.edge_label(eid)>0;
 
     //return v_out;
 }
@@ -583,7 +583,7 @@ void detach_loops_preproc(Trimesh<M,V,E,P>  & m,
             uint v0  = loop.at(i);
             uint v1  = loop.at((i+1)%loop.size());
              int eid = m.edge_id(v0, v1);
-            m.edge_data(eid).label++;
+            m.edge_label(eid)++;
             m.edge_data(eid).flags[MARKED] = true;
         }
     }
@@ -605,14 +605,14 @@ void detach_loops_postproc(Trimesh<M,V,E,P>  & m,
     for(uint eid: m.adj_v2e(data.root))
     {
         if(m.edge_data(eid).flags[MARKED]) continue;
-        if(m.edge_data(eid).label>0)
+        if(m.edge_label(eid)>0)
         {
             int loop_id = data.loops.size();
             std::vector<uint> loop;
             loop.push_back(data.root);
             loop.push_back(m.vert_opposite_to(eid, data.root));
             m.edge_data(eid).flags[MARKED] = true;
-            m.edge_data(eid).label = loop_id;
+            m.edge_label(eid) = loop_id;
 
             uint curr = loop.back();
             do
@@ -620,12 +620,12 @@ void detach_loops_postproc(Trimesh<M,V,E,P>  & m,
                 int next = -1;
                 for(uint eid : m.adj_v2e(curr))
                 {
-                    if(m.edge_data(eid).label>0 && !m.edge_data(eid).flags[MARKED])
+                    if(m.edge_label(eid)>0 && !m.edge_data(eid).flags[MARKED])
                     {
                         assert(next==-1);
                         next = m.vert_opposite_to(eid, curr);
                         m.edge_data(eid).flags[MARKED] = true;
-                        m.edge_data(eid).label = loop_id;
+                        m.edge_label(eid) = loop_id;
                     }
                 }
                 assert(next>=0);
@@ -633,15 +633,15 @@ void detach_loops_postproc(Trimesh<M,V,E,P>  & m,
                 curr = next;
             }
             while(curr != data.root);
-            for(uint vid : loop) m.vert_data(vid).label = loop_id;
+            for(uint vid : loop) m.vert_label(vid) = loop_id;
             data.loops.push_back(loop);
         }        
     }
     for(uint eid=0; eid<m.num_edges(); ++eid)
     {
-        if(!m.edge_data(eid).flags[MARKED]) m.edge_data(eid).label = -1;
+        if(!m.edge_data(eid).flags[MARKED]) m.edge_label(eid) = -1;
     }
-    m.vert_data(data.root).label = -1;
+    m.vert_label(data.root) = -1;
     assert((int)data.loops.size() == m.genus()*2);
 }
 
@@ -666,7 +666,7 @@ bool polys_are_planar(const Trimesh<M,V,E,P>  & m,
 
     std::vector<vec3d> n;
     n.reserve(poly_fan.size());
-    for(uint pid : poly_fan) n.push_back(m.poly_data(pid).normal);
+    for(uint pid : poly_fan) n.push_back(m.poly_normal(pid));
 
     for(auto i=n.begin(); i<n.end(); ++i)
     for(auto j=i+1;       j<n.end(); ++j)
@@ -708,7 +708,7 @@ bool find_position_within_fan(const Trimesh<M,V,E,P>  & m,
         bool reject = false;
         for(uint pid : poly_fan)
         {
-            vec3d n1 = m.poly_data(pid).normal;
+            vec3d n1 = m.poly_normal(pid);
             auto  v  = m.poly_verts(pid);
             if(m.poly_vert_id(pid,0)==v_mid) v.at(0) = pos; else
             if(m.poly_vert_id(pid,1)==v_mid) v.at(1) = pos; else
@@ -731,7 +731,7 @@ bool find_position_within_fan(const Trimesh<M,V,E,P>  & m,
             if(m.poly_vert_id(pid,1)==v_tmp) v.at(1) = pos; else
             if(m.poly_vert_id(pid,2)==v_tmp) v.at(2) = pos; else
             assert(false);
-            vec3d n1 = m.poly_data(pid).normal;
+            vec3d n1 = m.poly_normal(pid);
             vec3d n2 = triangle_normal(v.at(0), v.at(1), v.at(2));
             if(n2.is_deg() || n1.dot(n2) <= 0) reject = true;
         }
@@ -745,7 +745,7 @@ bool find_position_within_fan(const Trimesh<M,V,E,P>  & m,
             if(m.poly_vert_id(pid,1)==v_tmp) v.at(1) = pos; else
             if(m.poly_vert_id(pid,2)==v_tmp) v.at(2) = pos; else
             assert(false);
-            vec3d n1 = m.poly_data(pid).normal;
+            vec3d n1 = m.poly_normal(pid);
             vec3d n2 = triangle_normal(v.at(0), v.at(1), v.at(2));
             if(n2.is_deg() || n1.dot(n2) <= 0) reject = true;
         }
@@ -0,0 +1,120 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/io/write_CLI.h>
+#include <cinolib/parallel_for.h>
+#include <iostream>
+#include <string>
+#include <cstdio>
+
+namespace cinolib
+{
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void write_CLI(const char                                         * filename,
+               const std::vector<double>                          & z_levels,           // per slice z-coord
+               const std::vector<std::vector<std::vector<vec3d>>> & internal_polylines, // inner holes
+               const std::vector<std::vector<std::vector<vec3d>>> & external_polylines, // outer slice boundary
+               const std::vector<std::vector<std::vector<vec3d>>> & open_polylines,     // support structures
+               const std::vector<std::vector<std::vector<vec3d>>> & hatches)            // supports/infills
+{
+    setlocale(LC_NUMERIC, "en_US.UTF-8"); // makes sure "." is the decimal separator
+
+    uint n_layers = z_levels.size();
+    assert(internal_polylines.size()==n_layers || internal_polylines.empty());
+    assert(external_polylines.size()==n_layers || external_polylines.empty());
+    assert(open_polylines.size()    ==n_layers || open_polylines.empty());
+    assert(hatches.size()           ==n_layers || hatches.empty());
+
+    FILE *fp = fopen(filename, "w");
+    if(!fp)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : write_CLI() : couldn't save file " << filename << std::endl;
+        exit(-1);
+    }
+
+    fprintf(fp, "$$HEADERSTART\n$$ASCII\n$$UNITS/1\n$$VERSION/200\n$$LAYERS/%u\n$$HEADEREND\n$$GEOMETRYSTART\n", n_layers);
+
+    // format each layer in its own buffer
+    std::vector<std::string> layers(n_layers);
+    PARALLEL_FOR(0, n_layers, 64, [&](const uint l)
+    {
+        std::string & s = layers.at(l);
+        char buf[64];
+        auto append_point = [&](const vec3d & p)
+        {
+            int n = snprintf(buf, sizeof(buf), ",%.9g,%.9g", p.x(), p.y());
+            s.append(buf, n);
+        };
+        // dir: 0 => internal (clockwise), 1 => external (counter-clockwise), 2 => open
+        auto append_polyline = [&](const std::vector<vec3d> & pl, const uint dir)
+        {
+            bool closed = (dir<2);
+            int  n = snprintf(buf, sizeof(buf), "$$POLYLINE/1,%u,%zu", dir, pl.size() + (closed ? 1 : 0));
+            s.append(buf, n);
+            for(const vec3d & p : pl) append_point(p);
+            if(closed && !pl.empty()) append_point(pl.front());
+            s.push_back('\n');
+        };
+
+        int n = snprintf(buf, sizeof(buf), "$$LAYER/%.9g\n", z_levels.at(l));
+        s.append(buf, n);
+        if(!external_polylines.empty()) for(const auto & pl : external_polylines.at(l)) append_polyline(pl, 1);
+        if(!internal_polylines.empty()) for(const auto & pl : internal_polylines.at(l)) append_polyline(pl, 0);
+        if(!open_polylines.empty())     for(const auto & pl : open_polylines.at(l))     append_polyline(pl, 2);
+        if(!hatches.empty())
+        {
+            for(const auto & h : hatches.at(l))
+            {
+                n = snprintf(buf, sizeof(buf), "$$HATCHES/1,%zu", h.size()/2);
+                s.append(buf, n);
+                for(size_t i=0; i+1<h.size(); i+=2)
+                {
+                    append_point(h.at(i));
+                    append_point(h.at(i+1));
+                }
+                s.push_back('\n');
+            }
+        }
+    });
+
+    for(const std::string & s : layers) fwrite(s.data(), 1, s.size(), fp);
+    fprintf(fp, "$$GEOMETRYEND\n");
+    fclose(fp);
+}
+
+}
@@ -36,6 +36,8 @@
 #include <cinolib/isocontour.h>
 #include <cinolib/cino_inline.h>
 #include <cinolib/interval.h>
+#include <cinolib/parallel_for.h>
+#include <numeric>
 #include <queue>
 
 namespace cinolib
@@ -56,70 +58,112 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 Isocontour<M,V,E,P>::Isocontour(AbstractPolygonMesh<M,V,E,P> & m, double iso_value) : iso_value(iso_value)
 {
-    for(uint pid=0; pid<m.num_polys(); ++pid)
-    for(uint i=0; i< m.poly_tessellation(pid).size()/3; ++i)
+    auto tri_segment = [&](const uint pid, const uint i, vec3d seg[]) -> bool
     {
-        uint   vid0 = m.poly_tessellation(pid).at(3*i+0);
-        uint   vid1 = m.poly_tessellation(pid).at(3*i+1);
-        uint   vid2 = m.poly_tessellation(pid).at(3*i+2);
-
-        double f0   = m.vert_data(vid0).uvw[0];
-        double f1   = m.vert_data(vid1).uvw[0];
-        double f2   = m.vert_data(vid2).uvw[0];
-
-        // There are seven possible cases:
-        // 1) the curve coincides with (v0,v1)
-        // 2) the curve coincides with (v1,v2)
-        // 3) the curve coincides with (v2,v0)
-        // 4) the curve enters from (v0,v1) and exits from (v0,v2)
-        // 5) the curve enters from (v0,v1) and exits from (v1,v2)
-        // 6) the curve enters from (v1,v2) and exits from (v2,v0)
-        // 7) the does not pass fromm here
-
-        bool through_v0    = (iso_value == f0);
-        bool through_v1    = (iso_value == f1);
-        bool through_v2    = (iso_value == f2);
-        bool crosses_v0_v1 = is_into_interval<double>(iso_value, f0, f1, true);
-        bool crosses_v1_v2 = is_into_interval<double>(iso_value, f1, f2, true);
-        bool crosses_v2_v0 = is_into_interval<double>(iso_value, f2, f0, true);
-
-        if (through_v0 && through_v1) // case 1) the curve coincides with (v0,v1)
+        uint vids[] =
         {
-            segs.push_back(m.vert(vid0));
-            segs.push_back(m.vert(vid1));
-        }
-        else if (through_v1 && through_v2) // case 2) the curve coincides with (v1,v2)
-        {
-            segs.push_back(m.vert(vid1));
-            segs.push_back(m.vert(vid2));
-        }
-        else if (through_v2 && through_v0) // 3) the curve coincides with (v2,v0)
+            m.poly_tessellation(pid).at(3*i+0),
+            m.poly_tessellation(pid).at(3*i+1),
+            m.poly_tessellation(pid).at(3*i+2)
+        };
+        vec3d  p[] = { m.vert(vids[0]), m.vert(vids[1]), m.vert(vids[2]) };
+        double f[] =
         {
-            segs.push_back(m.vert(vid2));
-            segs.push_back(m.vert(vid0));
-        }
-        else if (crosses_v0_v1 && crosses_v1_v2) // case 4) the curve enters from (v0,v1) and exits from (v0,v2)
-        {
-            double alpha0 = std::fabs(iso_value - f0)/fabs(f1 - f0);
-            double alpha1 = std::fabs(iso_value - f1)/fabs(f2 - f1);
-            segs.push_back((1.0-alpha0)*m.vert(vid0) + alpha0*m.vert(vid1));
-            segs.push_back((1.0-alpha1)*m.vert(vid1) + alpha1*m.vert(vid2));
-        }
-        else if (crosses_v0_v1 && crosses_v2_v0) // case 5) the curve enters from (v0,v1) and exits from (v1,v2)
+            m.vert_uvw(vids[0])[0],
+            m.vert_uvw(vids[1])[0],
+            m.vert_uvw(vids[2])[0]
+        };
+        return isocontour_segment(iso_value, p, f, seg);
+    };
+
+    // count the segments of each polygon, then fill them in at the
+    // offsets given by the prefix sum of the counts
+    std::vector<uint> offset(m.num_polys()+1, 0);
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        vec3d seg[2];
+        for(uint i=0; i<m.poly_tessellation(pid).size()/3; ++i)
         {
-            double alpha0 = std::fabs(iso_value - f0)/fabs(f1 - f0);
-            double alpha1 = std::fabs(iso_value - f2)/fabs(f0 - f2);
-            segs.push_back((1.0-alpha0)*m.vert(vid0) + alpha0*m.vert(vid1));
-            segs.push_back((1.0-alpha1)*m.vert(vid2) + alpha1*m.vert(vid0));
+            if(tri_segment(pid, i, seg)) ++offset[pid+1];
         }
-        else if (crosses_v1_v2 && crosses_v2_v0) // 6) the curve enters from (v1,v2) and exits from (v2,v0)
+    });
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    segs.resize(2*offset.back());
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        if(offset[pid]==offset[pid+1]) return;
+        uint off = 2*offset[pid];
+        for(uint i=0; i<m.poly_tessellation(pid).size()/3; ++i)
         {
-            double alpha0 = std::fabs(iso_value - f1)/fabs(f2 - f1);
-            double alpha1 = std::fabs(iso_value - f2)/fabs(f0 - f2);
-            segs.push_back((1.0-alpha0)*m.vert(vid1) + alpha0*m.vert(vid2));
-            segs.push_back((1.0-alpha1)*m.vert(vid2) + alpha1*m.vert(vid0));
+            if(tri_segment(pid, i, &segs[off])) off += 2;
         }
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool isocontour_segment(const double iso_value,
+                        const vec3d  p[],
+                        const double f[],
+                              vec3d  seg[])
+{
+    // There are seven possible cases:
+    // 1) the curve coincides with (v0,v1)
+    // 2) the curve coincides with (v1,v2)
+    // 3) the curve coincides with (v2,v0)
+    // 4) the curve enters from (v0,v1) and exits from (v0,v2)
+    // 5) the curve enters from (v0,v1) and exits from (v1,v2)
+    // 6) the curve enters from (v1,v2) and exits from (v2,v0)
+    // 7) the does not pass fromm here
+
+    bool through_v0    = (iso_value == f[0]);
+    bool through_v1    = (iso_value == f[1]);
+    bool through_v2    = (iso_value == f[2]);
+    bool crosses_v0_v1 = is_into_interval<double>(iso_value, f[0], f[1], true);
+    bool crosses_v1_v2 = is_into_interval<double>(iso_value, f[1], f[2], true);
+    bool crosses_v2_v0 = is_into_interval<double>(iso_value, f[2], f[0], true);
+
+    if (through_v0 && through_v1) // case 1) the curve coincides with (v0,v1)
+    {
+        seg[0] = p[0];
+        seg[1] = p[1];
+    }
+    else if (through_v1 && through_v2) // case 2) the curve coincides with (v1,v2)
+    {
+        seg[0] = p[1];
+        seg[1] = p[2];
     }
+    else if (through_v2 && through_v0) // 3) the curve coincides with (v2,v0)
+    {
+        seg[0] = p[2];
+        seg[1] = p[0];
+    }
+    else if (crosses_v0_v1 && crosses_v1_v2) // case 4) the curve enters from (v0,v1) and exits from (v0,v2)
+    {
+        double alpha0 = std::fabs(iso_value - f[0])/fabs(f[1] - f[0]);
+        double alpha1 = std::fabs(iso_value - f[1])/fabs(f[2] - f[1]);
+        seg[0] = (1.0-alpha0)*p[0] + alpha0*p[1];
+        seg[1] = (1.0-alpha1)*p[1] + alpha1*p[2];
+    }
+    else if (crosses_v0_v1 && crosses_v2_v0) // case 5) the curve enters from (v0,v1) and exits from (v1,v2)
+    {
+        double alpha0 = std::fabs(iso_value - f[0])/fabs(f[1] - f[0]);
+        double alpha1 = std::fabs(iso_value - f[2])/fabs(f[0] - f[2]);
+        seg[0] = (1.0-alpha0)*p[0] + alpha0*p[1];
+        seg[1] = (1.0-alpha1)*p[2] + alpha1*p[0];
+    }
+    else if (crosses_v1_v2 && crosses_v2_v0) // 6) the curve enters from (v1,v2) and exits from (v2,v0)
+    {
+        double alpha0 = std::fabs(iso_value - f[1])/fabs(f[2] - f[1]);
+        double alpha1 = std::fabs(iso_value - f[2])/fabs(f[0] - f[2]);
+        seg[0] = (1.0-alpha0)*p[1] + alpha0*p[2];
+        seg[1] = (1.0-alpha1)*p[2] + alpha1*p[0];
+    }
+    else return false;
+
+    return true;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -133,8 +177,8 @@ std::vector<uint> Isocontour<M,V,E,P>::tessellate(Trimesh<M,V,E,P> & m) const
 
     for(uint eid=0; eid<m.num_edges(); ++eid)
     {
-        double f0 = m.vert_data(m.edge_vert_id(eid,0)).uvw[0];
-        double f1 = m.vert_data(m.edge_vert_id(eid,1)).uvw[0];
+        double f0 = m.vert_uvw(m.edge_vert_id(eid,0))[0];
+        double f1 = m.vert_uvw(m.edge_vert_id(eid,1))[0];
 
         if (is_into_interval<double>(iso_value, f0, f1))
         {
@@ -147,7 +191,7 @@ std::vector<uint> Isocontour<M,V,E,P>::tessellate(Trimesh<M,V,E,P> & m) const
     for(auto e : edges_to_split)
     {
         uint vid = m.edge_split(e.first, e.second);
-        m.vert_data(vid).uvw[0] = iso_value;
+        m.vert_uvw(vid)[0] = iso_value;
         new_vids.push_back(vid);
     }
 
@@ -66,6 +66,17 @@ class Isocontour
         std::vector<vec3d> segs;
 };
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// portion of iso-curve inside a triangle with corners p[] and field values f[].
+// Returns false if the curve does not pass from here
+//
+CINO_INLINE
+bool isocontour_segment(const double iso_value,
+                        const vec3d  p[],
+                        const double f[],
+                              vec3d  seg[]);
+
 }
 
 #ifndef  CINO_STATIC_LIB
@@ -35,6 +35,8 @@
 *********************************************************************************/
 #include <cinolib/linear_solvers.h>
 #include <cinolib/stl_container_utilities.h>
+#include <cinolib/multigrid.h>
+#include <iostream>
 
 namespace cinolib
 {
@@ -80,6 +82,20 @@ void solve_square_system(const Eigen::SparseMatrix<double> & A,
             break;
         }
 
+        case MULTIGRID_PCG:
+        {
+            MultigridPCG solver(A);
+            x = Eigen::VectorXd::Zero(b.size()); // x may be uninitialized (no warm start)
+            solver.solve(b, x);
+            if(solver.info()!=Eigen::Success)
+            {
+                std::cerr << "WARNING: multigrid PCG failed (relative residual " << solver.error() << " after "
+                          << solver.iterations() << " iterations). Falling back to SIMPLICIAL_LDLT" << std::endl;
+                solve_square_system(A, b, x, SIMPLICIAL_LDLT);
+            }
+            break;
+        }
+
         case SparseLU:
         {
             Eigen::SparseMatrix<double> Ac = A;
@@ -56,6 +56,20 @@ namespace cinolib
  * --------------------------------------------------------------
  * BiCGSTAB     none
  * (iterative)
+ * --------------------------------------------------------------
+ * MULTIGRID    positive semi definite      +           +
+ * _PCG         negative semi definite
+ * (iterative)  (Laplacian-like, see multigrid.h. Falls back to LDLT if
+ *              it does not converge)
+ *
+ * NOTE: MULTIGRID_PCG only pays off on volume meshes, where the fill-in of
+ * direct factorizations explodes. On surface meshes LLT is faster and uses
+ * less memory even at millions of vertices (on a 1.3M vertices icosphere,
+ * MULTIGRID_PCG is ~8x slower and takes ~25% more memory than LLT).
+ *
+ * NOTE: the functions below set up the solver at each call. With MULTIGRID_PCG
+ * this means rebuilding the whole multigrid hierarchy. To solve the same system
+ * for many right hand sides, use the MultigridPCG class (multigrid.h) directly.
  */
 
 enum
@@ -64,16 +78,18 @@ enum
     SIMPLICIAL_LDLT,
     SparseLU,
     BiCGSTAB,
+    MULTIGRID_PCG,
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-static const std::string txt[4] =
+static const std::string txt[5] =
 {
     "SIMPLICIAL_LLT"  ,
     "SIMPLICIAL_LDLT" ,
     "SparseLU",
     "BiCGSTAB",
+    "MULTIGRID_PCG",
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -43,7 +43,10 @@
 *     Italy                                                                     *
 *********************************************************************************/
 #include <cinolib/marching_tets.h>
+#include <cinolib/parallel_for.h>
 #include <array>
+#include <cstdint>
+#include <numeric>
 
 namespace cinolib
 {
@@ -72,250 +75,313 @@ enum // Look-up Table
 
 template<class M, class V, class E, class F, class P>
 CINO_INLINE
-void make_triangle(const Tetmesh<M,V,E,F,P> & m,
+void marching_tets(const Tetmesh<M,V,E,F,P> & m,
                    const double               isovalue,
-                   const uint                 vids[],
-                   const double               func[],
-                   const std::array<uint,3> & e,
-                   std::map<ipair,uint>     & e2v_map,
                    std::vector<vec3d>       & verts,
                    std::vector<uint>        & tris,
-                   std::vector<vec3d>       & norms);
+                   std::vector<vec3d>       & norms)
+{
+    std::vector<double> field(m.num_verts());
+    PARALLEL_FOR(0, m.num_verts(), 10000, [&](uint vid)
+    {
+        field[vid] = m.vert_uvw(vid)[0];
+    });
+    marching_tets(m, field, isovalue, verts, tris, norms);
+}
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 template<class M, class V, class E, class F, class P>
 CINO_INLINE
-void marching_tets(const Tetmesh<M,V,E,F,P> & m,
-                   const double               isovalue,
-                   std::vector<vec3d>       & verts,
-                   std::vector<uint>        & tris,
-                   std::vector<vec3d>       & norms)
+void marching_tets(const Tetmesh<M,V,E,F,P>        & m,
+                   const std::vector<double>       & isovalues,
+                   std::vector<std::vector<vec3d>> & verts,
+                   std::vector<std::vector<uint>>  & tris,
+                   std::vector<std::vector<vec3d>> & norms)
 {
-    /* FIXME: for all configurations where two verts >= isoval
-     * and the other two are < isoval, this method will try to
-     * make a quad (2 triangles).
-     * Indeed, if one vertx has exactly isoval, the surface cuts
-     * a triangle and not a quad inside the tet, and therefore
-     * one of the two triangles will be degenerate.
-     * To avoid confusion and excessive code specialization for corner
-     * cases, maybe it is better to have three possible states for a
-     * vertex (<,>,=). In this case each configuration will be 100% correct
-    */
-
-    std::vector<unsigned char> c(m.num_polys(),0x0);
-    std::vector<bool> swapped(m.num_polys(), false);
-
-    for(uint pid=0; pid<m.num_polys(); ++pid)
+    std::vector<double> field(m.num_verts());
+    PARALLEL_FOR(0, m.num_verts(), 10000, [&](uint vid)
     {
-        double func[] =
-        {
-            m.vert_data(m.poly_vert_id(pid,0)).uvw[0],
-            m.vert_data(m.poly_vert_id(pid,1)).uvw[0],
-            m.vert_data(m.poly_vert_id(pid,2)).uvw[0],
-            m.vert_data(m.poly_vert_id(pid,3)).uvw[0]
-        };
+        field[vid] = m.vert_uvw(vid)[0];
+    });
 
-        if (isovalue >= func[0]) c.at(pid) |= C_1000;
-        if (isovalue >= func[1]) c.at(pid) |= C_0100;
-        if (isovalue >= func[2]) c.at(pid) |= C_0010;
-        if (isovalue >= func[3]) c.at(pid) |= C_0001;
-
-        /* If the isosurface does not intersect the tet,
-         * one should get C_1111 using ">=", and C_0000
-         * inverting to "<=".
-         *
-         * This does not happen if the isosurface passes
-         * exhactly through one face. In this case one will
-         * get C_1111 using ">=", and something like
-         * C_0111 using "<=".
-         *
-         * Normally this does not create any trouble, as the
-         * face-adjacent tet will trigger the generation of
-         * that triangle. But if the tet is exposed on the
-         * surface, then that triangle will be missing in the
-         * final iso-surface.
-         *
-         * To avoid these missing triangles, whenever I get
-         * a C_1111 I invert the sign, and assign to the tet
-         * the configuration produced using "<="
-        */
-        if (c.at(pid) == C_1111)
-        {
-            swapped.at(pid) = true;
-            c.at(pid) = 0x0;
-            if (isovalue <= func[0]) c.at(pid) |= C_1000;
-            if (isovalue <= func[1]) c.at(pid) |= C_0100;
-            if (isovalue <= func[2]) c.at(pid) |= C_0010;
-            if (isovalue <= func[3]) c.at(pid) |= C_0001;
-        }
+    verts.resize(isovalues.size());
+    tris.resize(isovalues.size());
+    norms.resize(isovalues.size());
+    for(uint i=0; i<isovalues.size(); ++i)
+    {
+        marching_tets(m, field, isovalues.at(i), verts.at(i), tris.at(i), norms.at(i));
     }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-    std::map<ipair,uint> e2v_map;
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void marching_tets(const Tetmesh<M,V,E,F,P>  & m,
+                   const std::vector<double> & field,
+                   const double                isovalue,
+                   std::vector<vec3d>        & verts,
+                   std::vector<uint>         & tris,
+                   std::vector<vec3d>        & norms)
+{
+    assert(field.size()==m.num_verts());
 
-    for(uint pid=0; pid<m.num_polys(); ++pid)
+    // classify all tets (one bit per vertex)
+    std::vector<unsigned char> c(m.num_polys());
+    std::vector<unsigned char> swapped(m.num_polys()); // not vector<bool>, which is unsafe to write concurrently
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
     {
-        uint vids[] =
+        double func[] =
         {
-            m.poly_vert_id(pid,0),
-            m.poly_vert_id(pid,1),
-            m.poly_vert_id(pid,2),
-            m.poly_vert_id(pid,3)
+            field[m.poly_vert_id(pid,0)],
+            field[m.poly_vert_id(pid,1)],
+            field[m.poly_vert_id(pid,2)],
+            field[m.poly_vert_id(pid,3)]
         };
+        bool s;
+        c[pid]       = marching_tets_config(isovalue, func, s);
+        swapped[pid] = s;
+    });
+
+    // filter degenerate configurations and count the triangles generated by each tet.
+    // Filtered configurations go to a separate buffer, so that tets always read the
+    // unfiltered configuration of their neighbors
+    std::vector<unsigned char> conf(m.num_polys(), C_0000);
+    std::vector<uint> offset(m.num_polys()+1, 0);
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        if(c[pid]==C_0000) return;
 
         double func[] =
         {
-            m.vert_data(vids[0]).uvw[0],
-            m.vert_data(vids[1]).uvw[0],
-            m.vert_data(vids[2]).uvw[0],
-            m.vert_data(vids[3]).uvw[0]
+            field[m.poly_vert_id(pid,0)],
+            field[m.poly_vert_id(pid,1)],
+            field[m.poly_vert_id(pid,2)],
+            field[m.poly_vert_id(pid,3)]
         };
 
-        bool v_on_iso[] =
+        // if the iso-surface passes on a face, only one tet (MUST BE the one with higher id) triggers triangle generation...
+        // Notice that if the adjacent tet is collapsed (C_1111), then it make sense to use the current one regardless the tid order
+        bool defer[4];
+        for(uint i=0; i<4; ++i)
         {
-            func[0] == isovalue,
-            func[1] == isovalue,
-            func[2] == isovalue,
-            func[3] == isovalue
-        };
+            int adj = m.poly_adj_through_face(pid, m.poly_face_id(pid,i)); // may be -1 if there is no adjacent tet!
+            defer[i] = ((int)pid < adj && c[adj] != C_1111);
+        }
+        conf[pid] = marching_tets_filter(c[pid], isovalue, func, defer);
 
-        int adj_tet[] // not uint because it may be -1 if there is no adjacent tet!
-        {
-            m.poly_adj_through_face(pid, m.poly_face_id(pid,0)),
-            m.poly_adj_through_face(pid, m.poly_face_id(pid,1)),
-            m.poly_adj_through_face(pid, m.poly_face_id(pid,2)),
-            m.poly_adj_through_face(pid, m.poly_face_id(pid,3)),
-        };
+        std::array<uint,3> e[2];
+        offset[pid+1] = marching_tets_triangles(conf[pid], swapped[pid], e);
+    });
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    // triangles, expressed as triplets of mesh edges
+    uint n_tris = offset.back();
+    std::vector<uint> tri_edges(3*n_tris);
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        if(offset[pid]==offset[pid+1]) return;
 
-        // Avoid triangle duplication and collapsed triangle generation when the iso-surface
-        // passes EXACTLY through a vertex/edge/face shared between many tetrahedra.
-        //
-        switch (c.at(pid))
+        std::array<uint,3> e[2];
+        uint n = marching_tets_triangles(conf[pid], swapped[pid], e);
+        for(uint i=0; i<n; ++i)
+        for(uint j=0; j<3; ++j)
         {
-            // iso-surface passes on a face : make sure only one tet (MUST BE the one with higher id) triggers triangle generation...
-            // Notice that if the adjacent tet is collapsed (C_1111), then it make sense to use the current one regardless the tid order
-            case C_1110 : if (v_on_iso[0] && v_on_iso[1] && v_on_iso[2] && (int)pid < adj_tet[0] && c.at(adj_tet[0]) != C_1111) c.at(pid) = C_0000; break;
-            case C_1101 : if (v_on_iso[0] && v_on_iso[1] && v_on_iso[3] && (int)pid < adj_tet[1] && c.at(adj_tet[1]) != C_1111) c.at(pid) = C_0000; break;
-            case C_1011 : if (v_on_iso[0] && v_on_iso[2] && v_on_iso[3] && (int)pid < adj_tet[2] && c.at(adj_tet[2]) != C_1111) c.at(pid) = C_0000; break;
-            case C_0111 : if (v_on_iso[1] && v_on_iso[2] && v_on_iso[3] && (int)pid < adj_tet[3] && c.at(adj_tet[3]) != C_1111) c.at(pid) = C_0000; break;
-
-            // iso-surface passes on a edge : do nothing
-            case C_0101 : if (v_on_iso[1] && v_on_iso[3]) c.at(pid) = C_0000; break;
-            case C_1010 : if (v_on_iso[0] && v_on_iso[2]) c.at(pid) = C_0000; break;
-            case C_0011 : if (v_on_iso[2] && v_on_iso[3]) c.at(pid) = C_0000; break;
-            case C_1100 : if (v_on_iso[0] && v_on_iso[1]) c.at(pid) = C_0000; break;
-            case C_1001 : if (v_on_iso[0] && v_on_iso[3]) c.at(pid) = C_0000; break;
-            case C_0110 : if (v_on_iso[1] && v_on_iso[2]) c.at(pid) = C_0000; break;
-
-            // iso-surface passes on a vertex : do nothing
-            case C_1000 : if (v_on_iso[0]) c.at(pid) = C_0000; break;
-            case C_0100 : if (v_on_iso[1]) c.at(pid) = C_0000; break;
-            case C_0010 : if (v_on_iso[2]) c.at(pid) = C_0000; break;
-            case C_0001 : if (v_on_iso[3]) c.at(pid) = C_0000; break;
-
-            default : break;
+            uint v_a = m.poly_vert_id(pid, TET_EDGES[e[i][j]][0]);
+            uint v_b = m.poly_vert_id(pid, TET_EDGES[e[i][j]][1]);
+            tri_edges[3*(offset[pid]+i)+j] = m.poly_edge_id(pid, v_a, v_b);
         }
+    });
+
+    // one iso-vertex for each mesh edge referenced by some triangle. Referenced
+    // edges are flagged, and numbered with an exclusive scan of the flags, done
+    // in blocks of edges: per block counts (in parallel), prefix sum of the
+    // counts, and numbering within each block (in parallel)
+    const uint blk_size = 4096;
+    uint n_edges = m.num_edges();
+    uint n_blks  = (n_edges + blk_size - 1) / blk_size;
+    std::vector<uint8_t> flag(n_edges, 0);
+    for(uint eid : tri_edges) flag[eid] = 1;
+    std::vector<uint> blk_offset(n_blks+1, 0);
+    PARALLEL_FOR(0, n_blks, 8, [&](uint b)
+    {
+        uint end = std::min(n_edges, (b+1)*blk_size);
+        for(uint eid=b*blk_size; eid<end; ++eid) blk_offset[b+1] += flag[eid];
+    });
+    std::partial_sum(blk_offset.begin(), blk_offset.end(), blk_offset.begin());
+
+    uint base_v = uint(verts.size());
+    std::vector<uint> e2v(n_edges);
+    std::vector<uint> v2e(blk_offset.back());
+    PARALLEL_FOR(0, n_blks, 8, [&](uint b)
+    {
+        uint end = std::min(n_edges, (b+1)*blk_size);
+        uint vid = blk_offset[b];
+        for(uint eid=b*blk_size; eid<end; ++eid)
+        {
+            if(!flag[eid]) continue;
+            e2v[eid]   = base_v + vid;
+            v2e[vid++] = eid;
+        }
+    });
 
-        // triangle generation
-        switch (c.at(pid))
+    verts.resize(base_v + v2e.size());
+    PARALLEL_FOR(0, v2e.size(), 1000, [&](uint i)
+    {
+        uint   v_a = m.edge_vert_id(v2e[i],0);
+        uint   v_b = m.edge_vert_id(v2e[i],1);
+        double f_a = field[v_a];
+        double f_b = field[v_b];
+        if (f_a < f_b)
         {
-            case C_1000 : { make_triangle(m, isovalue, vids, func, {2,0,4}, e2v_map, verts, tris, norms); break; }
-            case C_0111 : { swapped.at(pid)?
-                            make_triangle(m, isovalue, vids, func, {2,0,4}, e2v_map, verts, tris, norms) :
-                            make_triangle(m, isovalue, vids, func, {0,2,4}, e2v_map, verts, tris, norms); break; }
-            case C_1011 : { swapped.at(pid)?
-                            make_triangle(m, isovalue, vids, func, {1,2,3}, e2v_map, verts, tris, norms) :
-                            make_triangle(m, isovalue, vids, func, {2,1,3}, e2v_map, verts, tris, norms); break; }
-            case C_0100 : { make_triangle(m, isovalue, vids, func, {1,2,3}, e2v_map, verts, tris, norms); break; }
-            case C_1101 : { swapped.at(pid)?
-                            make_triangle(m, isovalue, vids, func, {0,1,5}, e2v_map, verts, tris, norms) :
-                            make_triangle(m, isovalue, vids, func, {1,0,5}, e2v_map, verts, tris, norms); break; }
-            case C_0010 : { make_triangle(m, isovalue, vids, func, {0,1,5}, e2v_map, verts, tris, norms); break; }
-            case C_0001 : { make_triangle(m, isovalue, vids, func, {5,3,4}, e2v_map, verts, tris, norms); break; }
-            case C_1110 : { swapped.at(pid)?
-                            make_triangle(m, isovalue, vids, func, {5,3,4}, e2v_map, verts, tris, norms) :
-                            make_triangle(m, isovalue, vids, func, {3,5,4}, e2v_map, verts, tris, norms); break; }
-            case C_0101 : { make_triangle(m, isovalue, vids, func, {5,2,4}, e2v_map, verts, tris, norms);
-                            make_triangle(m, isovalue, vids, func, {2,5,1}, e2v_map, verts, tris, norms); break; }
-            case C_1010 : { make_triangle(m, isovalue, vids, func, {2,5,4}, e2v_map, verts, tris, norms);
-                            make_triangle(m, isovalue, vids, func, {5,2,1}, e2v_map, verts, tris, norms); break; }
-            case C_0011 : { make_triangle(m, isovalue, vids, func, {3,4,1}, e2v_map, verts, tris, norms);
-                            make_triangle(m, isovalue, vids, func, {1,4,0}, e2v_map, verts, tris, norms); break; }
-            case C_1100 : { make_triangle(m, isovalue, vids, func, {4,3,1}, e2v_map, verts, tris, norms);
-                            make_triangle(m, isovalue, vids, func, {4,1,0}, e2v_map, verts, tris, norms); break; }
-            case C_1001 : { make_triangle(m, isovalue, vids, func, {3,2,0}, e2v_map, verts, tris, norms);
-                            make_triangle(m, isovalue, vids, func, {5,3,0}, e2v_map, verts, tris, norms); break; }
-            case C_0110 : { make_triangle(m, isovalue, vids, func, {2,3,0}, e2v_map, verts, tris, norms);
-                            make_triangle(m, isovalue, vids, func, {3,5,0}, e2v_map, verts, tris, norms); break; }
-            default : break;
+            std::swap(v_a, v_b);
+            std::swap(f_a, f_b);
         }
-    }
+        double alpha = (isovalue - f_a) / (f_b - f_a);
+        verts[base_v+i] = (1.0 - alpha) * m.vert(v_a) + alpha * m.vert(v_b);
+    });
+
+    uint base_t = uint(tris.size());
+    uint base_n = uint(norms.size());
+    tris.resize(base_t + 3*n_tris);
+    norms.resize(base_n + n_tris);
+    PARALLEL_FOR(0, n_tris, 1000, [&](uint tid)
+    {
+        for(uint i=0; i<3; ++i) tris[base_t+3*tid+i] = e2v[tri_edges[3*tid+i]];
+
+        vec3d u = verts[tris[base_t+3*tid+1]] - verts[tris[base_t+3*tid]]; u.normalize();
+        vec3d w = verts[tris[base_t+3*tid+2]] - verts[tris[base_t+3*tid]]; w.normalize();
+        vec3d n = u.cross(w);
+        n.normalize();
+        norms[base_n+tid] = n;
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-template<class M, class V, class E, class F, class P>
 CINO_INLINE
-void make_triangle(const Tetmesh<M,V,E,F,P> & m,
-                   const double               isovalue,
-                   const uint                 vids[],
-                   const double               func[],
-                   const std::array<uint,3> & e,
-                   std::map<ipair,uint>     & e2v_map,
-                   std::vector<vec3d>       & verts,
-                   std::vector<uint>        & tris,
-                   std::vector<vec3d>       & norms)
+unsigned char marching_tets_config(const double isovalue, const double func[], bool & swapped)
 {
-    assert(isovalue >= *std::min_element(func, func+4));
-    assert(isovalue <= *std::max_element(func, func+4));
-
-    vec3d tri_verts[3];
-    uint  fresh_vid = uint(verts.size());
+    /* FIXME: for all configurations where two verts >= isoval
+     * and the other two are < isoval, this method will try to
+     * make a quad (2 triangles).
+     * Indeed, if one vertx has exactly isoval, the surface cuts
+     * a triangle and not a quad inside the tet, and therefore
+     * one of the two triangles will be degenerate.
+     * To avoid confusion and excessive code specialization for corner
+     * cases, maybe it is better to have three possible states for a
+     * vertex (<,>,=). In this case each configuration will be 100% correct
+    */
 
-    for(uint i=0; i<3; ++i)
+    unsigned char c = 0x0;
+    swapped = false;
+
+    if (isovalue >= func[0]) c |= C_1000;
+    if (isovalue >= func[1]) c |= C_0100;
+    if (isovalue >= func[2]) c |= C_0010;
+    if (isovalue >= func[3]) c |= C_0001;
+
+    /* If the isosurface does not intersect the tet,
+     * one should get C_1111 using ">=", and C_0000
+     * inverting to "<=".
+     *
+     * This does not happen if the isosurface passes
+     * exhactly through one face. In this case one will
+     * get C_1111 using ">=", and something like
+     * C_0111 using "<=".
+     *
+     * Normally this does not create any trouble, as the
+     * face-adjacent tet will trigger the generation of
+     * that triangle. But if the tet is exposed on the
+     * surface, then that triangle will be missing in the
+     * final iso-surface.
+     *
+     * To avoid these missing triangles, whenever I get
+     * a C_1111 I invert the sign, and assign to the tet
+     * the configuration produced using "<="
+    */
+    if (c == C_1111)
     {
-        uint v_a = vids[TET_EDGES[e[i]][0]];
-        uint v_b = vids[TET_EDGES[e[i]][1]];
-
-        // avoid duplicated vertices. If an edge has already
-        // been visited retrieve its id and coordinates
-        //
-        ipair pair  = unique_pair(v_a, v_b);
-        auto  query = e2v_map.find(pair);
-
-        if (query != e2v_map.end())
-        {
-            uint vid = query->second;
-            tri_verts[i] = vec3d(verts.at(vid));
-            tris.push_back(vid);
-        }
-        else
-        {
-            double f_a = func[TET_EDGES[e[i]][0]];
-            double f_b = func[TET_EDGES[e[i]][1]];
-
-            if (f_a < f_b)
-            {
-                std::swap(v_a, v_b);
-                std::swap(f_a, f_b);
-            }
+        swapped = true;
+        c = 0x0;
+        if (isovalue <= func[0]) c |= C_1000;
+        if (isovalue <= func[1]) c |= C_0100;
+        if (isovalue <= func[2]) c |= C_0010;
+        if (isovalue <= func[3]) c |= C_0001;
+    }
+    return c;
+}
 
-            double alpha = (isovalue - f_a) / (f_b - f_a);
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-            tri_verts[i] = (1.0 - alpha) * m.vert(v_a) + alpha * m.vert(v_b);
+CINO_INLINE
+unsigned char marching_tets_filter(const unsigned char c,
+                                   const double        isovalue,
+                                   const double        func[],
+                                   const bool          defer[])
+{
+    bool v_on_iso[] =
+    {
+        func[0] == isovalue,
+        func[1] == isovalue,
+        func[2] == isovalue,
+        func[3] == isovalue
+    };
+
+    // Avoid triangle duplication and collapsed triangle generation when the iso-surface
+    // passes EXACTLY through a vertex/edge/face shared between many tetrahedra.
+    //
+    switch (c)
+    {
+        // iso-surface passes on a face : generate the triangle only if the adjacent tet will not
+        case C_1110 : if (v_on_iso[0] && v_on_iso[1] && v_on_iso[2] && defer[0]) return C_0000; break;
+        case C_1101 : if (v_on_iso[0] && v_on_iso[1] && v_on_iso[3] && defer[1]) return C_0000; break;
+        case C_1011 : if (v_on_iso[0] && v_on_iso[2] && v_on_iso[3] && defer[2]) return C_0000; break;
+        case C_0111 : if (v_on_iso[1] && v_on_iso[2] && v_on_iso[3] && defer[3]) return C_0000; break;
+
+        // iso-surface passes on a edge : do nothing
+        case C_0101 : if (v_on_iso[1] && v_on_iso[3]) return C_0000; break;
+        case C_1010 : if (v_on_iso[0] && v_on_iso[2]) return C_0000; break;
+        case C_0011 : if (v_on_iso[2] && v_on_iso[3]) return C_0000; break;
+        case C_1100 : if (v_on_iso[0] && v_on_iso[1]) return C_0000; break;
+        case C_1001 : if (v_on_iso[0] && v_on_iso[3]) return C_0000; break;
+        case C_0110 : if (v_on_iso[1] && v_on_iso[2]) return C_0000; break;
+
+        // iso-surface passes on a vertex : do nothing
+        case C_1000 : if (v_on_iso[0]) return C_0000; break;
+        case C_0100 : if (v_on_iso[1]) return C_0000; break;
+        case C_0010 : if (v_on_iso[2]) return C_0000; break;
+        case C_0001 : if (v_on_iso[3]) return C_0000; break;
+
+        default : break;
+    }
+    return c;
+}
 
-            verts.push_back(tri_verts[i]);
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-            tris.push_back(fresh_vid);
-            e2v_map[pair] = fresh_vid++;
-        }
+CINO_INLINE
+uint marching_tets_triangles(const unsigned char c, const bool swapped, std::array<uint,3> tris[])
+{
+    switch (c)
+    {
+        case C_1000 : { tris[0] = {2,0,4}; return 1; }
+        case C_0111 : { tris[0] = swapped ? std::array<uint,3>{2,0,4} : std::array<uint,3>{0,2,4}; return 1; }
+        case C_1011 : { tris[0] = swapped ? std::array<uint,3>{1,2,3} : std::array<uint,3>{2,1,3}; return 1; }
+        case C_0100 : { tris[0] = {1,2,3}; return 1; }
+        case C_1101 : { tris[0] = swapped ? std::array<uint,3>{0,1,5} : std::array<uint,3>{1,0,5}; return 1; }
+        case C_0010 : { tris[0] = {0,1,5}; return 1; }
+        case C_0001 : { tris[0] = {5,3,4}; return 1; }
+        case C_1110 : { tris[0] = swapped ? std::array<uint,3>{5,3,4} : std::array<uint,3>{3,5,4}; return 1; }
+        case C_0101 : { tris[0] = {5,2,4}; tris[1] = {2,5,1}; return 2; }
+        case C_1010 : { tris[0] = {2,5,4}; tris[1] = {5,2,1}; return 2; }
+        case C_0011 : { tris[0] = {3,4,1}; tris[1] = {1,4,0}; return 2; }
+        case C_1100 : { tris[0] = {4,3,1}; tris[1] = {4,1,0}; return 2; }
+        case C_1001 : { tris[0] = {3,2,0}; tris[1] = {5,3,0}; return 2; }
+        case C_0110 : { tris[0] = {2,3,0}; tris[1] = {3,5,0}; return 2; }
+        default : return 0;
     }
-
-    vec3d u  = tri_verts[1] - tri_verts[0]; u.normalize();
-    vec3d w  = tri_verts[2] - tri_verts[0]; w.normalize();
-    vec3d n = u.cross(w);
-    n.normalize();
-    norms.push_back(n);
 }
 
 }
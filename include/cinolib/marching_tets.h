@@ -36,11 +36,10 @@
 #ifndef CINO_MARCHING_TETS_H
 #define CINO_MARCHING_TETS_H
 
+#include <array>
 #include <vector>
-#include <map>
 #include <sys/types.h>
 #include <cinolib/cino_inline.h>
-#include <cinolib/ipair.h>
 #include <cinolib/meshes/tetmesh.h>
 
 namespace cinolib
@@ -53,6 +52,62 @@ void marching_tets(const Tetmesh<M,V,E,F,P> & m,
                    std::vector<vec3d>       & verts,
                    std::vector<uint>        & tris,
                    std::vector<vec3d>       & norms);
+
+// extraction engine, with the scalar field given per vertex. Tets are classified
+// in parallel, output triangles are allocated with a prefix sum over the per tet
+// counts, and each iso-vertex is computed once for the mesh edge hosting it
+// (vertices are therefore sorted by edge id). Results are appended to the output
+//
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void marching_tets(const Tetmesh<M,V,E,F,P>  & m,
+                   const std::vector<double> & field,
+                   const double                isovalue,
+                   std::vector<vec3d>        & verts,
+                   std::vector<uint>         & tris,
+                   std::vector<vec3d>        & norms);
+
+// multiple iso-surfaces of the same field (e.g. for visualization or slicing).
+// The field is gathered once, then each isovalue costs a single parallel sweep
+//
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void marching_tets(const Tetmesh<M,V,E,F,P>        & m,
+                   const std::vector<double>       & isovalues,
+                   std::vector<std::vector<vec3d>> & verts,
+                   std::vector<std::vector<uint>>  & tris,
+                   std::vector<std::vector<vec3d>> & norms);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// per tet building blocks of marching_tets, also used by its out-of-core
+// counterpart (see streaming/stream_operators.h)
+
+// configuration of a tet w.r.t. the isovalue (one bit per vertex)
+//
+CINO_INLINE
+unsigned char marching_tets_config(const double   isovalue,
+                                   const double   func[],     // field at the four tet vertices
+                                   bool         & swapped);
+
+// removes duplicated and collapsed triangles when the iso-surface passes exactly
+// through vertices, edges or faces of the tet. defer[i] is true if the triangle
+// lying on the i-th face (see TET_FACES) will be generated by the adjacent tet
+//
+CINO_INLINE
+unsigned char marching_tets_filter(const unsigned char c,
+                                   const double        isovalue,
+                                   const double        func[],
+                                   const bool          defer[]);
+
+// triangles generated by a configuration, as triplets of tet edges (see
+// TET_EDGES) hosting their vertices. Returns the number of triangles (0..2)
+//
+CINO_INLINE
+uint marching_tets_triangles(const unsigned char   c,
+                             const bool            swapped,
+                             std::array<uint,3>    tris[]);
+
 }
 
 #ifndef  CINO_STATIC_LIB
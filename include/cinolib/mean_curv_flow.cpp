@@ -38,6 +38,7 @@
 #include <cinolib/linear_solvers.h>
 #include <cinolib/vertex_mass.h>
 #include <cinolib/symbols.h>
+#include <numeric>
 
 namespace cinolib
 {
@@ -49,61 +50,158 @@ void MCF(AbstractPolygonMesh<M,V,E,P> & m,
          const double                   time_scalar,
          const bool                     conformalized)
 {
-    // use the squared avg edge length as time step, as suggested in:
-    // Geodesics in Heat: A New Approach to Computing Distance Based on Heat Flow
-    // K.Crane, C.Weischedel, M.Wardetzky
-    // SIGGRAPH 2013
-    double time = m.edge_avg_length();
-    time *= time;
-    time *= time_scalar;
-
-    Eigen::SparseMatrix<double> L  = laplacian(m, COTANGENT);
-    Eigen::SparseMatrix<double> MM = mass_matrix(m);
+    MeanCurvatureFlow<M,V,E,P> flow(m, time_scalar, conformalized);
 
     for(uint i=1; i<=n_iters; ++i)
     {
-        // optimize position and scale to get better numerical precision
-        m.normalize_bbox();
-        m.center_bbox();        
+        double residual = flow.iterate();
+        std::cout << "MCF iter: " << i << " residual: " << residual << std::endl;
+    }
 
-        // backward euler time integration of heat flow equation
-        Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> LLT(MM - time_scalar * L);
+    m.update_bbox();
+}
 
-        uint nv = m.num_verts();
-        Eigen::VectorXd x(nv);
-        Eigen::VectorXd y(nv);
-        Eigen::VectorXd z(nv);
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        for(uint vid=0; vid<nv; ++vid)
+template<class M, class V, class E, class P>
+CINO_INLINE
+MeanCurvatureFlow<M,V,E,P>::MeanCurvatureFlow(AbstractPolygonMesh<M,V,E,P> & m,
+                                              const double                   time_step,
+                                              const bool                     conformalized,
+                                              const std::vector<uint>      & region)
+    : m(m)
+    , time_step(time_step)
+    , conformalized(conformalized)
+    , normalize(region.empty())
+{
+    free = region;
+    if(free.empty())
+    {
+        free.resize(m.num_verts());
+        std::iota(free.begin(), free.end(), 0);
+    }
+    local.assign(m.num_verts(), -1);
+    for(uint i=0; i<free.size(); ++i) local.at(free.at(i)) = int(i);
+    local_b.assign(m.num_verts(), -1);
+    for(uint vid : free)
+    for(uint nbr : m.adj_v2v(vid))
+    {
+        if(local.at(nbr)<0 && local_b.at(nbr)<0)
         {
-            vec3d pos = m.vert(vid);
-            x[vid] = pos.x();
-            y[vid] = pos.y();
-            z[vid] = pos.z();
+            local_b.at(nbr) = int(boundary.size());
+            boundary.push_back(nbr);
         }
+    }
+
+    if(conformalized) assemble_stiffness();
+}
 
-        x = LLT.solve(MM * x);
-        y = LLT.solve(MM * y);
-        z = LLT.solve(MM * z);
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        double residual = 0.0;
-        for(uint vid=0; vid<m.num_verts(); ++vid)
+template<class M, class V, class E, class P>
+CINO_INLINE
+void MeanCurvatureFlow<M,V,E,P>::assemble_stiffness()
+{
+    // same as laplacian(m,COTANGENT), restricted to the rows of the free vertices
+    typedef Eigen::Triplet<double> Entry;
+    std::vector<Entry> entries, entries_b;
+    std::vector<std::pair<uint,double>> wgts;
+    for(uint i=0; i<free.size(); ++i)
+    {
+        wgts.clear();
+        m.vert_weights(free.at(i), COTANGENT, wgts);
+        double sum = 0.0;
+        for(auto item : wgts)
+        {
+            int j = local.at(item.first);
+            if(j>=0) entries.push_back(Entry(i, j, item.second));
+            else     entries_b.push_back(Entry(i, local_b.at(item.first), item.second));
+            sum -= item.second;
+        }
+        if(sum == 0.0)
         {
-            vec3d new_pos(x[vid], y[vid], z[vid]);
-            residual += (m.vert(vid) - new_pos).norm();
-            m.vert(vid) = new_pos;
+            std::cerr << "WARNING: null row in the matrix! (disconnected vertex? I put 1 in the diagonal)" << std::endl;
+            sum = 1.0;
         }
+        entries.push_back(Entry(i, i, sum));
+    }
+    L.resize(free.size(), free.size());
+    L.setFromTriplets(entries.begin(), entries.end());
+    Lb.resize(free.size(), boundary.size());
+    Lb.setFromTriplets(entries_b.begin(), entries_b.end());
+}
 
-        std::cout << "MCF iter: " << i << " residual: " << residual << std::endl;
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+double MeanCurvatureFlow<M,V,E,P>::iterate()
+{
+    // matrices refer to the current positions (i.e. before normalization)
+    if(!conformalized) assemble_stiffness();
+
+    uint n = uint(free.size());
+    Eigen::SparseMatrix<double> MM(n,n);
+    {
+        std::vector<Eigen::Triplet<double>> entries;
+        entries.reserve(n);
+        for(uint i=0; i<n; ++i) entries.push_back(Eigen::Triplet<double>(i, i, m.vert_mass(free.at(i))));
+        MM.setFromTriplets(entries.begin(), entries.end());
+    }
+
+    // optimize position and scale to get better numerical precision
+    if(normalize)
+    {
+        m.normalize_bbox();
+        m.center_bbox();
+    }
 
-        if (i<n_iters) // update matrices for the next iteration
+    // backward euler time integration of heat flow equation. The sparsity
+    // pattern never changes, hence the symbolic factorization is reused
+    Eigen::SparseMatrix<double> A = MM - time_step * L;
+    if(!analyzed)
+    {
+        LLT.analyzePattern(A);
+        analyzed = true;
+    }
+    LLT.factorize(A);
+    if(LLT.info() != Eigen::Success)
+    {
+        std::cerr << "WARNING: MCF factorization failed (degenerate mesh?). Vertices are not moved" << std::endl;
+        return 0.0;
+    }
+
+    Eigen::MatrixXd X(n,3);
+    for(uint i=0; i<n; ++i)
+    {
+        const vec3d & pos = m.vert(free.at(i));
+        X(i,0) = pos.x();
+        X(i,1) = pos.y();
+        X(i,2) = pos.z();
+    }
+    Eigen::MatrixXd rhs = MM * X;
+    if(!boundary.empty()) // fixed vertices adjacent to the region
+    {
+        Eigen::MatrixXd Xb(boundary.size(),3);
+        for(uint i=0; i<boundary.size(); ++i)
         {
-            MM = mass_matrix(m);
-            if (!conformalized) L = laplacian(m, COTANGENT);
+            const vec3d & pos = m.vert(boundary.at(i));
+            Xb(i,0) = pos.x();
+            Xb(i,1) = pos.y();
+            Xb(i,2) = pos.z();
         }
+        rhs += time_step * (Lb * Xb);
     }
+    X = LLT.solve(rhs);
 
-    m.update_bbox();
+    double residual = 0.0;
+    for(uint i=0; i<n; ++i)
+    {
+        vec3d new_pos(X(i,0), X(i,1), X(i,2));
+        residual += (m.vert(free.at(i)) - new_pos).norm();
+        m.vert(free.at(i)) = new_pos;
+    }
+    return residual;
 }
 
 }
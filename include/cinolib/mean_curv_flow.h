@@ -39,6 +39,7 @@
 #include <sys/types.h>
 #include <cinolib/cino_inline.h>
 #include <cinolib/meshes/abstract_polygonmesh.h>
+#include <Eigen/Sparse>
 
 namespace cinolib
 {
@@ -58,6 +59,68 @@ void MCF(AbstractPolygonMesh<M,V,E,P> & m,
          const double                   time_scalar = 0.01, // I suggest very small steps for the conformalized version
          const bool                     conformalized = true);
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+/* Incremental version of MCF, which can also be restricted to a region of the
+ * mesh (implicit fairing of a patch, e.g. for interactive smoothing brushes).
+ * Each call to iterate() performs one step of backward Euler integration:
+ *
+ *      (M - t*L) x' = M x
+ *
+ * where the vertices outside the region (if any) are kept fixed and act as
+ * boundary conditions. Only the sub-system of the region is assembled and
+ * factorized, hence the cost of an iteration depends on the size of the region,
+ * not on the size of the mesh. Across iterations:
+ *
+ *  - the symbolic factorization is computed once (the sparsity pattern of the
+ *    system does not change), and only the numerical factorization is updated;
+ *  - for the conformalized flow the stiffness matrix is assembled once, and only
+ *    the (diagonal) mass matrix is updated;
+ *  - the three coordinates are solved at once, as a multi column right hand side.
+ *
+ * If no region is given the whole mesh is processed, and (as in MCF) the mesh is
+ * scaled and centered at each iteration for numerical precision. This does not
+ * happen for regions, as the position of the boundary is fixed. Neither the
+ * bounding box nor the normals are updated by iterate().
+*/
+
+template<class M, class V, class E, class P>
+class MeanCurvatureFlow
+{
+    public:
+
+        MeanCurvatureFlow(AbstractPolygonMesh<M,V,E,P> & m,
+                          const double                   time_step     = 0.01,
+                          const bool                     conformalized = true,
+                          const std::vector<uint>      & region        = {});  // free vertices (all, if empty)
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        double iterate(); // returns the sum of the vertex displacements
+
+        void   set_time_step(const double t) { time_step = t;    }
+        double get_time_step() const         { return time_step; }
+
+        const std::vector<uint> & free_verts() const { return free; }
+
+    protected:
+
+        void assemble_stiffness();
+
+        AbstractPolygonMesh<M,V,E,P> & m;
+        double                         time_step;
+        bool                           conformalized;
+        bool                           normalize;
+        std::vector<uint>              free;     // free vertices
+        std::vector<uint>              boundary; // fixed vertices adjacent to free ones
+        std::vector<int>               local;    // mesh vert id => position in free (or -1)
+        std::vector<int>               local_b;  // mesh vert id => position in boundary (or -1)
+        Eigen::SparseMatrix<double>    L;        // stiffness, free x free
+        Eigen::SparseMatrix<double>    Lb;       // stiffness, free x boundary
+        Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> LLT;
+        bool                           analyzed = false;
+};
+
 }
 
 #ifndef  CINO_STATIC_LIB
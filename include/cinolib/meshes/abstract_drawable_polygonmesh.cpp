@@ -137,10 +137,10 @@ void AbstractDrawablePolygonMesh<Mesh>::updateGL_mesh()
             drawlist.tri_coords.push_back(float(this->vert(vid).y()));
             drawlist.tri_coords.push_back(float(this->vert(vid).z()));
 
-            drawlist.tri_v_colors.push_back(this->vert_data(vid).color.r);
-            drawlist.tri_v_colors.push_back(this->vert_data(vid).color.g);
-            drawlist.tri_v_colors.push_back(this->vert_data(vid).color.b);
-            drawlist.tri_v_colors.push_back(this->vert_data(vid).color.a);
+            drawlist.tri_v_colors.push_back(this->vert_color(vid).r);
+            drawlist.tri_v_colors.push_back(this->vert_color(vid).g);
+            drawlist.tri_v_colors.push_back(this->vert_color(vid).b);
+            drawlist.tri_v_colors.push_back(this->vert_color(vid).a);
         }
     }
     else
@@ -149,7 +149,7 @@ void AbstractDrawablePolygonMesh<Mesh>::updateGL_mesh()
         {
             if (this->poly_data(pid).flags[HIDDEN]) continue;
 
-            vec3d n = this->poly_data(pid).normal;
+            vec3d n = this->poly_normal(pid);
 
             for(uint i=0; i<this->poly_tessellation(pid).size()/3; ++i)
             {
@@ -164,9 +164,9 @@ void AbstractDrawablePolygonMesh<Mesh>::updateGL_mesh()
                 float AO_vid0 = 0.f;
                 float AO_vid1 = 0.f;
                 float AO_vid2 = 0.f;
-                for(uint pid : vid0_vis_pids) AO_vid0 += this->poly_data(pid).AO*AO_alpha + (1.f - AO_alpha);
-                for(uint pid : vid1_vis_pids) AO_vid1 += this->poly_data(pid).AO*AO_alpha + (1.f - AO_alpha);
-                for(uint pid : vid2_vis_pids) AO_vid2 += this->poly_data(pid).AO*AO_alpha + (1.f - AO_alpha);
+                for(uint pid : vid0_vis_pids) AO_vid0 += this->poly_AO(pid)*AO_alpha + (1.f - AO_alpha);
+                for(uint pid : vid1_vis_pids) AO_vid1 += this->poly_AO(pid)*AO_alpha + (1.f - AO_alpha);
+                for(uint pid : vid2_vis_pids) AO_vid2 += this->poly_AO(pid)*AO_alpha + (1.f - AO_alpha);
                 AO_vid0 /= static_cast<float>(vid0_vis_pids.size());
                 AO_vid1 /= static_cast<float>(vid1_vis_pids.size());
                 AO_vid2 /= static_cast<float>(vid2_vis_pids.size());
@@ -193,9 +193,9 @@ void AbstractDrawablePolygonMesh<Mesh>::updateGL_mesh()
                     vec3d n_vid0(0,0,0);
                     vec3d n_vid1(0,0,0);
                     vec3d n_vid2(0,0,0);
-                    for(uint pid : vid0_vis_pids) n_vid0 += this->poly_data(pid).normal;
-                    for(uint pid : vid1_vis_pids) n_vid1 += this->poly_data(pid).normal;
-                    for(uint pid : vid2_vis_pids) n_vid2 += this->poly_data(pid).normal;
+                    for(uint pid : vid0_vis_pids) n_vid0 += this->poly_normal(pid);
+                    for(uint pid : vid1_vis_pids) n_vid1 += this->poly_normal(pid);
+                    for(uint pid : vid2_vis_pids) n_vid2 += this->poly_normal(pid);
                     n_vid0 /= static_cast<double>(vid0_vis_pids.size());
                     n_vid1 /= static_cast<double>(vid1_vis_pids.size());
                     n_vid2 /= static_cast<double>(vid2_vis_pids.size());
@@ -225,53 +225,53 @@ void AbstractDrawablePolygonMesh<Mesh>::updateGL_mesh()
 
                 if (drawlist.draw_mode & DRAW_TRI_TEXTURE1D)
                 {
-                    drawlist.tri_text.push_back(float(this->vert_data(vid0).uvw[0]));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid1).uvw[0]));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid2).uvw[0]));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid0)[0]));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid1)[0]));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid2)[0]));
                 }
                 else if (drawlist.draw_mode & DRAW_TRI_TEXTURE2D)
                 {
-                    drawlist.tri_text.push_back(float(this->vert_data(vid0).uvw[0]*drawlist.texture.scaling_factor));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid0).uvw[1]*drawlist.texture.scaling_factor));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid1).uvw[0]*drawlist.texture.scaling_factor));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid1).uvw[1]*drawlist.texture.scaling_factor));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid2).uvw[0]*drawlist.texture.scaling_factor));
-                    drawlist.tri_text.push_back(float(this->vert_data(vid2).uvw[1]*drawlist.texture.scaling_factor));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid0)[0]*drawlist.texture.scaling_factor));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid0)[1]*drawlist.texture.scaling_factor));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid1)[0]*drawlist.texture.scaling_factor));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid1)[1]*drawlist.texture.scaling_factor));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid2)[0]*drawlist.texture.scaling_factor));
+                    drawlist.tri_text.push_back(float(this->vert_uvw(vid2)[1]*drawlist.texture.scaling_factor));
                 }
 
                 if (drawlist.draw_mode & DRAW_TRI_FACECOLOR) // replicate f color on each vertex
                 {
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.r*AO_vid0);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.g*AO_vid0);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.b*AO_vid0);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.a);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.r*AO_vid1);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.g*AO_vid1);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.b*AO_vid1);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.a);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.r*AO_vid2);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.g*AO_vid2);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.b*AO_vid2);
-                    drawlist.tri_v_colors.push_back(this->poly_data(pid).color.a);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).r*AO_vid0);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).g*AO_vid0);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).b*AO_vid0);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).a);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).r*AO_vid1);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).g*AO_vid1);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).b*AO_vid1);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).a);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).r*AO_vid2);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).g*AO_vid2);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).b*AO_vid2);
+                    drawlist.tri_v_colors.push_back(this->poly_color(pid).a);
                 }
                 else if (drawlist.draw_mode & DRAW_TRI_VERTCOLOR)
                 {
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid0).color.r*AO_vid0);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid0).color.g*AO_vid0);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid0).color.b*AO_vid0);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid0).color.a);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid1).color.r*AO_vid1);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid1).color.g*AO_vid1);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid1).color.b*AO_vid1);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid1).color.a);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid2).color.r*AO_vid2);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid2).color.g*AO_vid2);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid2).color.b*AO_vid2);
-                    drawlist.tri_v_colors.push_back(this->vert_data(vid2).color.a);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid0).r*AO_vid0);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid0).g*AO_vid0);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid0).b*AO_vid0);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid0).a);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid1).r*AO_vid1);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid1).g*AO_vid1);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid1).b*AO_vid1);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid1).a);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid2).r*AO_vid2);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid2).g*AO_vid2);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid2).b*AO_vid2);
+                    drawlist.tri_v_colors.push_back(this->vert_color(vid2).a);
                 }
                 else if (drawlist.draw_mode & DRAW_TRI_QUALITY)
                 {
-                    float q = this->poly_data(pid).quality;
+                    float q = this->poly_quality(pid);
                     Color c = Color::red_white_blue_ramp_01(q);
                     drawlist.tri_v_colors.push_back(c.r*AO_vid0);
                     drawlist.tri_v_colors.push_back(c.g*AO_vid0);
@@ -316,14 +316,14 @@ void AbstractDrawablePolygonMesh<Mesh>::updateGL_mesh()
             drawlist.seg_coords.push_back(float(vid1.y()));
             drawlist.seg_coords.push_back(float(vid1.z()));
 
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.r);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.g);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.b);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.a);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.r);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.g);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.b);
-            drawlist.seg_colors.push_back(this->edge_data(eid).color.a);
+            drawlist.seg_colors.push_back(this->edge_color(eid).r);
+            drawlist.seg_colors.push_back(this->edge_color(eid).g);
+            drawlist.seg_colors.push_back(this->edge_color(eid).b);
+            drawlist.seg_colors.push_back(this->edge_color(eid).a);
+            drawlist.seg_colors.push_back(this->edge_color(eid).r);
+            drawlist.seg_colors.push_back(this->edge_color(eid).g);
+            drawlist.seg_colors.push_back(this->edge_color(eid).b);
+            drawlist.seg_colors.push_back(this->edge_color(eid).a);
         }
     }
 }
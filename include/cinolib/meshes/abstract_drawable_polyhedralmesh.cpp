@@ -129,15 +129,15 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_marked()
             drawlist_marked.tri_coords.push_back(float(this->vert(vid2).y()));
             drawlist_marked.tri_coords.push_back(float(this->vert(vid2).z()));
 
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.x()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.y()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.z()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.x()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.y()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.z()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.x()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.y()));
-            drawlist_marked.tri_v_norms.push_back(float(this->face_data(fid).normal.z()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).x()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).y()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).z()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).x()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).y()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).z()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).x()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).y()));
+            drawlist_marked.tri_v_norms.push_back(float(this->face_normal(fid).z()));
 
             drawlist_marked.tri_v_colors.push_back(marked_face_color.r);
             drawlist_marked.tri_v_colors.push_back(marked_face_color.g);
@@ -206,9 +206,9 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_out()
             float AO_vid0 = 0.f;
             float AO_vid1 = 0.f;
             float AO_vid2 = 0.f;
-            for(auto fp : vid0_vis_fids) AO_vid0 += this->face_data(fp.first).AO*AO_alpha + (1.f - AO_alpha);
-            for(auto fp : vid1_vis_fids) AO_vid1 += this->face_data(fp.first).AO*AO_alpha + (1.f - AO_alpha);
-            for(auto fp : vid2_vis_fids) AO_vid2 += this->face_data(fp.first).AO*AO_alpha + (1.f - AO_alpha);
+            for(auto fp : vid0_vis_fids) AO_vid0 += this->face_AO(fp.first)*AO_alpha + (1.f - AO_alpha);
+            for(auto fp : vid1_vis_fids) AO_vid1 += this->face_AO(fp.first)*AO_alpha + (1.f - AO_alpha);
+            for(auto fp : vid2_vis_fids) AO_vid2 += this->face_AO(fp.first)*AO_alpha + (1.f - AO_alpha);
             AO_vid0 /= static_cast<float>(vid0_vis_fids.size());
             AO_vid1 /= static_cast<float>(vid1_vis_fids.size());
             AO_vid2 /= static_cast<float>(vid2_vis_fids.size());
@@ -267,53 +267,53 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_out()
 
             if (drawlist_out.draw_mode & DRAW_TRI_TEXTURE1D)
             {
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid0).uvw[0]));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid1).uvw[0]));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid2).uvw[0]));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid0)[0]));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid1)[0]));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid2)[0]));
             }
             else if (drawlist_out.draw_mode & DRAW_TRI_TEXTURE2D)
             {
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid0).uvw[0]*drawlist_out.texture.scaling_factor));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid0).uvw[1]*drawlist_out.texture.scaling_factor));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid1).uvw[0]*drawlist_out.texture.scaling_factor));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid1).uvw[1]*drawlist_out.texture.scaling_factor));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid2).uvw[0]*drawlist_out.texture.scaling_factor));
-                drawlist_out.tri_text.push_back(float(this->vert_data(vid2).uvw[1]*drawlist_out.texture.scaling_factor));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid0)[0]*drawlist_out.texture.scaling_factor));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid0)[1]*drawlist_out.texture.scaling_factor));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid1)[0]*drawlist_out.texture.scaling_factor));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid1)[1]*drawlist_out.texture.scaling_factor));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid2)[0]*drawlist_out.texture.scaling_factor));
+                drawlist_out.tri_text.push_back(float(this->vert_uvw(vid2)[1]*drawlist_out.texture.scaling_factor));
             }
 
             if (drawlist_out.draw_mode & DRAW_TRI_FACECOLOR) // replicate f color on each vertex
             {
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.r*AO_vid0);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.g*AO_vid0);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.b*AO_vid0);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.a);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.r*AO_vid1);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.g*AO_vid1);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.b*AO_vid1);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.a);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.r*AO_vid2);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.g*AO_vid2);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.b*AO_vid2);
-                drawlist_out.tri_v_colors.push_back(this->poly_data(pid_beneath).color.a);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).r*AO_vid0);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).g*AO_vid0);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).b*AO_vid0);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).a);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).r*AO_vid1);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).g*AO_vid1);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).b*AO_vid1);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).a);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).r*AO_vid2);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).g*AO_vid2);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).b*AO_vid2);
+                drawlist_out.tri_v_colors.push_back(this->poly_color(pid_beneath).a);
             }
             else if (drawlist_out.draw_mode & DRAW_TRI_VERTCOLOR)
             {
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid0).color.r*AO_vid0);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid0).color.g*AO_vid0);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid0).color.b*AO_vid0);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid0).color.a);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid1).color.r*AO_vid1);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid1).color.g*AO_vid1);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid1).color.b*AO_vid1);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid1).color.a);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid2).color.r*AO_vid2);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid2).color.g*AO_vid2);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid2).color.b*AO_vid2);
-                drawlist_out.tri_v_colors.push_back(this->vert_data(vid2).color.a);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid0).r*AO_vid0);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid0).g*AO_vid0);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid0).b*AO_vid0);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid0).a);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid1).r*AO_vid1);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid1).g*AO_vid1);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid1).b*AO_vid1);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid1).a);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid2).r*AO_vid2);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid2).g*AO_vid2);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid2).b*AO_vid2);
+                drawlist_out.tri_v_colors.push_back(this->vert_color(vid2).a);
             }
             else if (drawlist_out.draw_mode & DRAW_TRI_QUALITY)
             {
-                float q = this->poly_data(pid_beneath).quality;
+                float q = this->poly_quality(pid_beneath);
                 Color c = Color::red_white_blue_ramp_01(q);
                 drawlist_out.tri_v_colors.push_back(c.r*AO_vid0);
                 drawlist_out.tri_v_colors.push_back(c.g*AO_vid0);
@@ -360,14 +360,14 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_out()
             drawlist_out.seg_coords.push_back(float(vid1.y()));
             drawlist_out.seg_coords.push_back(float(vid1.z()));
 
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.r);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.g);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.b);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.a);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.r);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.g);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.b);
-            drawlist_out.seg_colors.push_back(this->edge_data(eid).color.a);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).r);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).g);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).b);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).a);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).r);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).g);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).b);
+            drawlist_out.seg_colors.push_back(this->edge_color(eid).a);
         }
     }
 }
@@ -421,9 +421,9 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_in()
             float AO_vid0 = 0.f;
             float AO_vid1 = 0.f;
             float AO_vid2 = 0.f;
-            for(auto fp : vid0_vis_fids) AO_vid0 += this->face_data(fp.first).AO*AO_alpha + (1.f - AO_alpha);
-            for(auto fp : vid1_vis_fids) AO_vid1 += this->face_data(fp.first).AO*AO_alpha + (1.f - AO_alpha);
-            for(auto fp : vid2_vis_fids) AO_vid2 += this->face_data(fp.first).AO*AO_alpha + (1.f - AO_alpha);
+            for(auto fp : vid0_vis_fids) AO_vid0 += this->face_AO(fp.first)*AO_alpha + (1.f - AO_alpha);
+            for(auto fp : vid1_vis_fids) AO_vid1 += this->face_AO(fp.first)*AO_alpha + (1.f - AO_alpha);
+            for(auto fp : vid2_vis_fids) AO_vid2 += this->face_AO(fp.first)*AO_alpha + (1.f - AO_alpha);
             AO_vid0 /= static_cast<float>(vid0_vis_fids.size());
             AO_vid1 /= static_cast<float>(vid1_vis_fids.size());
             AO_vid2 /= static_cast<float>(vid2_vis_fids.size());
@@ -482,53 +482,53 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_in()
 
             if (drawlist_in.draw_mode & DRAW_TRI_TEXTURE1D)
             {
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid0).uvw[0]));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid1).uvw[0]));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid2).uvw[0]));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid0)[0]));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid1)[0]));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid2)[0]));
             }
             else if (drawlist_in.draw_mode & DRAW_TRI_TEXTURE2D)
             {
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid0).uvw[0]*drawlist_in.texture.scaling_factor));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid0).uvw[1]*drawlist_in.texture.scaling_factor));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid1).uvw[0]*drawlist_in.texture.scaling_factor));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid1).uvw[1]*drawlist_in.texture.scaling_factor));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid2).uvw[0]*drawlist_in.texture.scaling_factor));
-                drawlist_in.tri_text.push_back(float(this->vert_data(vid2).uvw[1]*drawlist_in.texture.scaling_factor));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid0)[0]*drawlist_in.texture.scaling_factor));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid0)[1]*drawlist_in.texture.scaling_factor));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid1)[0]*drawlist_in.texture.scaling_factor));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid1)[1]*drawlist_in.texture.scaling_factor));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid2)[0]*drawlist_in.texture.scaling_factor));
+                drawlist_in.tri_text.push_back(float(this->vert_uvw(vid2)[1]*drawlist_in.texture.scaling_factor));
             }
 
             if (drawlist_in.draw_mode & DRAW_TRI_FACECOLOR) // replicate f color on each vertex
             {
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.r*AO_vid0);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.g*AO_vid0);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.b*AO_vid0);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.a);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.r*AO_vid1);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.g*AO_vid1);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.b*AO_vid1);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.a);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.r*AO_vid2);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.g*AO_vid2);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.b*AO_vid2);
-                drawlist_in.tri_v_colors.push_back(this->poly_data(pid_beneath).color.a);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).r*AO_vid0);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).g*AO_vid0);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).b*AO_vid0);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).a);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).r*AO_vid1);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).g*AO_vid1);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).b*AO_vid1);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).a);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).r*AO_vid2);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).g*AO_vid2);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).b*AO_vid2);
+                drawlist_in.tri_v_colors.push_back(this->poly_color(pid_beneath).a);
             }
             else if (drawlist_in.draw_mode & DRAW_TRI_VERTCOLOR)
             {
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid0).color.r*AO_vid0);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid0).color.g*AO_vid0);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid0).color.b*AO_vid0);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid0).color.a);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid1).color.r*AO_vid1);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid1).color.g*AO_vid1);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid1).color.b*AO_vid1);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid1).color.a);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid2).color.r*AO_vid2);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid2).color.g*AO_vid2);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid2).color.b*AO_vid2);
-                drawlist_in.tri_v_colors.push_back(this->vert_data(vid2).color.a);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid0).r*AO_vid0);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid0).g*AO_vid0);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid0).b*AO_vid0);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid0).a);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid1).r*AO_vid1);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid1).g*AO_vid1);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid1).b*AO_vid1);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid1).a);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid2).r*AO_vid2);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid2).g*AO_vid2);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid2).b*AO_vid2);
+                drawlist_in.tri_v_colors.push_back(this->vert_color(vid2).a);
             }
             else if (drawlist_in.draw_mode & DRAW_TRI_QUALITY)
             {
-                float q = this->poly_data(pid_beneath).quality;
+                float q = this->poly_quality(pid_beneath);
                 Color c = Color::red_white_blue_ramp_01(q);
                 drawlist_in.tri_v_colors.push_back(c.r*AO_vid0);
                 drawlist_in.tri_v_colors.push_back(c.g*AO_vid0);
@@ -562,14 +562,14 @@ void AbstractDrawablePolyhedralMesh<Mesh>::updateGL_in()
         drawlist_in.seg_coords.push_back(float(vid1.y()));
         drawlist_in.seg_coords.push_back(float(vid1.z()));
 
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.r);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.g);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.b);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.a);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.r);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.g);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.b);
-        drawlist_in.seg_colors.push_back(this->edge_data(eid).color.a);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).r);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).g);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).b);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).a);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).r);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).g);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).b);
+        drawlist_in.seg_colors.push_back(this->edge_color(eid).a);
 
 //        if (this->edge_data(eid).flags[MARKED] && drawlist_in.draw_mode & DRAW_MARKED_SEGS)
 //        {
@@ -798,7 +798,7 @@ void AbstractDrawablePolyhedralMesh<Mesh>::show_out_wireframe_color(const Color
 {
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
-        if (this->edge_is_on_srf(eid)) this->edge_data(eid).color = c;
+        if (this->edge_is_on_srf(eid)) this->edge_color(eid) = c;
     }
     updateGL();
 }
@@ -820,7 +820,7 @@ void AbstractDrawablePolyhedralMesh<Mesh>::show_out_wireframe_transparency(const
 {
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
-        if (this->edge_is_on_srf(eid)) this->edge_data(eid).color.a = alpha;
+        if (this->edge_is_on_srf(eid)) this->edge_color(eid).a = alpha;
     }
     updateGL();
 }
@@ -929,7 +929,7 @@ void AbstractDrawablePolyhedralMesh<Mesh>::show_in_wireframe_color(const Color &
 {
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
-        if (!this->edge_is_on_srf(eid)) this->edge_data(eid).color = c;
+        if (!this->edge_is_on_srf(eid)) this->edge_color(eid) = c;
     }
     updateGL();
 }
@@ -951,7 +951,7 @@ void AbstractDrawablePolyhedralMesh<Mesh>::show_in_wireframe_transparency(const
 {
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
-        if (!this->edge_is_on_srf(eid)) this->edge_data(eid).color.a = alpha;
+        if (!this->edge_is_on_srf(eid)) this->edge_color(eid).a = alpha;
     }
     updateGL();
 }
@@ -37,6 +37,7 @@
 #include <cinolib/meshes/mesh_attributes.h>
 #include <cinolib/stl_container_utilities.h>
 #include <cinolib/min_max_inf.h>
+#include <cinolib/parallel_for.h>
 #include <map>
 #include <unordered_set>
 #include <unordered_map>
@@ -44,6 +45,22 @@
 namespace cinolib
 {
 
+template<class M, class V, class E, class P>
+CINO_INLINE
+AbstractMesh<M,V,E,P>::AbstractMesh()
+{
+    v_channels.bind<vec3d>(STD_NORMAL,  "normal",  vec3d(0,0,0));
+    v_channels.bind<Color>(STD_COLOR,   "color",   Color::WHITE());
+    v_channels.bind<vec3d>(STD_UVW,     "uvw",     vec3d(0,0,0));
+    v_channels.bind<int>  (STD_LABEL,   "label",   -1);
+    v_channels.bind<float>(STD_QUALITY, "quality", 0.f);
+    e_channels.bind<Color>(STD_COLOR,   "color",   Color::BLACK());
+    e_channels.bind<int>  (STD_LABEL,   "label",   -1);
+    p_channels.bind<Color>(STD_COLOR,   "color",   Color::WHITE());
+    p_channels.bind<int>  (STD_LABEL,   "label",   -1);
+    p_channels.bind<float>(STD_QUALITY, "quality", 0.f);
+}
+
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 template<class M, class V, class E, class P>
@@ -91,6 +108,7 @@ CINO_INLINE
 void AbstractMesh<M,V,E,P>::clear()
 {
     bb.reset();
+    pick_cache_clear();
     //
     verts.clear();
     edges.clear();
@@ -101,6 +119,9 @@ void AbstractMesh<M,V,E,P>::clear()
     v_data.clear();
     e_data.clear();
     p_data.clear();
+    v_channels.clear();
+    e_channels.clear();
+    p_channels.clear();
     //
     v2v.clear();
     v2e.clear();
@@ -112,6 +133,36 @@ void AbstractMesh<M,V,E,P>::clear()
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+template<class M, class V, class E, class P>
+CINO_INLINE
+void AbstractMesh<M,V,E,P>::vert_copy_attributes(const uint dst, const uint src)
+{
+    v_data.at(dst) = v_data.at(src);
+    v_channels.copy(dst, src);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void AbstractMesh<M,V,E,P>::edge_copy_attributes(const uint dst, const uint src)
+{
+    e_data.at(dst) = e_data.at(src);
+    e_channels.copy(dst, src);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void AbstractMesh<M,V,E,P>::poly_copy_attributes(const uint dst, const uint src)
+{
+    p_data.at(dst) = p_data.at(src);
+    p_channels.copy(dst, src);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<class M, class V, class E, class P>
 CINO_INLINE
 vec3d AbstractMesh<M,V,E,P>::centroid() const
@@ -131,6 +182,7 @@ void AbstractMesh<M,V,E,P>::translate(const vec3d & delta)
     for(uint vid=0; vid<num_verts(); ++vid) vert(vid) += delta;
     bb.min += delta;
     bb.max += delta;
+    pick_cache_clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -148,6 +200,7 @@ void AbstractMesh<M,V,E,P>::rotate(const vec3d & axis, const double angle)
         vert(vid)  = R*vert(vid);
         vert(vid) += c;
     }
+    pick_cache_clear();
     //
     if(m_data.update_bbox)    update_bbox();
     if(m_data.update_normals) update_normals();
@@ -193,6 +246,7 @@ CINO_INLINE
 void AbstractMesh<M,V,E,P>::transform(const mat3d & T)
 {
     for(uint vid=0; vid<num_verts(); ++vid) vert(vid) = T*vert(vid);
+    pick_cache_clear();
     if(m_data.update_bbox)    update_bbox();
     if(m_data.update_normals) update_normals();
 }
@@ -204,6 +258,7 @@ CINO_INLINE
 void AbstractMesh<M,V,E,P>::transform(const mat4d & T)
 {
     for(uint vid=0; vid<num_verts(); ++vid) vert(vid) = (T*vert(vid).add_coord(1)).rem_coord();
+    pick_cache_clear();
     if(m_data.update_bbox)    update_bbox();
     if(m_data.update_normals) update_normals();
 }
@@ -216,6 +271,7 @@ void AbstractMesh<M,V,E,P>::normalize_bbox()
 {
     double s = 1.0/bbox().diag();
     for(uint vid=0; vid<num_verts(); ++vid) vert(vid) *= s;
+    pick_cache_clear();
     if(m_data.update_bbox) update_bbox();
 }
 
@@ -227,6 +283,7 @@ void AbstractMesh<M,V,E,P>::update_bbox()
 {
     bb.reset();
     bb.push(this->verts);
+    pick_cache_clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -235,13 +292,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<vec3d> AbstractMesh<M,V,E,P>::vector_vert_normals() const
 {
-    std::vector<vec3d> normals;
-    normals.reserve(num_verts());
-    for(uint vid=0; vid<num_verts(); ++vid)
-    {
-        normals.push_back(vert_data(vid).normal);
-    }
-    return normals;
+    return v_channels.slot<vec3d>(STD_NORMAL);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -250,13 +301,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<Color> AbstractMesh<M,V,E,P>::vector_vert_colors() const
 {
-    std::vector<Color> colors;
-    colors.reserve(num_verts());
-    for(uint vid=0; vid<num_verts(); ++vid)
-    {
-        colors.push_back(vert_data(vid).color);
-    }
-    return colors;
+    return v_channels.slot<Color>(STD_COLOR);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -265,13 +310,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<int> AbstractMesh<M,V,E,P>::vector_vert_labels() const
 {
-    std::vector<int> labels;
-    labels.reserve(num_verts());
-    for(uint vid=0; vid<num_verts(); ++vid)
-    {
-        labels.push_back(vert_data(vid).label);
-    }
-    return labels;
+    return v_channels.slot<int>(STD_LABEL);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -280,13 +319,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<Color> AbstractMesh<M,V,E,P>::vector_edge_colors() const
 {
-    std::vector<Color> colors;
-    colors.reserve(num_edges());
-    for(uint eid=0; eid<num_edges(); ++eid)
-    {
-        colors.push_back(edge_data(eid).color);
-    }
-    return colors;
+    return e_channels.slot<Color>(STD_COLOR);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -295,13 +328,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<int> AbstractMesh<M,V,E,P>::vector_edge_labels() const
 {
-    std::vector<int> labels;
-    labels.reserve(num_edges());
-    for(uint eid=0; eid<num_edges(); ++eid)
-    {
-        labels.push_back(edge_data(eid).label);
-    }
-    return labels;
+    return e_channels.slot<int>(STD_LABEL);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -310,13 +337,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<vec3d> AbstractMesh<M,V,E,P>::vector_poly_normals() const
 {
-    std::vector<vec3d> normals;
-    normals.reserve(num_polys());
-    for(uint pid=0; pid<num_polys(); ++pid)
-    {
-        normals.push_back(poly_data(pid).normal);
-    }
-    return normals;
+    return p_channels.slot<vec3d>(STD_NORMAL);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -325,13 +346,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<Color> AbstractMesh<M,V,E,P>::vector_poly_colors() const
 {
-    std::vector<Color> colors;
-    colors.reserve(num_polys());
-    for(uint pid=0; pid<num_polys(); ++pid)
-    {
-        colors.push_back(poly_data(pid).color);
-    }
-    return colors;
+    return p_channels.slot<Color>(STD_COLOR);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -340,13 +355,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 std::vector<int> AbstractMesh<M,V,E,P>::vector_poly_labels() const
 {
-    std::vector<int> labels;
-    labels.reserve(num_polys());
-    for(uint pid=0; pid<num_polys(); ++pid)
-    {
-        labels.push_back(poly_data(pid).label);
-    }
-    return labels;
+    return p_channels.slot<int>(STD_LABEL);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -383,18 +392,18 @@ std::vector<double> AbstractMesh<M,V,E,P>::serialize_uvw(const int mode) const
     {
         switch (mode)
         {
-            case U_param  : uvw.push_back(vert_data(vid).uvw[0]); break;
-            case V_param  : uvw.push_back(vert_data(vid).uvw[1]); break;
-            case W_param  : uvw.push_back(vert_data(vid).uvw[2]); break;
-            case UV_param : uvw.push_back(vert_data(vid).uvw[0]);
-                            uvw.push_back(vert_data(vid).uvw[1]); break;
-            case UW_param : uvw.push_back(vert_data(vid).uvw[0]);
-                            uvw.push_back(vert_data(vid).uvw[2]); break;
-            case VW_param : uvw.push_back(vert_data(vid).uvw[1]);
-                            uvw.push_back(vert_data(vid).uvw[2]); break;
-            case UVW_param: uvw.push_back(vert_data(vid).uvw[0]);
-                            uvw.push_back(vert_data(vid).uvw[1]);
-                            uvw.push_back(vert_data(vid).uvw[2]); break;
+            case U_param  : uvw.push_back(vert_uvw(vid)[0]); break;
+            case V_param  : uvw.push_back(vert_uvw(vid)[1]); break;
+            case W_param  : uvw.push_back(vert_uvw(vid)[2]); break;
+            case UV_param : uvw.push_back(vert_uvw(vid)[0]);
+                            uvw.push_back(vert_uvw(vid)[1]); break;
+            case UW_param : uvw.push_back(vert_uvw(vid)[0]);
+                            uvw.push_back(vert_uvw(vid)[2]); break;
+            case VW_param : uvw.push_back(vert_uvw(vid)[1]);
+                            uvw.push_back(vert_uvw(vid)[2]); break;
+            case UVW_param: uvw.push_back(vert_uvw(vid)[0]);
+                            uvw.push_back(vert_uvw(vid)[1]);
+                            uvw.push_back(vert_uvw(vid)[2]); break;
             default: assert(false);
         }
     }
@@ -410,7 +419,7 @@ void AbstractMesh<M,V,E,P>::deserialize_uvw(const std::vector<vec3d> & uvw)
     assert(uvw.size()==num_verts());
     for(uint vid=0; vid<num_verts(); ++vid)
     {
-        vert_data(vid).uvw = uvw.at(vid);
+        vert_uvw(vid) = uvw.at(vid);
     }
 }
 
@@ -424,18 +433,18 @@ void AbstractMesh<M,V,E,P>::copy_xyz_to_uvw(const int mode)
     {
         switch (mode)
         {
-            case U_param  : vert_data(vid).uvw[0] = vert(vid).x(); break;
-            case V_param  : vert_data(vid).uvw[1] = vert(vid).y(); break;
-            case W_param  : vert_data(vid).uvw[2] = vert(vid).z(); break;
-            case UV_param : vert_data(vid).uvw[0] = vert(vid).x();
-                            vert_data(vid).uvw[1] = vert(vid).y(); break;
-            case UW_param : vert_data(vid).uvw[0] = vert(vid).x();
-                            vert_data(vid).uvw[2] = vert(vid).z(); break;
-            case VW_param : vert_data(vid).uvw[1] = vert(vid).y();
-                            vert_data(vid).uvw[2] = vert(vid).z(); break;
-            case UVW_param: vert_data(vid).uvw[0] = vert(vid).x();
-                            vert_data(vid).uvw[1] = vert(vid).y();
-                            vert_data(vid).uvw[2] = vert(vid).z(); break;
+            case U_param  : vert_uvw(vid)[0] = vert(vid).x(); break;
+            case V_param  : vert_uvw(vid)[1] = vert(vid).y(); break;
+            case W_param  : vert_uvw(vid)[2] = vert(vid).z(); break;
+            case UV_param : vert_uvw(vid)[0] = vert(vid).x();
+                            vert_uvw(vid)[1] = vert(vid).y(); break;
+            case UW_param : vert_uvw(vid)[0] = vert(vid).x();
+                            vert_uvw(vid)[2] = vert(vid).z(); break;
+            case VW_param : vert_uvw(vid)[1] = vert(vid).y();
+                            vert_uvw(vid)[2] = vert(vid).z(); break;
+            case UVW_param: vert_uvw(vid)[0] = vert(vid).x();
+                            vert_uvw(vid)[1] = vert(vid).y();
+                            vert_uvw(vid)[2] = vert(vid).z(); break;
             default: assert(false);
         }
     }
@@ -451,21 +460,22 @@ void AbstractMesh<M,V,E,P>::copy_uvw_to_xyz(const int mode)
     {
         switch (mode)
         {
-            case U_param  : vert(vid).x() = vert_data(vid).uvw[0]; break;
-            case V_param  : vert(vid).y() = vert_data(vid).uvw[1]; break;
-            case W_param  : vert(vid).z() = vert_data(vid).uvw[2]; break;
-            case UV_param : vert(vid).x() = vert_data(vid).uvw[0];
-                            vert(vid).y() = vert_data(vid).uvw[1]; break;
-            case UW_param : vert(vid).x() = vert_data(vid).uvw[0];
-                            vert(vid).z() = vert_data(vid).uvw[2]; break;
-            case VW_param : vert(vid).y() = vert_data(vid).uvw[1];
-                            vert(vid).z() = vert_data(vid).uvw[2]; break;
-            case UVW_param: vert(vid).x() = vert_data(vid).uvw[0];
-                            vert(vid).y() = vert_data(vid).uvw[1];
-                            vert(vid).z() = vert_data(vid).uvw[2]; break;
+            case U_param  : vert(vid).x() = vert_uvw(vid)[0]; break;
+            case V_param  : vert(vid).y() = vert_uvw(vid)[1]; break;
+            case W_param  : vert(vid).z() = vert_uvw(vid)[2]; break;
+            case UV_param : vert(vid).x() = vert_uvw(vid)[0];
+                            vert(vid).y() = vert_uvw(vid)[1]; break;
+            case UW_param : vert(vid).x() = vert_uvw(vid)[0];
+                            vert(vid).z() = vert_uvw(vid)[2]; break;
+            case VW_param : vert(vid).y() = vert_uvw(vid)[1];
+                            vert(vid).z() = vert_uvw(vid)[2]; break;
+            case UVW_param: vert(vid).x() = vert_uvw(vid)[0];
+                            vert(vid).y() = vert_uvw(vid)[1];
+                            vert(vid).z() = vert_uvw(vid)[2]; break;
             default: assert(false);
         }
     }
+    pick_cache_clear();
     if(m_data.update_bbox) update_bbox();
 }
 
@@ -477,8 +487,9 @@ void AbstractMesh<M,V,E,P>::swap_xyz_uvw(const bool normals, const bool bbox)
 {
     for(uint vid=0; vid<num_verts(); ++vid)
     {
-        std::swap(vert(vid),vert_data(vid).uvw);
+        std::swap(vert(vid),vert_uvw(vid));
     }
+    pick_cache_clear();
     if(normals) update_normals();
     if(bbox)    update_bbox();
 }
@@ -607,9 +618,9 @@ bool AbstractMesh<M,V,E,P>::vert_is_local_min(const uint vid, const int tex_coor
     {
         switch (tex_coord)
         {
-            case U_param : if (vert_data(nbr).uvw[0] < vert_data(vid).uvw[0]) return false; break;
-            case V_param : if (vert_data(nbr).uvw[1] < vert_data(vid).uvw[1]) return false; break;
-            case W_param : if (vert_data(nbr).uvw[2] < vert_data(vid).uvw[2]) return false; break;
+            case U_param : if (vert_uvw(nbr)[0] < vert_uvw(vid)[0]) return false; break;
+            case V_param : if (vert_uvw(nbr)[1] < vert_uvw(vid)[1]) return false; break;
+            case W_param : if (vert_uvw(nbr)[2] < vert_uvw(vid)[2]) return false; break;
             default: assert(false);
         }
     }
@@ -626,9 +637,9 @@ bool AbstractMesh<M,V,E,P>::vert_is_local_max(const uint vid, const int tex_coor
     {
         switch (tex_coord)
         {
-            case U_param : if (vert_data(nbr).uvw[0] > vert_data(vid).uvw[0]) return false; break;
-            case V_param : if (vert_data(nbr).uvw[1] > vert_data(vid).uvw[1]) return false; break;
-            case W_param : if (vert_data(nbr).uvw[2] > vert_data(vid).uvw[2]) return false; break;
+            case U_param : if (vert_uvw(nbr)[0] > vert_uvw(vid)[0]) return false; break;
+            case V_param : if (vert_uvw(nbr)[1] > vert_uvw(vid)[1]) return false; break;
+            case W_param : if (vert_uvw(nbr)[2] > vert_uvw(vid)[2]) return false; break;
             default: assert(false);
         }
     }
@@ -694,9 +705,9 @@ double AbstractMesh<M,V,E,P>::vert_min_uvw_value(const int tex_coord) const
     {
         switch (tex_coord)
         {
-            case U_param : min = std::min(min, vert_data(vid).uvw[0]); break;
-            case V_param : min = std::min(min, vert_data(vid).uvw[1]); break;
-            case W_param : min = std::min(min, vert_data(vid).uvw[2]); break;
+            case U_param : min = std::min(min, vert_uvw(vid)[0]); break;
+            case V_param : min = std::min(min, vert_uvw(vid)[1]); break;
+            case W_param : min = std::min(min, vert_uvw(vid)[2]); break;
             default: assert(false);
         }
     }
@@ -714,9 +725,9 @@ double AbstractMesh<M,V,E,P>::vert_max_uvw_value(const int tex_coord) const
     {
         switch (tex_coord)
         {
-            case U_param : max = std::max(max, vert_data(vid).uvw[0]); break;
-            case V_param : max = std::max(max, vert_data(vid).uvw[1]); break;
-            case W_param : max = std::max(max, vert_data(vid).uvw[2]); break;
+            case U_param : max = std::max(max, vert_uvw(vid)[0]); break;
+            case V_param : max = std::max(max, vert_uvw(vid)[1]); break;
+            case W_param : max = std::max(max, vert_uvw(vid)[2]); break;
             default: assert(false);
         }
     }
@@ -731,7 +742,7 @@ void AbstractMesh<M,V,E,P>::vert_set_color(const Color & c)
 {
     for(uint vid=0; vid<num_verts(); ++vid)
     {
-        vert_data(vid).color = c;
+        vert_color(vid) = c;
     }
 }
 
@@ -743,7 +754,7 @@ void AbstractMesh<M,V,E,P>::vert_set_alpha(const float alpha)
 {
     for(uint vid=0; vid<num_verts(); ++vid)
     {
-        vert_data(vid).color.a = alpha;
+        vert_color(vid).a = alpha;
     }
 }
 
@@ -936,7 +947,7 @@ void AbstractMesh<M,V,E,P>::edge_set_color(const Color & c)
 {
     for(uint eid=0; eid<num_edges(); ++eid)
     {
-        edge_data(eid).color = c;
+        edge_color(eid) = c;
     }
 }
 
@@ -948,7 +959,7 @@ void AbstractMesh<M,V,E,P>::edge_set_alpha(const float alpha)
 {
     for(uint eid=0; eid<num_edges(); ++eid)
     {
-        edge_data(eid).color.a = alpha;
+        edge_color(eid).a = alpha;
     }
 }
 
@@ -1060,9 +1071,9 @@ double AbstractMesh<M,V,E,P>::poly_sample_param_at(const uint pid, const double
     {
         switch(tex_coord)
         {
-            case U_param : val += bc[off] * this->vert_data(this->poly_vert_id(pid,off)).uvw[0]; break;
-            case V_param : val += bc[off] * this->vert_data(this->poly_vert_id(pid,off)).uvw[1]; break;
-            case W_param : val += bc[off] * this->vert_data(this->poly_vert_id(pid,off)).uvw[2]; break;
+            case U_param : val += bc[off] * this->vert_uvw(this->poly_vert_id(pid,off))[0]; break;
+            case V_param : val += bc[off] * this->vert_uvw(this->poly_vert_id(pid,off))[1]; break;
+            case W_param : val += bc[off] * this->vert_uvw(this->poly_vert_id(pid,off))[2]; break;
             default: assert(false);
         }
     }
@@ -1199,6 +1210,7 @@ void AbstractMesh<M,V,E,P>::center_bbox()
     for(uint vid=0; vid<num_verts(); ++vid) vert(vid) -= center;
     bb.min -= center;
     bb.max -= center;
+    pick_cache_clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -1209,7 +1221,7 @@ void AbstractMesh<M,V,E,P>::poly_set_color(const Color & c)
 {
     for(uint pid=0; pid<num_polys(); ++pid)
     {
-        poly_data(pid).color = c;
+        poly_color(pid) = c;
     }
 }
 
@@ -1221,7 +1233,7 @@ void AbstractMesh<M,V,E,P>::poly_set_alpha(const float alpha)
 {
     for(uint pid=0; pid<num_polys(); ++pid)
     {
-        poly_data(pid).color.a = alpha;
+        poly_color(pid).a = alpha;
     }
 }
 
@@ -1234,7 +1246,7 @@ void AbstractMesh<M,V,E,P>::poly_color_wrt_label(const bool sorted, const float
     std::map<int,uint> l_map;
     for(uint pid=0; pid<this->num_polys(); ++pid)
     {
-        int l = this->poly_data(pid).label;
+        int l = this->poly_label(pid);
         if(DOES_NOT_CONTAIN(l_map,l))
         {
             uint fresh_label = uint(l_map.size());
@@ -1244,8 +1256,8 @@ void AbstractMesh<M,V,E,P>::poly_color_wrt_label(const bool sorted, const float
     uint n_labels = uint(l_map.size());
     for(uint pid=0; pid<this->num_polys(); ++pid)
     {
-        if(sorted) this->poly_data(pid).color = Color::hsv_ramp(n_labels, this->poly_data(pid).label);
-        else       this->poly_data(pid).color = Color::scatter(n_labels,l_map.at(this->poly_data(pid).label), s, v);
+        if(sorted) this->poly_color(pid) = Color::hsv_ramp(n_labels, this->poly_label(pid));
+        else       this->poly_color(pid) = Color::scatter(n_labels,l_map.at(this->poly_label(pid)), s, v);
     }
 }
 
@@ -1258,12 +1270,12 @@ void AbstractMesh<M,V,E,P>::poly_label_wrt_color()
     std::map<Color,int> colormap;
     for(uint pid=0; pid<this->num_polys(); ++pid)
     {
-        const Color & c = this->poly_data(pid).color;
+        const Color & c = this->poly_color(pid);
         if(DOES_NOT_CONTAIN(colormap,c)) colormap[c] = int(colormap.size());
     }
     for(uint pid=0; pid<this->num_polys(); ++pid)
     {
-        this->poly_data(pid).label = colormap.at(this->poly_data(pid).color);
+        this->poly_label(pid) = colormap.at(this->poly_color(pid));
     }
 }
 
@@ -1322,7 +1334,7 @@ void AbstractMesh<M,V,E,P>::poly_apply_labels(const std::vector<int> & labels)
     assert(labels.size() == this->num_polys());
     for(uint pid=0; pid<num_polys(); ++pid)
     {
-        poly_data(pid).label = labels.at(pid);
+        poly_label(pid) = labels.at(pid);
     }
 }
 
@@ -1334,7 +1346,7 @@ void AbstractMesh<M,V,E,P>::poly_apply_label(const int label)
 {
     for(uint pid=0; pid<num_polys(); ++pid)
     {
-        poly_data(pid).label = label;
+        poly_label(pid) = label;
     }
 }
 
@@ -1356,7 +1368,7 @@ void AbstractMesh<M,V,E,P>::edge_apply_labels(const std::vector<int> & labels)
     assert(labels.size() == this->num_edges());
     for(uint eid=0; eid<num_edges(); ++eid)
     {
-        edge_data(eid).label = labels.at(eid);
+        edge_label(eid) = labels.at(eid);
     }
 }
 
@@ -1368,7 +1380,7 @@ void AbstractMesh<M,V,E,P>::edge_apply_label(const int label)
 {
     for(uint eid=0; eid<num_edges(); ++eid)
     {
-        edge_data(eid).label = label;
+        edge_label(eid) = label;
     }
 }
 
@@ -1381,7 +1393,7 @@ void AbstractMesh<M,V,E,P>::vert_apply_labels(const std::vector<int> & labels)
     assert(labels.size() == this->num_verts());
     for(uint vid=0; vid<num_verts(); ++vid)
     {
-        vert_data(vid).label = labels.at(vid);
+        vert_label(vid) = labels.at(vid);
     }
 }
 
@@ -1393,7 +1405,7 @@ void AbstractMesh<M,V,E,P>::vert_apply_label(const int label)
 {
     for(uint vid=0; vid<num_verts(); ++vid)
     {
-        vert_data(vid).label = label;
+        vert_label(vid) = label;
     }
 }
 
@@ -1417,48 +1429,69 @@ void AbstractMesh<M,V,E,P>::edge_mark_sharp_creases(const float thresh)
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-uint AbstractMesh<M,V,E,P>::pick_vert(const vec3d & p) const
+uint AbstractMesh<M,V,E,P>::pick_vert(const vec3d & p)
 {
-    std::vector<std::pair<double,uint>> closest;
-    for(uint vid=0; vid<this->num_verts(); ++vid)
-    {
-        if(vert_is_visible(vid)) closest.push_back(std::make_pair(this->vert(vid).dist(p),vid));
-    }
-    if(closest.empty()) return 0;
-    std::sort(closest.begin(), closest.end());
-    return closest.front().second;
+    if(pick_v_tree.size()!=this->num_verts()) pick_v_tree.build(this->verts);
+
+    uint   vid;
+    double dist;
+    if(!pick_v_tree.closest_point(p, [this](const uint vid){ return vert_is_visible(vid); }, vid, dist)) return 0;
+    return vid;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-uint AbstractMesh<M,V,E,P>::pick_edge(const vec3d & p) const
+uint AbstractMesh<M,V,E,P>::pick_edge(const vec3d & p)
 {
-    std::vector<std::pair<double,uint>> closest;
-    for(uint eid=0; eid<this->num_edges(); ++eid)
+    if(pick_e_tree.size()!=this->num_edges())
     {
-        if(edge_is_visible(eid)) closest.push_back(std::make_pair(this->edge_sample_at(eid, 0.5).dist(p),eid));
+        std::vector<vec3d> points(this->num_edges());
+        PARALLEL_FOR(0, this->num_edges(), 1000, [&](uint eid)
+        {
+            points[eid] = this->edge_sample_at(eid, 0.5);
+        });
+        pick_e_tree.build(points);
     }
-    if(closest.empty()) return 0;
-    std::sort(closest.begin(), closest.end());
-    return closest.front().second;
+
+    uint   eid;
+    double dist;
+    if(!pick_e_tree.closest_point(p, [this](const uint eid){ return edge_is_visible(eid); }, eid, dist)) return 0;
+    return eid;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 template<class M, class V, class E, class P>
 CINO_INLINE
-uint AbstractMesh<M,V,E,P>::pick_poly(const vec3d & p) const
+uint AbstractMesh<M,V,E,P>::pick_poly(const vec3d & p)
 {
-    std::vector<std::pair<double,uint>> closest;
-    for(uint pid=0; pid<this->num_polys(); ++pid)
+    if(pick_p_tree.size()!=this->num_polys())
     {
-        if(!this->poly_data(pid).flags[HIDDEN]) closest.push_back(std::make_pair(this->poly_centroid(pid).dist(p),pid));
+        std::vector<vec3d> points(this->num_polys());
+        PARALLEL_FOR(0, this->num_polys(), 1000, [&](uint pid)
+        {
+            points[pid] = this->poly_centroid(pid);
+        });
+        pick_p_tree.build(points);
     }
-    if(closest.empty()) return 0;
-    std::sort(closest.begin(), closest.end());
-    return closest.front().second;
+
+    uint   pid;
+    double dist;
+    if(!pick_p_tree.closest_point(p, [this](const uint pid){ return !this->poly_data(pid).flags[HIDDEN]; }, pid, dist)) return 0;
+    return pid;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void AbstractMesh<M,V,E,P>::pick_cache_clear()
+{
+    pick_v_tree.clear();
+    pick_e_tree.clear();
+    pick_p_tree.clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -45,6 +45,9 @@
 #include <cinolib/color.h>
 #include <cinolib/symbols.h>
 #include <cinolib/ipair.h>
+#include <cinolib/meshes/attribute_channels.h>
+#include <cinolib/meshes/mesh_attributes.h>
+#include <cinolib/point_kdtree.h>
 
 typedef enum
 {
@@ -80,6 +83,14 @@ class AbstractMesh
         std::vector<E> e_data;
         std::vector<P> p_data;
 
+        AttributeChannels v_channels; // standard and on demand attributes (see attribute_channels.h)
+        AttributeChannels e_channels;
+        AttributeChannels p_channels;
+
+        PointKdTree pick_v_tree; // lazily built indices for mouse picking
+        PointKdTree pick_e_tree;
+        PointKdTree pick_p_tree;
+
         std::vector<std::vector<uint>> v2v; // vert to vert adjacency
         std::vector<std::vector<uint>> v2e; // vert to edge adjacency
         std::vector<std::vector<uint>> v2p; // vert to poly adjacency
@@ -96,7 +107,7 @@ class AbstractMesh
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        explicit AbstractMesh() {}
+        explicit AbstractMesh();
         virtual ~AbstractMesh() {}
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -208,10 +219,58 @@ class AbstractMesh
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        // useful for GUIs with mouse picking
-        uint pick_vert(const vec3d & p) const;
-        uint pick_edge(const vec3d & p) const;
-        uint pick_poly(const vec3d & p) const;
+        // standard attributes, one dense channel each (see mesh_attributes.h)
+        const vec3d & vert_normal (const uint vid) const { return v_channels.slot<vec3d>(STD_NORMAL ).at(vid); }
+              vec3d & vert_normal (const uint vid)       { return v_channels.slot<vec3d>(STD_NORMAL ).at(vid); }
+        const Color & vert_color  (const uint vid) const { return v_channels.slot<Color>(STD_COLOR  ).at(vid); }
+              Color & vert_color  (const uint vid)       { return v_channels.slot<Color>(STD_COLOR  ).at(vid); }
+        const vec3d & vert_uvw    (const uint vid) const { return v_channels.slot<vec3d>(STD_UVW    ).at(vid); }
+              vec3d & vert_uvw    (const uint vid)       { return v_channels.slot<vec3d>(STD_UVW    ).at(vid); }
+        const int   & vert_label  (const uint vid) const { return v_channels.slot<int>  (STD_LABEL  ).at(vid); }
+              int   & vert_label  (const uint vid)       { return v_channels.slot<int>  (STD_LABEL  ).at(vid); }
+        const float & vert_quality(const uint vid) const { return v_channels.slot<float>(STD_QUALITY).at(vid); }
+              float & vert_quality(const uint vid)       { return v_channels.slot<float>(STD_QUALITY).at(vid); }
+        const Color & edge_color  (const uint eid) const { return e_channels.slot<Color>(STD_COLOR  ).at(eid); }
+              Color & edge_color  (const uint eid)       { return e_channels.slot<Color>(STD_COLOR  ).at(eid); }
+        const int   & edge_label  (const uint eid) const { return e_channels.slot<int>  (STD_LABEL  ).at(eid); }
+              int   & edge_label  (const uint eid)       { return e_channels.slot<int>  (STD_LABEL  ).at(eid); }
+        const Color & poly_color  (const uint pid) const { return p_channels.slot<Color>(STD_COLOR  ).at(pid); }
+              Color & poly_color  (const uint pid)       { return p_channels.slot<Color>(STD_COLOR  ).at(pid); }
+        const int   & poly_label  (const uint pid) const { return p_channels.slot<int>  (STD_LABEL  ).at(pid); }
+              int   & poly_label  (const uint pid)       { return p_channels.slot<int>  (STD_LABEL  ).at(pid); }
+        const float & poly_quality(const uint pid) const { return p_channels.slot<float>(STD_QUALITY).at(pid); }
+              float & poly_quality(const uint pid)       { return p_channels.slot<float>(STD_QUALITY).at(pid); }
+
+        // copy all the attributes (per element struct and channels) of element src into element dst
+        void vert_copy_attributes(const uint dst, const uint src);
+        void edge_copy_attributes(const uint dst, const uint src);
+        void poly_copy_attributes(const uint dst, const uint src);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        const AttributeChannels & vert_channels() const { return v_channels; }
+              AttributeChannels & vert_channels()       { return v_channels; }
+        const AttributeChannels & edge_channels() const { return e_channels; }
+              AttributeChannels & edge_channels()       { return e_channels; }
+        const AttributeChannels & poly_channels() const { return p_channels; }
+              AttributeChannels & poly_channels()       { return p_channels; }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // useful for GUIs with mouse picking. Return the element closest to p, that is,
+        // the closest visible vertex, edge midpoint or polygon/polyhedron centroid. Each
+        // method builds a kd-tree at its first call, and reuses it until the mesh changes.
+        // Hidden elements are skipped at query time, hence hiding/showing parts of the mesh
+        // does not require to rebuild the trees. Trees are released when connectivity
+        // changes, when vertices are moved by methods of the mesh (translate, scale,
+        // transform, ...) and when update_bbox/update_normals are called. If vertices are
+        // moved through vert(vid) or vector_verts(), call pick_cache_clear().
+        // NOTE: these methods are not const, as they may (re)build the trees, and are
+        // NOT thread safe: do not pick from multiple threads on the same mesh
+        uint pick_vert(const vec3d & p);
+        uint pick_edge(const vec3d & p);
+        uint pick_poly(const vec3d & p);
+        virtual void pick_cache_clear();
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
@@ -41,10 +41,12 @@
 #include <cinolib/geometry/polygon_utils.h>
 #include <cinolib/vector_serialization.h>
 #include <cinolib/how_many_seconds.h>
+#include <cinolib/parallel_for.h>
 #include <cinolib/deg_rad.h>
 #include <unordered_set>
 #include <cinolib/ANSI_color_codes.h>
 #include <queue>
+#include <algorithm>
 
 namespace cinolib
 {
@@ -128,9 +130,9 @@ void AbstractPolygonMesh<M,V,E,P>::save(const char * filename) const
         normals.reserve(3*this->num_polys());
         for (uint pid=0; pid<this->num_polys(); ++pid)
         {
-            normals.push_back(this->poly_data(pid).normal.x());
-            normals.push_back(this->poly_data(pid).normal.y());
-            normals.push_back(this->poly_data(pid).normal.z());
+            normals.push_back(this->poly_normal(pid).x());
+            normals.push_back(this->poly_normal(pid).y());
+            normals.push_back(this->poly_normal(pid).z());
         }
 
         write_STL(filename, serialized_xyz_from_vec3d(this->vector_verts()), this->polys, normals);
@@ -143,6 +145,16 @@ void AbstractPolygonMesh<M,V,E,P>::save(const char * filename) const
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+template<class M, class V, class E, class P>
+CINO_INLINE
+AbstractPolygonMesh<M,V,E,P>::AbstractPolygonMesh() : AbstractMesh<M,V,E,P>()
+{
+    this->p_channels.template bind<vec3d>(STD_NORMAL, "normal", vec3d(0,0,0));
+    this->p_channels.template bind<float>(STD_AO,     "AO",     1.f);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<class M, class V, class E, class P>
 CINO_INLINE
 void AbstractPolygonMesh<M,V,E,P>::clear()
@@ -175,14 +187,21 @@ void AbstractPolygonMesh<M,V,E,P>::init(const std::vector<vec3d>             & v
     this->p2e.reserve(np);
     this->p2p.reserve(np);
     this->v_data.reserve(nv);
+    this->v_channels.reserve(nv);
     this->e_data.reserve(ne);
+    this->e_channels.reserve(ne);
     this->p_data.reserve(np);
+    this->p_channels.reserve(np);
 
-    // initialize mesh connectivity (and normals)
+    // initialize mesh connectivity, then compute per polygon
+    // normals and tessellations in parallel, all at once
     for(auto v : verts) this->vert_add(v);
+    defer_p_updates = true;
     for(auto p : polys) this->poly_add(p);
+    defer_p_updates = false;
 
-    if(this->mesh_data().update_normals) this->update_v_normals();
+    update_p_tessellations();
+    if(this->mesh_data().update_normals) this->update_normals();
 
     this->copy_xyz_to_uvw(UVW_param);
 
@@ -256,7 +275,7 @@ void AbstractPolygonMesh<M,V,E,P>::init(      std::vector<vec3d>             & p
         std::cout << "load textures" << std::endl;
         for(uint vid=0; vid<this->num_verts(); ++vid)
         {
-            this->vert_data(vid).uvw = tex.at(vid);
+            this->vert_uvw(vid) = tex.at(vid);
         }
     }
     else this->copy_xyz_to_uvw(UVW_param);
@@ -267,7 +286,7 @@ void AbstractPolygonMesh<M,V,E,P>::init(      std::vector<vec3d>             & p
         std::cout << "load normals" << std::endl;
         for(uint vid=0; vid<this->num_verts(); ++vid)
         {
-            this->vert_data(vid).normal = nor.at(vid);
+            this->vert_normal(vid) = nor.at(vid);
         }
     }
 
@@ -277,7 +296,7 @@ void AbstractPolygonMesh<M,V,E,P>::init(      std::vector<vec3d>             & p
         std::cout << "load per polygon colors" << std::endl;
         for(uint pid=0; pid<this->num_polys(); ++pid)
         {
-            this->poly_data(pid).color = poly_col.at(pid);
+            this->poly_color(pid) = poly_col.at(pid);
         }
     }
 
@@ -293,49 +312,74 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void AbstractPolygonMesh<M,V,E,P>::update_p_tessellation(const uint pid)
 {
-    // Assume convexity and try trivial tessellation first. If something flips
-    // apply earcut algorithm to get a valid triangulation
-
-    poly_triangles.at(pid).clear();
-    std::vector<vec3d> n;
-    for(uint i=2; i<this->verts_per_poly(pid); ++i)
-    {
-        uint vid0 = this->polys.at(pid).at( 0 );
-        uint vid1 = this->polys.at(pid).at(i-1);
-        uint vid2 = this->polys.at(pid).at( i );
+    // Assume convexity and try trivial tessellation first. If something flips, keep the
+    // current tessellation if it is still valid (e.g. if only vertex positions changed),
+    // otherwise apply earcut algorithm to get a valid triangulation
 
-        poly_triangles.at(pid).push_back(vid0);
-        poly_triangles.at(pid).push_back(vid1);
-        poly_triangles.at(pid).push_back(vid2);
+    const std::vector<uint> & p    = this->polys.at(pid);
+          std::vector<uint> & tris = poly_triangles.at(pid);
+    assert(p.size()>2);
+    uint nt = uint(p.size())-2;
 
-        n.push_back((this->vert(vid1)-this->vert(vid0)).cross(this->vert(vid2)-this->vert(vid0)));
+    // the fan normals also sum up to the Newell normal of the polygon (see update_p_normal)
+    bool  bad_tessellation = false;
+    vec3d prev_n, newell(0,0,0);
+    for(uint i=2; i<p.size(); ++i)
+    {
+        vec3d n = (this->vert(p.at(i-1))-this->vert(p.at(0))).cross(this->vert(p.at(i))-this->vert(p.at(0)));
+        if(i>2 && prev_n.dot(n)<0) bad_tessellation = true;
+        prev_n  = n;
+        newell += n;
     }
 
-    bool bad_tessellation = false;
-    for(uint i=0; i<n.size()-1; ++i) if (n.at(i).dot(n.at(i+1))<0) bad_tessellation = true;
-
-    if(bad_tessellation)
+    if(!bad_tessellation)
     {
-        // NOTE: the triangulation is constructed on a proxy polygon obtained
-        // projecting the actual polygon onto the best fitting plane. Bad things
-        // can still happen for highly non-planar polygons...
-
-        std::vector<vec3d> vlist(this->verts_per_poly(pid));
-        for (uint i=0; i<this->verts_per_poly(pid); ++i)
+        tris.resize(3*nt);
+        for(uint i=2; i<p.size(); ++i)
         {
-            vlist.at(i) = this->poly_vert(pid,i);
+            tris.at(3*(i-2)  ) = p.at( 0 );
+            tris.at(3*(i-2)+1) = p.at(i-1);
+            tris.at(3*(i-2)+2) = p.at( i );
         }
-        //
-        std::vector<uint> tris;
-        poly_triangles.at(pid).clear();
-        if(polygon_triangulate(vlist, tris))
-        {
-            for(uint off : tris) poly_triangles.at(pid).push_back(this->poly_vert_id(pid,off));
-        }
-        else
+        return;
+    }
+
+    if(tris.size()==3*nt)
+    {
+        // the current tessellation is still valid if it is made of vertices of
+        // the polygon, and all its triangles agree with the polygon orientation
+        std::vector<uint> sorted_p = p;
+        std::sort(sorted_p.begin(), sorted_p.end());
+        bool valid = true;
+        for(uint vid : tris) if(!std::binary_search(sorted_p.begin(), sorted_p.end(), vid)) valid = false;
+        for(uint i=0; i<nt && valid; ++i)
         {
-            std::cout << "WARNING: could not triangulate a polygon. Is it degenerate?" << std::endl;
+            const vec3d & v0 = this->vert(tris.at(3*i));
+            vec3d n = (this->vert(tris.at(3*i+1))-v0).cross(this->vert(tris.at(3*i+2))-v0);
+            if(n.dot(newell)<0) valid = false;
         }
+        if(valid) return;
+    }
+
+    // NOTE: the triangulation is constructed on a proxy polygon obtained
+    // projecting the actual polygon onto the best fitting plane. Bad things
+    // can still happen for highly non-planar polygons...
+
+    std::vector<vec3d> vlist(this->verts_per_poly(pid));
+    for (uint i=0; i<this->verts_per_poly(pid); ++i)
+    {
+        vlist.at(i) = this->poly_vert(pid,i);
+    }
+    //
+    std::vector<uint> earcut_tris;
+    tris.clear();
+    if(polygon_triangulate(vlist, earcut_tris))
+    {
+        for(uint off : earcut_tris) tris.push_back(this->poly_vert_id(pid,off));
+    }
+    else
+    {
+        std::cout << "WARNING: could not triangulate a polygon. Is it degenerate?" << std::endl;
     }
 }
 
@@ -348,10 +392,10 @@ void AbstractPolygonMesh<M,V,E,P>::update_v_normal(const uint vid)
     vec3d n(0,0,0);
     for(uint pid : this->adj_v2p(vid))
     {
-        n += this->poly_data(pid).normal;
+        n += this->poly_normal(pid);
     }
     if (n.norm()>0) n.normalize();
-    this->vert_data(vid).normal = n;
+    this->vert_normal(vid) = n;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -360,10 +404,19 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void AbstractPolygonMesh<M,V,E,P>::update_p_normal(const uint pid)
 {
-    // compute the best fitting plane
-    std::vector<vec3d> points;
-    for(uint off=0; off<this->verts_per_poly(pid); ++off) points.push_back(this->poly_vert(pid,off));
-    this->poly_data(pid).normal = polygon_normal(points);
+    // Newell's method, i.e. the sum of the area vectors of the triangles of any
+    // consistent tessellation of the polygon (the trivial one is used here). For
+    // planar polygons it is the plane normal, for non planar ones it is a robust
+    // average, and it is null for degenerate polygons
+    const std::vector<uint> & p  = this->polys.at(pid);
+    const vec3d             & v0 = this->vert(p.at(0));
+    vec3d n(0,0,0);
+    for(uint i=2; i<p.size(); ++i)
+    {
+        n += (this->vert(p.at(i-1))-v0).cross(this->vert(p.at(i))-v0);
+    }
+    if(n.norm()>0) n.normalize();
+    this->poly_normal(pid) = n;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -372,10 +425,10 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void AbstractPolygonMesh<M,V,E,P>::update_p_normals()
 {
-    for(uint pid=0; pid<this->num_polys(); ++pid)
+    PARALLEL_FOR(0, this->num_polys(), 1000, [this](uint pid)
     {
         update_p_normal(pid);
-    }
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -384,10 +437,10 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void AbstractPolygonMesh<M,V,E,P>::update_p_tessellations()
 {
-    for(uint pid=0; pid<this->num_polys(); ++pid)
+    PARALLEL_FOR(0, this->num_polys(), 1000, [this](uint pid)
     {
         update_p_tessellation(pid);
-    }
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -396,10 +449,11 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void AbstractPolygonMesh<M,V,E,P>::update_v_normals()
 {
-    for(uint vid=0; vid<this->num_verts(); ++vid)
+    // each vertex gathers the normals of its incident polygons, hence vertices are independent
+    PARALLEL_FOR(0, this->num_verts(), 1000, [this](uint vid)
     {
         update_v_normal(vid);
-    }
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -410,6 +464,7 @@ void AbstractPolygonMesh<M,V,E,P>::update_normals()
 {
     this->update_p_normals();
     this->update_v_normals();
+    this->pick_cache_clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -479,7 +534,7 @@ double AbstractPolygonMesh<M,V,E,P>::mesh_volume() const
             vec3d C    = this->vert(this->poly_tessellation(pid).at(3*i+2));
 
             vec3d OA   = A - O;
-            vec3d n    = this->poly_data(pid).normal;
+            vec3d n    = this->poly_normal(pid);
 
             vol += (n.dot(OA) > 0) ?  tet_unsigned_volume(A,B,C,O)
                                    : -tet_unsigned_volume(A,B,C,O);
@@ -504,9 +559,9 @@ bool AbstractPolygonMesh<M,V,E,P>::vert_is_saddle(const uint vid, const int tex_
         //
         switch (tex_coord)
         {
-            case U_param : if (this->vert_data(nbr).uvw[0] != this->vert_data(vid).uvw[0]) signs.push_back(this->vert_data(nbr).uvw[0] > this->vert_data(vid).uvw[0]); break;
-            case V_param : if (this->vert_data(nbr).uvw[1] != this->vert_data(vid).uvw[1]) signs.push_back(this->vert_data(nbr).uvw[1] > this->vert_data(vid).uvw[1]); break;
-            case W_param : if (this->vert_data(nbr).uvw[2] != this->vert_data(vid).uvw[2]) signs.push_back(this->vert_data(nbr).uvw[2] > this->vert_data(vid).uvw[2]); break;
+            case U_param : if (this->vert_uvw(nbr)[0] != this->vert_uvw(vid)[0]) signs.push_back(this->vert_uvw(nbr)[0] > this->vert_uvw(vid)[0]); break;
+            case V_param : if (this->vert_uvw(nbr)[1] != this->vert_uvw(vid)[1]) signs.push_back(this->vert_uvw(nbr)[1] > this->vert_uvw(vid)[1]); break;
+            case W_param : if (this->vert_uvw(nbr)[2] != this->vert_uvw(vid)[2]) signs.push_back(this->vert_uvw(nbr)[2] > this->vert_uvw(vid)[2]); break;
             default: assert(false);
         }
     }
@@ -886,7 +941,7 @@ std::vector<uint> AbstractPolygonMesh<M,V,E,P>::vert_adj_visible_polys(const uin
     {
         if(!this->poly_data(pid).flags[HIDDEN])
         {
-            vec3d n = this->poly_data(pid).normal;
+            vec3d n = this->poly_normal(pid);
             if(dir.angle_deg(n) < ang_thresh) nbrs.push_back(pid);
         }
     }
@@ -905,6 +960,8 @@ uint AbstractPolygonMesh<M,V,E,P>::vert_add(const vec3d & pos)
     //
     V data;
     this->v_data.push_back(data);
+    this->v_channels.push_back();
+    this->pick_cache_clear();
     //
     this->v2v.push_back(std::vector<uint>());
     this->v2e.push_back(std::vector<uint>());
@@ -955,6 +1012,8 @@ void AbstractPolygonMesh<M,V,E,P>::vert_switch_id(const uint vid0, const uint vi
 
     std::swap(this->verts.at(vid0),  this->verts.at(vid1));
     std::swap(this->v_data.at(vid0), this->v_data.at(vid1));
+    this->v_channels.swap(vid0, vid1);
+    this->pick_cache_clear();
     std::swap(this->v2v.at(vid0),    this->v2v.at(vid1));
     std::swap(this->v2e.at(vid0),    this->v2e.at(vid1));
     std::swap(this->v2p.at(vid0),    this->v2p.at(vid1));
@@ -1026,6 +1085,8 @@ void AbstractPolygonMesh<M,V,E,P>::vert_remove_unreferenced(const uint vid)
     vert_switch_id(vid, this->num_verts()-1);
     this->verts.pop_back();
     this->v_data.pop_back();
+    this->v_channels.pop_back();
+    this->pick_cache_clear();
     this->v2v.pop_back();
     this->v2e.pop_back();
     this->v2p.pop_back();
@@ -1052,8 +1113,8 @@ double AbstractPolygonMesh<M,V,E,P>::edge_dihedral_angle(const uint eid) const
 
     uint   pid0 = this->adj_e2p(eid).front();
     uint   pid1 = this->adj_e2p(eid).back();
-    vec3d  n0   = this->poly_data(pid0).normal;
-    vec3d  n1   = this->poly_data(pid1).normal;
+    vec3d  n0   = this->poly_normal(pid0);
+    vec3d  n1   = this->poly_normal(pid1);
 
     return n0.angle_rad(n1);
 }
@@ -1132,6 +1193,8 @@ uint AbstractPolygonMesh<M,V,E,P>::edge_add(const uint vid0, const uint vid1)
     //
     E data;
     this->e_data.push_back(data);
+    this->e_channels.push_back();
+    this->pick_cache_clear();
     //
     this->v2v.at(vid1).push_back(vid0);
     this->v2v.at(vid0).push_back(vid1);
@@ -1156,6 +1219,8 @@ void AbstractPolygonMesh<M,V,E,P>::edge_switch_id(const uint eid0, const uint ei
 
     std::swap(this->e2p.at(eid0),    this->e2p.at(eid1));
     std::swap(this->e_data.at(eid0), this->e_data.at(eid1));
+    this->e_channels.swap(eid0, eid1);
+    this->pick_cache_clear();
 
     std::unordered_set<uint> verts_to_update;
     verts_to_update.insert(this->edge_vert_id(eid0,0));
@@ -1205,6 +1270,8 @@ void AbstractPolygonMesh<M,V,E,P>::edge_remove_unreferenced(const uint eid)
     edge_switch_id(eid, this->num_edges()-1);
     this->edges.resize(this->edges.size()-2);
     this->e_data.pop_back();
+    this->e_channels.pop_back();
+    this->pick_cache_clear();
     this->e2p.pop_back();
 }
 
@@ -1217,7 +1284,7 @@ void AbstractPolygonMesh<M,V,E,P>::edge_mark_labeling_boundaries()
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
         std::unordered_set<int> unique_labels;
-        for(uint pid : this->adj_e2p(eid)) unique_labels.insert(this->poly_data(pid).label);
+        for(uint pid : this->adj_e2p(eid)) unique_labels.insert(this->poly_label(pid));
         this->edge_data(eid).flags[MARKED] = (unique_labels.size()>=2);
     }
 }
@@ -1231,7 +1298,7 @@ void AbstractPolygonMesh<M,V,E,P>::edge_mark_color_discontinuities()
     for(uint eid=0; eid<this->num_edges(); ++eid)
     {
         std::set<Color> unique_colors;
-        for(uint pid : this->adj_e2p(eid)) unique_colors.insert(this->poly_data(pid).color);
+        for(uint pid : this->adj_e2p(eid)) unique_colors.insert(this->poly_color(pid));
 
         this->edge_data(eid).flags[MARKED] = (unique_colors.size()>=2);
     }
@@ -1280,7 +1347,7 @@ double AbstractPolygonMesh<M,V,E,P>::poly_angle_at_vert(const uint pid, const ui
     vec3d  v      = this->poly_vert(pid, next) - p;
     double angle  = u.angle_rad(v);
 
-    if((-u).cross(v).dot(this->poly_data(pid).normal)<0)
+    if((-u).cross(v).dot(this->poly_normal(pid))<0)
     {
         angle = 2*M_PI - angle;
     }
@@ -1425,6 +1492,8 @@ void AbstractPolygonMesh<M,V,E,P>::poly_switch_id(const uint pid0, const uint pi
 
     std::swap(this->polys.at(pid0),          this->polys.at(pid1));
     std::swap(this->p_data.at(pid0),         this->p_data.at(pid1));
+    this->p_channels.swap(pid0, pid1);
+    this->pick_cache_clear();
     std::swap(this->p2e.at(pid0),            this->p2e.at(pid1));
     std::swap(this->p2p.at(pid0),            this->p2p.at(pid1));
     std::swap(this->poly_triangles.at(pid0), this->poly_triangles.at(pid1));
@@ -1489,6 +1558,8 @@ uint AbstractPolygonMesh<M,V,E,P>::poly_add(const std::vector<uint> & vlist)
 
     P data;
     this->p_data.push_back(data);
+    this->p_channels.push_back();
+    this->pick_cache_clear();
 
     this->p2e.push_back(std::vector<uint>());
     this->p2p.push_back(std::vector<uint>());
@@ -1528,9 +1599,12 @@ uint AbstractPolygonMesh<M,V,E,P>::poly_add(const std::vector<uint> & vlist)
         this->p2e.at(pid).push_back(eid);
     }
 
-    if(this->mesh_data().update_normals) this->update_p_normal(pid);
     this->poly_triangles.push_back(std::vector<uint>());
-    update_p_tessellation(pid);
+    if(!defer_p_updates)
+    {
+        if(this->mesh_data().update_normals) this->update_p_normal(pid);
+        update_p_tessellation(pid);
+    }
 
     return pid;
 }
@@ -1614,6 +1688,8 @@ void AbstractPolygonMesh<M,V,E,P>::poly_remove_unreferenced(const uint pid)
     poly_switch_id(pid, this->num_polys()-1);
     this->polys.pop_back();
     this->p_data.pop_back();
+    this->p_channels.pop_back();
+    this->pick_cache_clear();
     this->p2e.pop_back();
     this->p2p.pop_back();
     this->poly_triangles.pop_back();
@@ -1762,6 +1838,11 @@ void AbstractPolygonMesh<M,V,E,P>::operator+=(const AbstractPolygonMesh<M,V,E,P>
         this->v2v.push_back(tmp);
     }
 
+    this->v_channels.append(m.v_channels);
+    this->e_channels.append(m.e_channels);
+    this->p_channels.append(m.p_channels);
+    this->pick_cache_clear();
+
     if(this->mesh_data().update_bbox) this->update_bbox();
 
     std::cout << "Appended " << m.mesh_data().filename << " to mesh " << this->mesh_data().filename << std::endl;
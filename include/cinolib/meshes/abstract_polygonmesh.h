@@ -55,13 +55,23 @@ class AbstractPolygonMesh : public AbstractMesh<M,V,E,P>
         std::vector<std::vector<uint>> poly_triangles; // triangles covering each quad. Useful for
                                                        // robust normal estimation and rendering
 
+        bool defer_p_updates = false; // if true, poly_add does not compute normals and tessellations (see init)
+
     public:
 
-        explicit AbstractPolygonMesh() : AbstractMesh<M,V,E,P>() {}
+        explicit AbstractPolygonMesh();
         ~AbstractPolygonMesh() {}
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+        // standard attributes of polygons only (see mesh_attributes.h)
+        const vec3d & poly_normal(const uint pid) const { return this->p_channels.template slot<vec3d>(STD_NORMAL).at(pid); }
+              vec3d & poly_normal(const uint pid)       { return this->p_channels.template slot<vec3d>(STD_NORMAL).at(pid); }
+        const float & poly_AO    (const uint pid) const { return this->p_channels.template slot<float>(STD_AO    ).at(pid); }
+              float & poly_AO    (const uint pid)       { return this->p_channels.template slot<float>(STD_AO    ).at(pid); }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
         void load(const char * filename) override;
         void save(const char * filename) const override;
 
@@ -37,14 +37,29 @@
 #include <cinolib/geometry/triangle.h>
 #include <cinolib/geometry/polygon_utils.h>
 #include <cinolib/how_many_seconds.h>
+#include <cinolib/parallel_for.h>
 #include <unordered_set>
 #include <unordered_map>
 #include <cinolib/ANSI_color_codes.h>
 #include <queue>
+#include <algorithm>
 
 namespace cinolib
 {
 
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+AbstractPolyhedralMesh<M,V,E,F,P>::AbstractPolyhedralMesh() : AbstractMesh<M,V,E,P>()
+{
+    f_channels.bind<vec3d>(STD_NORMAL,  "normal",  vec3d(0,0,0));
+    f_channels.bind<Color>(STD_COLOR,   "color",   Color::WHITE());
+    f_channels.bind<int>  (STD_LABEL,   "label",   -1);
+    f_channels.bind<float>(STD_QUALITY, "quality", 0.f);
+    f_channels.bind<float>(STD_AO,      "AO",      1.f);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void AbstractPolyhedralMesh<M,V,E,F,P>::clear()
@@ -56,6 +71,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::clear()
     polys_face_winding.clear();
     //
     f_data.clear();
+    f_channels.clear();
     //
     v2f.clear();
     e2f.clear();
@@ -67,6 +83,16 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::clear()
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void AbstractPolyhedralMesh<M,V,E,F,P>::face_copy_attributes(const uint dst, const uint src)
+{
+    f_data.at(dst) = f_data.at(src);
+    f_channels.copy(dst, src);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void AbstractPolyhedralMesh<M,V,E,F,P>::init(const std::vector<vec3d>             & verts,
@@ -98,15 +124,25 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::init(const std::vector<vec3d>
     this->p2e.reserve(np);
     this->p2p.reserve(np);
     this->v_data.reserve(nv);
+    this->v_channels.reserve(nv);
     this->e_data.reserve(ne);
+    this->e_channels.reserve(ne);
     this->f_data.reserve(nf);
+    this->f_channels.reserve(nf);
     this->p_data.reserve(np);
+    this->p_channels.reserve(np);
     this->face_triangles.reserve(nf);
     this->polys_face_winding.reserve(np);
 
+    // initialize mesh connectivity, then compute per face
+    // normals and tessellations in parallel, all at once
     for(auto v : verts) vert_add(v);
+    defer_f_updates = true;
     for(auto f : faces) face_add(f);
     for(uint pid=0; pid<polys.size(); ++pid) this->poly_add(polys.at(pid), polys_face_winding.at(pid));
+    defer_f_updates = false;
+    update_f_tessellation();
+    update_f_normals();
     if(this->mesh_data().update_normals) this->update_v_normals();
 
     this->copy_xyz_to_uvw(UVW_param);
@@ -143,11 +179,19 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::init(const std::vector<vec3d>
     this->p2e.reserve(np);
     this->p2p.reserve(np);
     this->v_data.reserve(nv);
+    this->v_channels.reserve(nv);
     this->p_data.reserve(np);
+    this->p_channels.reserve(np);
     this->polys_face_winding.reserve(np);
 
+    // initialize mesh connectivity, then compute per face
+    // normals and tessellations in parallel, all at once
     for(auto v : verts) vert_add(v);
+    defer_f_updates = true;
     for(auto p : polys) poly_add(p);
+    defer_f_updates = false;
+    update_f_tessellation();
+    update_f_normals();
     if(this->mesh_data().update_normals) this->update_v_normals();
 
     this->copy_xyz_to_uvw(UVW_param);
@@ -178,7 +222,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::init(const std::vector<vec3d>
         std::cout << "set vert labels" << std::endl;
         for(uint vid=0; vid<this->num_verts(); ++vid)
         {
-            this->vert_data(vid).label = vert_labels.at(vid);
+            this->vert_label(vid) = vert_labels.at(vid);
         }
     }
 
@@ -187,7 +231,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::init(const std::vector<vec3d>
         std::cout << "set poly labels" << std::endl;
         for(uint pid=0; pid<this->num_polys(); ++pid)
         {
-            this->poly_data(pid).label = poly_labels.at(pid);
+            this->poly_label(pid) = poly_labels.at(pid);
         }
         this->poly_color_wrt_label();
     }
@@ -305,6 +349,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::update_normals()
 {
     update_f_normals();
     update_v_normals();
+    pick_cache_clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -355,10 +400,10 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void AbstractPolyhedralMesh<M,V,E,F,P>::update_f_normals()
 {
-    for(uint fid=0; fid<num_faces(); ++fid)
+    PARALLEL_FOR(0, num_faces(), 1000, [this](uint fid)
     {
         update_f_normal(fid);
-    }
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -368,10 +413,10 @@ CINO_INLINE
 void AbstractPolyhedralMesh<M,V,E,F,P>::update_f_tessellation()
 {
     this->face_triangles.resize(this->num_faces());
-    for(uint fid=0; fid<this->num_faces(); ++fid)
+    PARALLEL_FOR(0, num_faces(), 1000, [this](uint fid)
     {
         update_f_tessellation(fid);
-    }
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -380,25 +425,50 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void AbstractPolyhedralMesh<M,V,E,F,P>::update_f_tessellation(const uint fid)
 {
-    // Assume convexity and try trivial tessellation first. If something flips
-    // apply earcut algorithm to get a valid triangulation
+    // Assume convexity and try trivial tessellation first. If something flips, keep the
+    // current tessellation if it is still valid (e.g. if only vertex positions changed),
+    // otherwise apply earcut algorithm to get a valid triangulation
 
-    std::vector<vec3d> n;
-    for (uint i=2; i<this->verts_per_face(fid); ++i)
-    {
-        uint vid0 = this->faces.at(fid).at( 0 );
-        uint vid1 = this->faces.at(fid).at(i-1);
-        uint vid2 = this->faces.at(fid).at( i );
+    const std::vector<uint> & f    = this->faces.at(fid);
+          std::vector<uint> & tris = face_triangles.at(fid);
+    assert(f.size()>2);
+    uint nt = uint(f.size())-2;
 
-        face_triangles.at(fid).push_back(vid0);
-        face_triangles.at(fid).push_back(vid1);
-        face_triangles.at(fid).push_back(vid2);
+    // the fan normals also sum up to the Newell normal of the face (see Polyhedralmesh::update_f_normal)
+    bool  bad_tessellation = false;
+    vec3d prev_n, newell(0,0,0);
+    for(uint i=2; i<f.size(); ++i)
+    {
+        vec3d n = (this->vert(f.at(i-1))-this->vert(f.at(0))).cross(this->vert(f.at(i))-this->vert(f.at(0)));
+        if(i>2 && prev_n.dot(n)<0) bad_tessellation = true;
+        prev_n  = n;
+        newell += n;
+    }
 
-        n.push_back((this->vert(vid1)-this->vert(vid0)).cross(this->vert(vid2)-this->vert(vid0)));
+    if(bad_tessellation && tris.size()==3*nt)
+    {
+        // the current tessellation is still valid if it is made of vertices of
+        // the face, and all its triangles agree with the face orientation
+        std::vector<uint> sorted_f = f;
+        std::sort(sorted_f.begin(), sorted_f.end());
+        bool valid = true;
+        for(uint vid : tris) if(!std::binary_search(sorted_f.begin(), sorted_f.end(), vid)) valid = false;
+        for(uint i=0; i<nt && valid; ++i)
+        {
+            const vec3d & v0 = this->vert(tris.at(3*i));
+            vec3d n = (this->vert(tris.at(3*i+1))-v0).cross(this->vert(tris.at(3*i+2))-v0);
+            if(n.dot(newell)<0) valid = false;
+        }
+        if(valid) return;
     }
 
-    bool bad_tessellation = false;
-    for(uint i=0; i<n.size()-1; ++i) if (n.at(i).dot(n.at(i+1))<0) bad_tessellation = true;
+    tris.resize(3*nt);
+    for(uint i=2; i<f.size(); ++i)
+    {
+        tris.at(3*(i-2)  ) = f.at( 0 );
+        tris.at(3*(i-2)+1) = f.at(i-1);
+        tris.at(3*(i-2)+2) = f.at( i );
+    }
 
     if(bad_tessellation)
     {
@@ -412,11 +482,11 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::update_f_tessellation(const uint fid)
             vlist.at(i) = this->face_vert(fid,i);
         }
         //
-        std::vector<uint> tris;
-        if(polygon_triangulate(vlist, tris))
+        std::vector<uint> earcut_tris;
+        if(polygon_triangulate(vlist, earcut_tris))
         {
-            face_triangles.at(fid).clear();
-            for(uint off : tris) face_triangles.at(fid).push_back(this->face_vert_id(fid,off));
+            tris.clear();
+            for(uint off : earcut_tris) tris.push_back(this->face_vert_id(fid,off));
         }
     }
 }
@@ -427,10 +497,10 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void AbstractPolyhedralMesh<M,V,E,F,P>::update_v_normals()
 {
-    for(uint vid=0; vid<this->num_verts(); ++vid)
+    PARALLEL_FOR(0, this->num_verts(), 1000, [this](uint vid)
     {
         if(vert_is_on_srf(vid)) update_v_normal(vid);
-    }
+    });
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -441,14 +511,14 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::update_p_quality(const uint pid)
 {
     if(this->poly_is_tetrahedron(pid))
     {
-        this->poly_data(pid).quality = float(tet_scaled_jacobian(this->poly_vert(pid,0),
+        this->poly_quality(pid) = float(tet_scaled_jacobian(this->poly_vert(pid,0),
                                                                  this->poly_vert(pid,1),
                                                                  this->poly_vert(pid,2),
                                                                  this->poly_vert(pid,3)));
     }
     else if(this->poly_is_hexahedron(pid))
     {
-        this->poly_data(pid).quality = float(hex_scaled_jacobian(this->poly_vert(pid,0),
+        this->poly_quality(pid) = float(hex_scaled_jacobian(this->poly_vert(pid,0),
                                                                  this->poly_vert(pid,1),
                                                                  this->poly_vert(pid,2),
                                                                  this->poly_vert(pid,3),
@@ -488,7 +558,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::update_v_normal(const uint vid)
         }
     }
     if (n.norm()>0) n.normalize();
-    this->vert_data(vid).normal = n;
+    this->vert_normal(vid) = n;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -583,7 +653,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::face_apply_labels(const std::vector<int>
     assert(labels.size() == this->num_faces());
     for(uint fid=0; fid<num_faces(); ++fid)
     {
-        face_data(fid).label = labels.at(fid);
+        face_label(fid) = labels.at(fid);
     }
 }
 
@@ -595,7 +665,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::face_apply_label(const int label)
 {
     for(uint fid=0; fid<num_faces(); ++fid)
     {
-        face_data(fid).label = label;
+        face_label(fid) = label;
     }
 }
 
@@ -931,7 +1001,7 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::edge_split(const uint eid, const vec3d &
         VEC_INSERT_AFTER(f, v1, new_vid);
         uint new_fid = this->face_add(f);
         fmap[fid] = new_fid;
-        this->face_data(new_fid) = this->face_data(fid);
+        this->face_copy_attributes(new_fid, fid);
     }
 
     // update the polys incident to eid
@@ -944,7 +1014,7 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::edge_split(const uint eid, const vec3d &
             if(CONTAINS(fmap,fid)) fid = fmap.at(fid);
         }
         uint new_pid = this->poly_add(f,w);
-        this->poly_data(new_pid) = this->poly_data(pid);
+        this->poly_copy_attributes(new_pid, pid);
     }
 
     // remove the old elements
@@ -1017,7 +1087,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::face_set_color(const Color & c)
 {
     for(uint fid=0; fid<num_faces(); ++fid)
     {
-        face_data(fid).color = c;
+        face_color(fid) = c;
     }
 }
 
@@ -1053,7 +1123,7 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::face_set_alpha(const float alpha)
 {
     for(uint fid=0; fid<num_faces(); ++fid)
     {
-        face_data(fid).color.a = alpha;
+        face_color(fid).a = alpha;
     }
 }
 
@@ -1140,8 +1210,8 @@ CINO_INLINE
 vec3d AbstractPolyhedralMesh<M,V,E,F,P>::poly_face_normal(const uint pid, const uint fid) const
 {
     assert(poly_contains_face(pid,fid));
-    if (poly_face_is_CCW(pid,fid)) return this->face_data(fid).normal;
-    return -this->face_data(fid).normal;
+    if (poly_face_is_CCW(pid,fid)) return this->face_normal(fid);
+    return -this->face_normal(fid);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -1978,6 +2048,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::vert_switch_id(const uint vid0, const ui
     std::swap(this->v2f.at(vid0),     this->v2f.at(vid1));
     std::swap(this->v2p.at(vid0),     this->v2p.at(vid1));
     std::swap(this->v_data.at(vid0),  this->v_data.at(vid1));
+    this->v_channels.swap(vid0, vid1);
+    this->pick_cache_clear();
 
     std::unordered_set<uint> verts_to_update;
     verts_to_update.insert(this->adj_v2v(vid0).begin(), this->adj_v2v(vid0).end());
@@ -2060,6 +2132,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::vert_remove_unreferenced(const uint vid)
     vert_switch_id(vid, this->num_verts()-1);
     this->verts.pop_back();
     this->v_data.pop_back();
+    this->v_channels.pop_back();
+    this->pick_cache_clear();
     this->v2v.pop_back();
     this->v2e.pop_back();
     this->v2f.pop_back();
@@ -2078,6 +2152,8 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::vert_add(const vec3d & pos)
     //
     V data;
     this->v_data.push_back(data);
+    this->v_channels.push_back();
+    this->pick_cache_clear();
     assert(this->verts.size() == this->v_data.size());
     //
     this->v2v.push_back(std::vector<uint>());
@@ -2104,6 +2180,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::edge_switch_id(const uint eid0, const ui
     std::swap(this->e2f.at(eid0),     this->e2f.at(eid1));
     std::swap(this->e2p.at(eid0),     this->e2p.at(eid1));
     std::swap(this->e_data.at(eid0),  this->e_data.at(eid1));
+    this->e_channels.swap(eid0, eid1);
+    this->pick_cache_clear();
 
     std::unordered_set<uint> verts_to_update;
     verts_to_update.insert(this->edge_vert_id(eid0,0));
@@ -2169,6 +2247,8 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::edge_add(const uint vid0, const uint vid
     //
     E data;
     this->e_data.push_back(data);
+    this->e_channels.push_back();
+    this->pick_cache_clear();
     assert(this->edges.size()/2 == this->e_data.size());
     //
     this->v2v.at(vid1).push_back(vid0);
@@ -2200,6 +2280,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::edge_remove_unreferenced(const uint eid)
     edge_switch_id(eid, this->num_edges()-1);
     this->edges.resize(this->edges.size()-2);
     this->e_data.pop_back();
+    this->e_channels.pop_back();
+    this->pick_cache_clear();
     this->e2f.pop_back();
     this->e2p.pop_back();
 }
@@ -2216,6 +2298,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::face_switch_id(const uint fid0, const ui
 
     std::swap(this->faces.at(fid0),          this->faces.at(fid1));
     std::swap(this->f_data.at(fid0),         this->f_data.at(fid1));
+    this->f_channels.swap(fid0, fid1);
+    this->pick_cache_clear();
     std::swap(this->f2e.at(fid0),            this->f2e.at(fid1));
     std::swap(this->f2f.at(fid0),            this->f2f.at(fid1));
     std::swap(this->f2p.at(fid0),            this->f2p.at(fid1));
@@ -2294,6 +2378,8 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::face_add(const std::vector<uint> & f)
 
     F data;
     this->f_data.push_back(data);
+    this->f_channels.push_back();
+    this->pick_cache_clear();
     assert(this->faces.size() == this->f_data.size());
 
     this->f2e.push_back(std::vector<uint>());
@@ -2334,9 +2420,12 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::face_add(const std::vector<uint> & f)
         this->f2e.at(fid).push_back(eid);
     }
 
-    this->update_f_normal(fid);
     this->face_triangles.push_back(std::vector<uint>());
-    update_f_tessellation(fid);
+    if(!defer_f_updates)
+    {
+        this->update_f_normal(fid);
+        update_f_tessellation(fid);
+    }
 
     return fid;
 }
@@ -2364,6 +2453,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::face_remove_unreferenced(const uint fid)
     face_switch_id(fid, this->num_faces()-1);
     this->faces.pop_back();
     this->f_data.pop_back();
+    this->f_channels.pop_back();
+    this->pick_cache_clear();
     this->f2e.pop_back();
     this->f2f.pop_back();
     this->f2p.pop_back();
@@ -2380,6 +2471,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::poly_switch_id(const uint pid0, const ui
 
     std::swap(this->polys.at(pid0),              this->polys.at(pid1));
     std::swap(this->p_data.at(pid0),             this->p_data.at(pid1));
+    this->p_channels.swap(pid0, pid1);
+    this->pick_cache_clear();
     std::swap(this->p2v.at(pid0),                this->p2v.at(pid1));
     std::swap(this->p2e.at(pid0),                this->p2e.at(pid1));
     std::swap(this->p2p.at(pid0),                this->p2p.at(pid1));
@@ -2461,6 +2554,8 @@ uint AbstractPolyhedralMesh<M,V,E,F,P>::poly_add(const std::vector<uint> & flist
 
     P data;
     this->p_data.push_back(data);
+    this->p_channels.push_back();
+    this->pick_cache_clear();
     assert(this->polys.size() == this->p_data.size());
 
     this->p2v.push_back(std::vector<uint>());
@@ -2772,6 +2867,8 @@ void AbstractPolyhedralMesh<M,V,E,F,P>::poly_remove_unreferenced(const uint pid)
     poly_switch_id(pid, this->num_polys()-1);
     this->polys.pop_back();
     this->p_data.pop_back();
+    this->p_channels.pop_back();
+    this->pick_cache_clear();
     this->p2v.pop_back();
     this->p2e.pop_back();
     this->p2p.pop_back();
@@ -3095,15 +3192,32 @@ std::vector<bool> AbstractPolyhedralMesh<M,V,E,F,P>::poly_faces_winding(const ui
 
 template<class M, class V, class E, class F, class P>
 CINO_INLINE
-uint AbstractPolyhedralMesh<M,V,E,F,P>::pick_face(const vec3d & p) const
+uint AbstractPolyhedralMesh<M,V,E,F,P>::pick_face(const vec3d & p)
 {
-    std::vector<std::pair<double,uint>> closest;
-    for(uint fid=0; fid<this->num_faces(); ++fid)
+    if(pick_f_tree.size()!=this->num_faces())
     {
-        if(!this->face_data(fid).flags[HIDDEN]) closest.push_back(std::make_pair(this->face_centroid(fid).dist(p),fid));
+        std::vector<vec3d> points(this->num_faces());
+        PARALLEL_FOR(0, this->num_faces(), 1000, [&](uint fid)
+        {
+            points[fid] = this->face_centroid(fid);
+        });
+        pick_f_tree.build(points);
     }
-    std::sort(closest.begin(), closest.end());
-    return closest.front().second;
+
+    uint   fid;
+    double dist;
+    if(!pick_f_tree.closest_point(p, [this](const uint fid){ return !this->face_data(fid).flags[HIDDEN]; }, fid, dist)) return 0;
+    return fid;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void AbstractPolyhedralMesh<M,V,E,F,P>::pick_cache_clear()
+{
+    AbstractMesh<M,V,E,P>::pick_cache_clear();
+    pick_f_tree.clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -57,6 +57,10 @@ class AbstractPolyhedralMesh : public AbstractMesh<M,V,E,P>
 
         std::vector<F> f_data;
 
+        AttributeChannels f_channels; // standard and on demand attributes (see attribute_channels.h)
+
+        PointKdTree pick_f_tree; // lazily built index for mouse picking
+
         std::vector<std::vector<uint>> v2f; // vert to face adjacency
         std::vector<std::vector<uint>> e2f; // edge to face adjacency
         std::vector<std::vector<uint>> f2e; // face to edge adjacency
@@ -66,11 +70,13 @@ class AbstractPolyhedralMesh : public AbstractMesh<M,V,E,P>
 
         std::vector<std::vector<uint>> face_triangles; // per face serialized triangulation (e.g., for rendering)
 
+        bool defer_f_updates = false; // if true, face_add does not compute normals and tessellations (see init)
+
     public:
 
         typedef F F_type;
 
-        explicit AbstractPolyhedralMesh() : AbstractMesh<M,V,E,P>() {}
+        explicit AbstractPolyhedralMesh();
         ~AbstractPolyhedralMesh() {}
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -169,10 +175,28 @@ class AbstractPolyhedralMesh : public AbstractMesh<M,V,E,P>
         const F & face_data(const uint fid) const { return f_data.at(fid); }
               F & face_data(const uint fid)       { return f_data.at(fid); }
 
+        const AttributeChannels & face_channels() const { return f_channels; }
+              AttributeChannels & face_channels()       { return f_channels; }
+
+        // standard attributes, one dense channel each (see mesh_attributes.h)
+        const vec3d & face_normal (const uint fid) const { return f_channels.slot<vec3d>(STD_NORMAL ).at(fid); }
+              vec3d & face_normal (const uint fid)       { return f_channels.slot<vec3d>(STD_NORMAL ).at(fid); }
+        const Color & face_color  (const uint fid) const { return f_channels.slot<Color>(STD_COLOR  ).at(fid); }
+              Color & face_color  (const uint fid)       { return f_channels.slot<Color>(STD_COLOR  ).at(fid); }
+        const int   & face_label  (const uint fid) const { return f_channels.slot<int>  (STD_LABEL  ).at(fid); }
+              int   & face_label  (const uint fid)       { return f_channels.slot<int>  (STD_LABEL  ).at(fid); }
+        const float & face_quality(const uint fid) const { return f_channels.slot<float>(STD_QUALITY).at(fid); }
+              float & face_quality(const uint fid)       { return f_channels.slot<float>(STD_QUALITY).at(fid); }
+        const float & face_AO     (const uint fid) const { return f_channels.slot<float>(STD_AO     ).at(fid); }
+              float & face_AO     (const uint fid)       { return f_channels.slot<float>(STD_AO     ).at(fid); }
+
+        void face_copy_attributes(const uint dst, const uint src); // per element struct and channels
+
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        // useful for GUIs with mouse picking
-        uint pick_face(const vec3d & p) const;
+        // useful for GUIs with mouse picking (see AbstractMesh::pick_vert)
+        uint pick_face(const vec3d & p);
+        void pick_cache_clear() override;
 
         //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
@@ -0,0 +1,364 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/meshes/attribute_channels.h>
+#include <cassert>
+#include <iostream>
+
+namespace cinolib
+{
+
+CINO_INLINE
+AttributeChannels::AttributeChannels(const AttributeChannels & c)
+{
+    *this = c;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+AttributeChannels & AttributeChannels::operator=(const AttributeChannels & c)
+{
+    if(this==&c) return *this;
+    channels.clear();
+    for(const auto & obj : c.channels) channels[obj.first].reset(obj.second->clone());
+    slot_names = c.slot_names;
+    slots.resize(slot_names.size());
+    for(uint s=0; s<slots.size(); ++s)
+    {
+        slots[s] = slot_names[s].empty() ? nullptr : channels.at(slot_names[s]).get();
+    }
+    n = c.n;
+    return *this;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::remove(const std::string & name)
+{
+    for(const std::string & s : slot_names)
+    {
+        if(s==name)
+        {
+            std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : AttributeChannels : channel " << name << " is bound, and cannot be removed" << std::endl;
+            exit(-1);
+        }
+    }
+    channels.erase(name);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// drops all the channels, except the bound ones, which are emptied
+CINO_INLINE
+void AttributeChannels::clear()
+{
+    for(auto it=channels.begin(); it!=channels.end();)
+    {
+        bool bound = false;
+        for(const ChannelBase *c : slots) if(c==it->second.get()) bound = true;
+        if(bound)
+        {
+            it->second->resize(0);
+            ++it;
+        }
+        else it = channels.erase(it);
+    }
+    n = 0;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+std::vector<T> & AttributeChannels::add(const std::string & name, const T & default_value)
+{
+    auto it = channels.find(name);
+    if(it!=channels.end()) return get<T>(name);
+
+    Channel<T> *c = new Channel<T>();
+    c->def = default_value;
+    c->data.resize(n, default_value);
+    channels[name].reset(c);
+    return c->data;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+std::vector<T> & AttributeChannels::bind(const uint s, const std::string & name, const T & default_value)
+{
+    std::vector<T> & data = add<T>(name, default_value);
+    if(s>=slots.size())
+    {
+        slots.resize(s+1, nullptr);
+        slot_names.resize(s+1);
+    }
+    slots[s]      = channel<T>(name);
+    slot_names[s] = name;
+    return data;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+const std::vector<T> & AttributeChannels::slot(const uint s) const
+{
+    assert(s<slots.size() && dynamic_cast<const Channel<T>*>(slots[s])!=nullptr);
+    return static_cast<const Channel<T>*>(slots[s])->data;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+std::vector<T> & AttributeChannels::slot(const uint s)
+{
+    assert(s<slots.size() && dynamic_cast<Channel<T>*>(slots[s])!=nullptr);
+    return static_cast<Channel<T>*>(slots[s])->data;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+const std::vector<T> & AttributeChannels::get(const std::string & name) const
+{
+    return channel<T>(name)->data;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+std::vector<T> & AttributeChannels::get(const std::string & name)
+{
+    return channel<T>(name)->data;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+bool AttributeChannels::has(const std::string & name) const
+{
+    auto it = channels.find(name);
+    return it!=channels.end() && dynamic_cast<const Channel<T>*>(it->second.get())!=nullptr;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+std::vector<std::string> AttributeChannels::names() const
+{
+    std::vector<std::string> res;
+    for(const auto & obj : channels) res.push_back(obj.first);
+    return res;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+AttributeChannels AttributeChannels::item(const uint i) const
+{
+    assert(i<n);
+    AttributeChannels res;
+    for(const auto & obj : channels) res.channels[obj.first].reset(obj.second->clone_item(i));
+    res.n = 1;
+    return res;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::reserve(const size_t size)
+{
+    for(auto & obj : channels) obj.second->reserve(size);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::resize(const size_t size)
+{
+    for(auto & obj : channels) obj.second->resize(size);
+    n = size;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::push_back()
+{
+    for(auto & obj : channels) obj.second->push_back();
+    ++n;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::pop_back()
+{
+    assert(n>0);
+    for(auto & obj : channels) obj.second->pop_back();
+    --n;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::swap(const uint i, const uint j)
+{
+    assert(i<n && j<n);
+    for(auto & obj : channels) obj.second->swap(i,j);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::copy(const uint dst, const uint src)
+{
+    assert(dst<n && src<n);
+    for(auto & obj : channels) obj.second->copy(dst, obj.second.get(), src);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::copy(const uint dst, const AttributeChannels & c, const uint src)
+{
+    assert(dst<n && src<c.n);
+    for(auto & obj : channels)
+    {
+        auto it = c.channels.find(obj.first);
+        if(it!=c.channels.end()) obj.second->copy(dst, it->second.get(), src);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void AttributeChannels::append(const AttributeChannels & c)
+{
+    for(auto & obj : channels)
+    {
+        auto it = c.channels.find(obj.first);
+        obj.second->append((it!=c.channels.end()) ? it->second.get() : nullptr, c.n);
+    }
+    n += c.n;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void AttributeChannels::Channel<T>::swap(const uint i, const uint j)
+{
+    // not std::swap, which does not work on std::vector<bool>
+    T tmp   = data[i];
+    data[i] = data[j];
+    data[j] = tmp;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+AttributeChannels::ChannelBase * AttributeChannels::Channel<T>::clone_item(const uint i) const
+{
+    Channel<T> *c = new Channel<T>();
+    c->def = def;
+    c->data.push_back(data[i]);
+    return c;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void AttributeChannels::Channel<T>::copy(const uint dst, const ChannelBase * c, const uint src)
+{
+    // channels holding a different type in the source are left untouched
+    const Channel<T> *ch = dynamic_cast<const Channel<T>*>(c);
+    if(ch!=nullptr) data[dst] = ch->data[src];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void AttributeChannels::Channel<T>::append(const ChannelBase * c, const size_t size)
+{
+    // channels that do not exist (or hold a different type) in the
+    // source are filled with the default value
+    const Channel<T> *src = dynamic_cast<const Channel<T>*>(c);
+    if(src!=nullptr) data.insert(data.end(), src->data.begin(), src->data.end());
+    else             data.resize(data.size()+size, def);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+AttributeChannels::Channel<T> * AttributeChannels::channel(const std::string & name)
+{
+    return const_cast<Channel<T>*>(static_cast<const AttributeChannels*>(this)->channel<T>(name));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+const AttributeChannels::Channel<T> * AttributeChannels::channel(const std::string & name) const
+{
+    auto it = channels.find(name);
+    if(it==channels.end())
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : AttributeChannels : channel " << name << " does not exist" << std::endl;
+        exit(-1);
+    }
+    const Channel<T> *c = dynamic_cast<const Channel<T>*>(it->second.get());
+    if(c==nullptr)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : AttributeChannels : channel " << name << " holds a different type" << std::endl;
+        exit(-1);
+    }
+    return c;
+}
+
+}
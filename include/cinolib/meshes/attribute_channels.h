@@ -0,0 +1,171 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_ATTRIBUTE_CHANNELS_H
+#define CINO_ATTRIBUTE_CHANNELS_H
+
+#include <cinolib/cino_inline.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Named, typed per element attributes stored as a structure of arrays. Each
+ * channel is a contiguous std::vector with one item per mesh element, which is
+ * allocated only when requested, and is kept in sync with the mesh by all the
+ * operations that add, remove or switch elements. This complements the
+ * per element structs (see mesh_attributes.h): custom data can be attached to
+ * a mesh without re-templating it, and loops over a channel stream through a
+ * dense array. Example:
+ *
+ *    Trimesh<> m("bunny.obj");
+ *    auto & curv = m.vert_channels().add<double>("curvature");
+ *    for(uint vid=0; vid<m.num_verts(); ++vid) curv[vid] = ...;
+ *    m.vert_add(vec3d(0,0,0)); // curv grows by one item (0.0, the default)
+ *
+ * Channels can also be bound to a slot (a small integer id) and accessed through
+ * it, without looking up their name. Meshes store the standard attributes
+ * (normals, colors, uvw, labels, quality) this way, and expose them through
+ * accessors such as vert_normal(vid) or poly_label(pid) (see mesh_attributes.h).
+ * Bound channels cannot be removed, and clear() only empties them.
+ *
+ * NOTE: references to channels are invalidated by mesh operations that change
+ * the number of elements, exactly as references to std::vector items are.
+*/
+
+class AttributeChannels
+{
+    public:
+
+        AttributeChannels() {}
+        AttributeChannels(const AttributeChannels & c);
+        AttributeChannels & operator=(const AttributeChannels & c);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // creates a channel (or returns it, if it already exists). Newly
+        // created elements will be initialized with default_value
+        template<class T>
+        std::vector<T> & add(const std::string & name, const T & default_value = T());
+
+        template<class T> const std::vector<T> & get(const std::string & name) const;
+        template<class T>       std::vector<T> & get(const std::string & name);
+
+        template<class T>
+        bool has(const std::string & name) const; // exists, and holds items of type T
+
+        bool has   (const std::string & name) const { return channels.count(name)>0; }
+        void remove(const std::string & name);
+        void clear ();
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // creates a channel (as add) and binds it to slot s
+        template<class T>
+        std::vector<T> & bind(const uint s, const std::string & name, const T & default_value = T());
+
+        template<class T> const std::vector<T> & slot(const uint s) const;
+        template<class T>       std::vector<T> & slot(const uint s);
+
+        std::vector<std::string> names() const;
+        uint                     size()  const { return uint(n); } // items per channel
+
+        // copy of item i only, e.g. to restore it (see copy) after the element is removed
+        AttributeChannels item(const uint i) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // called by the mesh to keep channels in sync with the elements
+        void reserve  (const size_t size);
+        void resize   (const size_t size);
+        void push_back();
+        void pop_back ();
+        void swap     (const uint i, const uint j);
+        void copy     (const uint dst, const uint src);                               // item src => item dst
+        void copy     (const uint dst, const AttributeChannels & c, const uint src); // item src of c => item dst (channels with same name and type)
+        void append   (const AttributeChannels & c);                                  // items of c for the channels with same name and type
+
+    protected:
+
+        struct ChannelBase
+        {
+            virtual ~ChannelBase() {}
+            virtual ChannelBase * clone() const = 0;
+            virtual ChannelBase * clone_item(const uint i) const = 0;
+            virtual void reserve  (const size_t size) = 0;
+            virtual void resize   (const size_t size) = 0;
+            virtual void push_back() = 0;
+            virtual void pop_back () = 0;
+            virtual void swap     (const uint i, const uint j) = 0;
+            virtual void copy     (const uint dst, const ChannelBase * c, const uint src) = 0;
+            virtual void append   (const ChannelBase * c, const size_t size) = 0;
+        };
+
+        template<class T>
+        struct Channel : public ChannelBase
+        {
+            std::vector<T> data;
+            T              def;
+
+            ChannelBase * clone() const override { return new Channel<T>(*this); }
+            ChannelBase * clone_item(const uint i) const override;
+            void reserve  (const size_t size) override { data.reserve(size);     }
+            void resize   (const size_t size) override { data.resize(size, def); }
+            void push_back() override { data.push_back(def); }
+            void pop_back () override { data.pop_back();     }
+            void swap     (const uint i, const uint j) override;
+            void copy     (const uint dst, const ChannelBase * c, const uint src) override;
+            void append   (const ChannelBase * c, const size_t size) override;
+        };
+
+        template<class T>       Channel<T> * channel(const std::string & name);
+        template<class T> const Channel<T> * channel(const std::string & name) const;
+
+        std::map<std::string,std::unique_ptr<ChannelBase>> channels;
+        std::vector<std::string>                           slot_names; // bound channels
+        std::vector<ChannelBase*>                          slots;      // (owned by channels)
+        size_t n = 0;
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "attribute_channels.cpp"
+#endif
+
+#endif // CINO_ATTRIBUTE_CHANNELS_H
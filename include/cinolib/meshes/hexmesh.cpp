@@ -188,7 +188,7 @@ void Hexmesh<M,V,E,F,P>::update_f_normal(const uint fid)
     vec3d v = v2 - v0;     if(!v.is_deg()) v.normalize();
     vec3d n = u.cross(v);  if(!n.is_deg()) n.normalize();
 
-    this->face_data(fid).normal = n;
+    this->face_normal(fid) = n;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -205,7 +205,7 @@ void Hexmesh<M,V,E,F,P>::print_quality(const bool list_folded_elements)
 
     for(uint pid=0; pid<this->num_polys(); ++pid)
     {
-        double q = this->poly_data(pid).quality;
+        double q = this->poly_quality(pid);
 
         asj += q;
         msj = std::min(msj, q);
@@ -465,7 +465,7 @@ bool Hexmesh<M,V,E,F,P>::poly_fix_orientation()
         {
             this->poly_reorder_p2v(pid);
             this->update_p_quality(pid);
-            if(this->poly_data(pid).quality < 0.0) ++bad;
+            if(this->poly_quality(pid) < 0.0) ++bad;
         }
         if(bad > 0.5*this->num_polys())
         {
@@ -68,6 +68,18 @@ namespace cinolib
  * Tetmesh<M,V,E,F,P>        my_tetmesh;
  * Hexmesh<M,V,E,F,P>        my_hexmesh;
  * Polyhedralmesh<M,V,E,F,P> my_hexmesh;
+ *
+ * Alternatively, attributes can be attached to an existing mesh at run time,
+ * without changing its type, as named channels stored in separate arrays (see
+ * attribute_channels.h and AbstractMesh::vert_channels() and alike)
+ *
+ * NOTE: the standard attributes (normals, colors, uvw, labels, quality and
+ * ambient occlusion) are NOT part of the structures below. They are channels
+ * (one dense array per attribute), bound to the slots listed in STD_CHANNELS,
+ * and are accessed with m.vert_normal(vid), m.poly_color(pid), m.edge_label(eid),
+ * m.face_AO(fid) and alike. This way loops over one attribute stream through a
+ * contiguous array, without loading the others. The structures only keep the
+ * per element flags (plus whatever custom field is added by extending them)
 */
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -122,6 +134,29 @@ enum
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+// slots of the standard attribute channels (see AttributeChannels::bind). Each
+// element kind binds only the ones it has:
+//
+//    verts  => normal, color (white), uvw, label, quality
+//    edges  => color (black), label
+//    polys  => normal, color (white), label, quality, AO (polygons)
+//              color (white), label, quality          (polyhedra)
+//    faces  => normal, color (white), label, quality, AO
+//
+// labels default to -1, AO to 1, anything else to zero
+//
+enum STD_CHANNELS
+{
+    STD_NORMAL,  // "normal"  (vec3d)
+    STD_COLOR,   // "color"   (Color)
+    STD_UVW,     // "uvw"     (vec3d)
+    STD_LABEL,   // "label"   (int)
+    STD_QUALITY, // "quality" (float)
+    STD_AO       // "AO"      (float)
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 struct Mesh_std_attributes
 {
     std::string filename;
@@ -133,20 +168,13 @@ struct Mesh_std_attributes
 
 struct Vert_std_attributes
 {
-    vec3d          normal  = vec3d(0,0,0);
-    Color          color   = Color::WHITE();
-    vec3d          uvw     = vec3d(0,0,0);
-    int            label   = -1;
-    float          quality = 0.0;
-    std::bitset<8> flags   = 0x00;
+    std::bitset<8> flags = 0x00;
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 struct Edge_std_attributes
 {
-    Color          color = Color::BLACK();
-    int            label = -1;
     std::bitset<8> flags = 0x00;
 };
 
@@ -154,22 +182,14 @@ struct Edge_std_attributes
 
 struct Polygon_std_attributes
 {
-    vec3d          normal  = vec3d(0,0,0);
-    Color          color   = Color::WHITE();
-    int            label   = -1;
-    float          quality = 0.0;
-    float          AO      = 1.0;
-    std::bitset<8> flags   = 0x00;
+    std::bitset<8> flags = 0x00;
 };
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
 struct Polyhedron_std_attributes
 {
-    Color          color   = Color::WHITE();
-    int            label   = -1;
-    float          quality = 0.0;
-    std::bitset<8> flags   = 0x00;
+    std::bitset<8> flags = 0x00;
 };
 
 }
@@ -107,8 +107,8 @@ void MeshSlicer::slice(AbstractMesh<M,V,E,P> & m)
     for(uint pid=0; pid<m.num_polys(); ++pid)
     {
         vec3d c = m.poly_centroid(pid);
-        float q = m.poly_data(pid).quality;
-        int   l = m.poly_data(pid).label;
+        float q = m.poly_quality(pid);
+        int   l = m.poly_label(pid);
 
         bool pass_X = (X_leq) ? (c.x() <= X_abs_thresh) : (c.x() >= X_abs_thresh);
         bool pass_Y = (Y_leq) ? (c.y() <= Y_abs_thresh) : (c.y() >= Y_abs_thresh);
@@ -166,9 +166,15 @@ CINO_INLINE
 void Polyhedralmesh<M,V,E,F,P>::update_f_normal(const uint fid)
 {
     assert(this->verts_per_face(fid)>2);
-    std::vector<vec3d> points;
-    for(uint off=0; off<this->verts_per_face(fid); ++off) points.push_back(this->face_vert(fid,off));
-    this->face_data(fid).normal = polygon_normal(points);
+    // Newell's method (see AbstractPolygonMesh::update_p_normal)
+    const vec3d & v0 = this->face_vert(fid,0);
+    vec3d n(0,0,0);
+    for(uint off=2; off<this->verts_per_face(fid); ++off)
+    {
+        n += (this->face_vert(fid,off-1)-v0).cross(this->face_vert(fid,off)-v0);
+    }
+    if(n.norm()>0) n.normalize();
+    this->face_normal(fid) = n;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -201,7 +201,7 @@ void Tetmesh<M,V,E,F,P>::update_f_normal(const uint fid)
     vec3d n = u.cross(v);
     n.normalize();
 
-    this->face_data(fid).normal = n;
+    this->face_normal(fid) = n;
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -245,7 +245,7 @@ uint Tetmesh<M,V,E,F,P>::edge_split(const uint eid, const uint split_point)
             };
             if(this->poly_face_is_CCW(pid,fid)) std::swap(tet[1],tet[2]);
             uint new_pid = this->poly_add(tet);
-            this->poly_data(new_pid) = this->poly_data(pid);
+            this->poly_copy_attributes(new_pid, pid);
         }
     }
 
@@ -254,15 +254,15 @@ uint Tetmesh<M,V,E,F,P>::edge_split(const uint eid, const uint split_point)
     uint vid1 = this->edge_vert_id(eid,1);
     int  e0   = this->edge_id(vid0, split_point); assert(e0>=0);
     int  e1   = this->edge_id(vid1, split_point); assert(e1>=0);
-    this->edge_data(e0) = this->edge_data(eid);
-    this->edge_data(e1) = this->edge_data(eid);
+    this->edge_copy_attributes(e0, eid);
+    this->edge_copy_attributes(e1, eid);
     for(uint fid : this->adj_e2f(eid))
     {
         uint vopp = this->face_vert_opposite_to(fid,eid);
          int f0   = this->face_id({vid0,split_point,vopp}); assert(f0>=0);
          int f1   = this->face_id({vid1,split_point,vopp}); assert(f1>=0);
-         this->face_data(f0) = this->face_data(fid);
-         this->face_data(f1) = this->face_data(fid);
+         this->face_copy_attributes(f0, fid);
+         this->face_copy_attributes(f1, fid);
     }
 
     if(this->mesh_data().update_normals && this->vert_is_on_srf(split_point)) this->update_v_normal(split_point);
@@ -429,7 +429,7 @@ int Tetmesh<M,V,E,F,P>::edge_collapse(const uint eid, const vec3d & p, const dou
         auto vlist = this->poly_verts_id(pid);
         vlist.at(off) = vert_to_keep;
         uint new_pid = this->poly_add(vlist);
-        this->poly_data(new_pid) = this->poly_data(pid);
+        this->poly_copy_attributes(new_pid, pid);
 
         if(this->mesh_data().update_normals)
         {
@@ -666,7 +666,7 @@ uint Tetmesh<M,V,E,F,P>::face_split(const uint fid, const vec3d & p)
             bool flip_face = this->poly_face_is_CW(pid,fid);
             if(flip_face) std::swap(tet[1],tet[2]);
             uint new_pid = this->poly_add(tet);
-            this->poly_data(new_pid) = this->poly_data(pid);
+            this->poly_copy_attributes(new_pid, pid);
         }
     }
 
@@ -1056,7 +1056,7 @@ uint Tetmesh<M,V,E,F,P>::poly_split(const uint pid, const uint vid)
         };
         if(this->poly_face_is_CCW(pid,fid)) std::swap(tet[1],tet[2]);
         uint new_pid = this->poly_add(tet);
-        this->poly_data(new_pid) = this->poly_data(pid);
+        this->poly_copy_attributes(new_pid, pid);
         this->update_p_quality(new_pid);
     }
 
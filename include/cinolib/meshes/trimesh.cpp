@@ -100,7 +100,7 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void Trimesh<M,V,E,P>::update_p_normal(const uint pid)
 {
-    this->poly_data(pid).normal = triangle_normal(this->poly_vert(pid,0),
+    this->poly_normal(pid) = triangle_normal(this->poly_vert(pid,0),
                                                   this->poly_vert(pid,1),
                                                   this->poly_vert(pid,2));
 }
@@ -196,7 +196,7 @@ bool Trimesh<M,V,E,P>::edge_is_geometrically_collapsible(const uint eid, const d
         // avoid tiny triangles
         if(triangle_area(v[0], v[1], v[2]) < 1e-10) return false;
         // avoid flips and collapses
-        if(triangle_normal(v[0], v[1], v[2]).dot(this->poly_data(pid).normal) <= 0) return false;
+        if(triangle_normal(v[0], v[1], v[2]).dot(this->poly_normal(pid)) <= 0) return false;
     }
 
     return true;
@@ -250,7 +250,7 @@ uint Trimesh<M,V,E,P>::vert_split(const uint eid0, const uint eid1)
         auto v_list = this->poly_verts_id(pid);
         for(uint & v : v_list) if(v==v0) v = v1;
         uint new_pid = this->poly_add(v_list);
-        this->poly_data(new_pid) = this->poly_data(pid);
+        this->poly_copy_attributes(new_pid, pid);
         if(this->mesh_data().update_normals) this->update_p_normal(new_pid);
     }
     if(this->mesh_data().update_normals) this->update_v_normal(v0);
@@ -299,7 +299,7 @@ int Trimesh<M,V,E,P>::edge_collapse(const uint eid, const double lambda, const b
         vlist.at(off) = vert_to_keep;
         uint new_pid = this->poly_add(vlist);
 
-        this->poly_data(new_pid) = this->poly_data(pid);
+        this->poly_copy_attributes(new_pid, pid);
         if(this->mesh_data().update_normals) this->update_p_normal(new_pid);
     }
     if(this->mesh_data().update_normals) this->update_v_normal(vert_to_keep);
@@ -352,8 +352,8 @@ uint Trimesh<M,V,E,P>::edge_split(const uint eid, const uint v_split)
         if (this->poly_verts_are_CCW(pid, vid0, vid1)) std::swap(vid0, vid1);
         uint new_pid1 = this->poly_add(v_opp, vid0, v_split);
         uint new_pid2 = this->poly_add(v_opp, v_split, vid1);
-        this->poly_data(new_pid1) = this->poly_data(pid);
-        this->poly_data(new_pid2) = this->poly_data(pid);
+        this->poly_copy_attributes(new_pid1, pid);
+        this->poly_copy_attributes(new_pid2, pid);
         if(this->mesh_data().update_normals) this->update_p_normal(new_pid1);
         if(this->mesh_data().update_normals) this->update_p_normal(new_pid2);
     }
@@ -362,8 +362,8 @@ uint Trimesh<M,V,E,P>::edge_split(const uint eid, const uint v_split)
     // copy edge data
     int eid0 = this->edge_id(vid0,v_split); assert(eid0>=0);
     int eid1 = this->edge_id(vid1,v_split); assert(eid1>=0);
-    this->edge_data(eid0) = this->edge_data(eid);
-    this->edge_data(eid1) = this->edge_data(eid);
+    this->edge_copy_attributes(eid0, eid);
+    this->edge_copy_attributes(eid1, eid);
 
     this->polys_remove(this->adj_e2p(eid));
     return v_split;
@@ -387,8 +387,8 @@ bool Trimesh<M,V,E,P>::edge_is_flippable(const uint eid)
     uint  opp0 = this->vert_opposite_to(pid0,vid0,vid1);
     uint  opp1 = this->vert_opposite_to(pid1,vid0,vid1);
     if(!this->poly_verts_are_CCW(pid0, vid1, vid0)) std::swap(vid0,vid1);
-    vec3d n0   = this->poly_data(pid0).normal;
-    vec3d n1   = this->poly_data(pid1).normal;
+    vec3d n0   = this->poly_normal(pid0);
+    vec3d n1   = this->poly_normal(pid1);
     if(triangle_area(this->vert(opp0),this->vert(vid0),this->vert(opp1))<1e-5) return false;
     if(triangle_area(this->vert(opp1),this->vert(vid1),this->vert(opp0))<1e-5) return false;
     vec3d n2   = triangle_normal(this->vert(opp0),this->vert(vid0),this->vert(opp1));
@@ -453,7 +453,7 @@ int Trimesh<M,V,E,P>::edge_flip(const uint eid, const bool geometric_check)
 
     // copy edge data
     int new_eid = this->edge_id(opp0,opp1); assert(new_eid>=0);
-    this->edge_data(new_eid) = this->edge_data(eid);
+    this->edge_copy_attributes(new_eid, eid);
 
     return new_eid;
 }
@@ -515,9 +515,9 @@ uint Trimesh<M,V,E,P>::poly_split(const uint pid, const vec3d & p)
         this->vert_add(p)
     };
     uint new_pid;
-    new_pid = poly_add(vids[0], vids[1], vids[3]); this->poly_data(new_pid) = this->poly_data(pid);
-    new_pid = poly_add(vids[1], vids[2], vids[3]); this->poly_data(new_pid) = this->poly_data(pid);
-    new_pid = poly_add(vids[2], vids[0], vids[3]); this->poly_data(new_pid) = this->poly_data(pid);
+    new_pid = poly_add(vids[0], vids[1], vids[3]); this->poly_copy_attributes(new_pid, pid);
+    new_pid = poly_add(vids[1], vids[2], vids[3]); this->poly_copy_attributes(new_pid, pid);
+    new_pid = poly_add(vids[2], vids[0], vids[3]); this->poly_copy_attributes(new_pid, pid);
     this->poly_remove(pid);
     return vids[3];
 }
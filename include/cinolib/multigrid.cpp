@@ -0,0 +1,473 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/multigrid.h>
+#include <cinolib/parallel_for.h>
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+namespace cinolib
+{
+
+CINO_INLINE
+void MultigridPCG::compute(const Eigen::SparseMatrix<double> & A)
+{
+    const uint max_coarse_size = 300;  // stop coarsening below this size
+    const uint max_dense_size  = 1000; // coarsest matrices up to this size are inverted densely
+    const uint max_levels      = 30;
+
+    levels.clear();
+    status = Eigen::InvalidInput;
+    if(A.rows()!=A.cols() || A.rows()==0) return;
+
+    // negative (semi) definite matrices are solved as -A*x = -b
+    sign = (A.diagonal().sum()<0) ? -1.0 : 1.0;
+
+    levels.emplace_back();
+    levels.back().A = A; // change of storage order: A is copied anyway
+    levels.back().A.makeCompressed();
+    if(sign<0) levels.back().A.coeffs() *= -1.0;
+
+    while(true)
+    {
+        Level & L = levels.back();
+        uint n = L.A.rows();
+
+        L.inv_diag.resize(n);
+        for(uint i=0; i<n; ++i)
+        {
+            double diag = L.A.coeff(i,i);
+            if(diag<=0)
+            {
+                std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : non positive diagonal entry. Matrix is not (semi) definite" << std::endl;
+                levels.clear();
+                status = Eigen::NumericalIssue;
+                return;
+            }
+            L.inv_diag[i] = 1.0/diag;
+        }
+        L.x.resize(n);
+        L.b.resize(n);
+        L.r.resize(n);
+        L.d.resize(n);
+
+        // largest eigenvalue of D^-1*A (a few power iterations, plus a safety margin)
+        L.b = Eigen::VectorXd::LinSpaced(n, 1.0, 2.0);
+        double lambda = 0;
+        for(uint k=0; k<10; ++k)
+        {
+            multiply(L.A, L.b, L.x);
+            L.x = L.inv_diag.cwiseProduct(L.x);
+            lambda = L.x.norm()/L.b.norm();
+            L.b = L.x/L.x.norm();
+        }
+        L.lambda_max = 1.1*lambda;
+
+        if(n<=max_coarse_size || levels.size()==max_levels) break;
+
+        std::vector<int> agg;
+        uint n_agg;
+        aggregate(L.A, agg, n_agg);
+        if(n_agg==0 || n_agg>0.9*n) break; // coarsening stalled
+
+        // tentative prolongation (piecewise constant over aggregates, normalized
+        // columns), smoothed with one damped Jacobi step: P = (I - w*D^-1*A)*P0,
+        // with w = 4/(3*lambda_max)
+        std::vector<double> agg_size(n_agg,0);
+        for(int a : agg) if(a>=0) agg_size.at(a) += 1;
+        std::vector<Eigen::Triplet<double>> entries;
+        for(uint i=0; i<n; ++i)
+        {
+            if(agg.at(i)>=0) entries.emplace_back(i, agg.at(i), 1.0/std::sqrt(agg_size.at(agg.at(i))));
+        }
+        RowMatrix P0(n, n_agg);
+        P0.setFromTriplets(entries.begin(), entries.end());
+        Eigen::VectorXd w_inv_diag = (4.0/(3.0*L.lambda_max)) * L.inv_diag;
+        L.P = P0 - w_inv_diag.asDiagonal() * RowMatrix(L.A * P0);
+        L.P.prune(0.0);
+
+        RowMatrix Ac;
+        galerkin(L.A, L.P, agg, Ac); // coarse operator
+        levels.emplace_back(); // invalidates L
+        levels.back().A.swap(Ac);
+    }
+
+    // direct solver for the coarsest level
+    Eigen::SparseMatrix<double> Ac = levels.back().A;
+    coarse_dense = (Ac.rows()<=max_dense_size);
+    if(coarse_dense)
+    {
+        // pseudo inverse, discarding the (numerically) null eigenvalues
+        Eigen::MatrixXd Ad = Ac;
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(Ad);
+        Eigen::VectorXd inv_eval = eig.eigenvalues();
+        double max_eval = inv_eval.cwiseAbs().maxCoeff();
+        for(int i=0; i<inv_eval.size(); ++i)
+        {
+            inv_eval[i] = (std::fabs(inv_eval[i]) > 1e-12*max_eval) ? 1.0/inv_eval[i] : 0.0;
+        }
+        coarse_pinv = eig.eigenvectors() * inv_eval.asDiagonal() * eig.eigenvectors().transpose();
+    }
+    else
+    {
+        coarse_LDLT.compute(Ac);
+        if(coarse_LDLT.info()!=Eigen::Success)
+        {
+            levels.clear();
+            status = Eigen::NumericalIssue;
+            return;
+        }
+    }
+    status = Eigen::Success;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void MultigridPCG::solve(const Eigen::VectorXd & b, Eigen::VectorXd & x)
+{
+    n_iters      = 0;
+    rel_residual = 0;
+    if(levels.empty()) return;
+
+    const RowMatrix & A = levels.front().A;
+    assert(b.size()==A.rows());
+
+    Eigen::VectorXd sb = sign*b;
+    if(x.size()!=b.size()) x = Eigen::VectorXd::Zero(b.size());
+
+    double b_norm = sb.norm();
+    if(b_norm==0)
+    {
+        x.setZero();
+        status = Eigen::Success;
+        return;
+    }
+
+    residual(A, sb, x, r);
+    rel_residual = r.norm()/b_norm;
+
+    // z = M^-1 * r, with M^-1 being one V-cycle
+    auto precondition = [&]()
+    {
+        levels.front().b = r;
+        v_cycle(0);
+        z = levels.front().x;
+    };
+
+    precondition();
+    p = z;
+    double rz = r.dot(z);
+    while(rel_residual>tolerance && n_iters<max_iters)
+    {
+        multiply(A, p, Ap);
+        double alpha = rz / p.dot(Ap);
+        x += alpha * p;
+        r -= alpha * Ap;
+        rel_residual = r.norm()/b_norm;
+        ++n_iters;
+        if(rel_residual<=tolerance) break;
+        precondition();
+        double rz_new = r.dot(z);
+        p = z + (rz_new/rz) * p;
+        rz = rz_new;
+    }
+    status = (rel_residual<=tolerance) ? Eigen::Success : Eigen::NoConvergence;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// standard smoothed aggregation:
+//  1) roots: vertices whose strong neighbors are all free form an aggregate with them
+//  2) the remaining vertices join the aggregate of their strongest neighbor
+//  3) leftovers form new aggregates with their free strong neighbors
+// vertices without strong connections are not aggregated (they are taken care
+// of by the smoother, and have no representative on the coarser level)
+CINO_INLINE
+void MultigridPCG::aggregate(const RowMatrix & A, std::vector<int> & agg, uint & n_agg) const
+{
+    const double strength_threshold = 0.15; // a_ij is strong if |a_ij| >= t*sqrt(a_ii*a_jj)
+
+    uint n = A.rows();
+    Eigen::VectorXd diag = A.diagonal();
+
+    // strong connections (CSR)
+    std::vector<uint> s_off(n+1,0);
+    std::vector<uint> s_nbr;
+    std::vector<double> s_val;
+    s_nbr.reserve(A.nonZeros());
+    s_val.reserve(A.nonZeros());
+    for(uint i=0; i<n; ++i)
+    {
+        for(RowMatrix::InnerIterator it(A,i); it; ++it)
+        {
+            uint j = uint(it.col());
+            if(j==i) continue;
+            double a = std::fabs(it.value());
+            if(a >= strength_threshold*std::sqrt(diag[i]*diag[j]))
+            {
+                s_nbr.push_back(j);
+                s_val.push_back(a);
+            }
+        }
+        s_off.at(i+1) = s_nbr.size();
+    }
+
+    const int FREE = -1, ISOLATED = -2;
+    agg.assign(n, FREE);
+    n_agg = 0;
+
+    // 1) roots
+    for(uint i=0; i<n; ++i)
+    {
+        if(agg[i]!=FREE) continue;
+        if(s_off[i]==s_off[i+1])
+        {
+            agg[i] = ISOLATED;
+            continue;
+        }
+        bool all_free = true;
+        for(uint k=s_off[i]; k<s_off[i+1] && all_free; ++k) all_free = (agg[s_nbr[k]]==FREE);
+        if(!all_free) continue;
+        agg[i] = n_agg;
+        for(uint k=s_off[i]; k<s_off[i+1]; ++k) agg[s_nbr[k]] = n_agg;
+        ++n_agg;
+    }
+
+    // 2) join the strongest aggregated neighbor (as of the end of step 1)
+    std::vector<int> agg1 = agg;
+    for(uint i=0; i<n; ++i)
+    {
+        if(agg1[i]!=FREE) continue;
+        double best = -1;
+        for(uint k=s_off[i]; k<s_off[i+1]; ++k)
+        {
+            int a = agg1[s_nbr[k]];
+            if(a>=0 && s_val[k]>best)
+            {
+                best   = s_val[k];
+                agg[i] = a;
+            }
+        }
+    }
+
+    // 3) leftovers
+    for(uint i=0; i<n; ++i)
+    {
+        if(agg[i]!=FREE) continue;
+        agg[i] = n_agg;
+        for(uint k=s_off[i]; k<s_off[i+1]; ++k) if(agg[s_nbr[k]]==FREE) agg[s_nbr[k]] = n_agg;
+        ++n_agg;
+    }
+
+    for(int & a : agg) if(a==ISOLATED) a = -1;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Ac = P^T*A*P, assembled one coarse row at a time. Since P = (I - w*D^-1*A)*P0,
+// column a of P is non zero only on the aggregate a and its neighbors, hence
+// the fine rows contributing to coarse row a are found walking the rows of A
+// of the aggregate members, and P^T is never stored (Eigen products with mixed
+// storage orders would copy one of the factors)
+CINO_INLINE
+void MultigridPCG::galerkin(const RowMatrix & A, const RowMatrix & P, const std::vector<int> & agg, RowMatrix & Ac)
+{
+    uint n  = A.rows();
+    uint nc = P.cols();
+
+    // members of each aggregate (CSR)
+    std::vector<uint> m_off(nc+1,0);
+    for(int a : agg) if(a>=0) ++m_off.at(a+1);
+    for(uint a=0; a<nc; ++a) m_off.at(a+1) += m_off.at(a);
+    std::vector<uint> members(m_off.back());
+    std::vector<uint> pos(m_off.begin(), m_off.end()-1);
+    for(uint i=0; i<n; ++i) if(agg.at(i)>=0) members.at(pos.at(agg.at(i))++) = i;
+
+    RowMatrix AP = A * P;
+
+    std::vector<int>    visited(n, -1);
+    std::vector<double> row(nc, 0);
+    std::vector<bool>   mask(nc, false);
+    std::vector<uint>   nz;
+
+    Ac.resize(nc, nc);
+    Ac.reserve(P.nonZeros());
+    for(uint a=0; a<nc; ++a)
+    {
+        nz.clear();
+        for(uint k=m_off[a]; k<m_off[a+1]; ++k)
+        {
+            for(RowMatrix::InnerIterator i_it(A,members[k]); i_it; ++i_it)
+            {
+                uint i = uint(i_it.col());
+                if(visited[i]==int(a)) continue;
+                visited[i] = int(a);
+
+                double p_ia = 0;
+                for(RowMatrix::InnerIterator p_it(P,i); p_it; ++p_it)
+                {
+                    if(p_it.col()==a) { p_ia = p_it.value(); break; }
+                }
+                if(p_ia==0) continue;
+
+                // row a += P(i,a) * (row i of A*P)
+                for(RowMatrix::InnerIterator ap_it(AP,i); ap_it; ++ap_it)
+                {
+                    uint c = uint(ap_it.col());
+                    if(!mask[c])
+                    {
+                        mask[c] = true;
+                        row[c]  = 0;
+                        nz.push_back(c);
+                    }
+                    row[c] += p_ia*ap_it.value();
+                }
+            }
+        }
+        std::sort(nz.begin(), nz.end());
+        Ac.startVec(a);
+        for(uint c : nz)
+        {
+            Ac.insertBack(a,c) = row[c];
+            mask[c] = false;
+        }
+    }
+    Ac.finalize();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// approximately solves A_l * x_l = b_l (symmetric V-cycle: the same smoother
+// before and after the coarse grid correction, zero initial guess)
+CINO_INLINE
+void MultigridPCG::v_cycle(const uint l)
+{
+    Level & L = levels.at(l);
+
+    if(l+1==levels.size())
+    {
+        if(coarse_dense) L.x = coarse_pinv * L.b;
+        else             L.x = coarse_LDLT.solve(L.b);
+        return;
+    }
+
+    L.x.setZero();
+    smooth(L);
+
+    Level & C = levels.at(l+1);
+    residual(L.A, L.b, L.x, L.r);
+    transpose_multiply(L.P, L.r, C.b);
+    v_cycle(l+1);
+    multiply(L.P, C.x, L.r);
+    L.x += L.r;
+
+    smooth(L);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Chebyshev polynomial smoother (Jacobi preconditioned), targeting the upper
+// part [lambda_max/30, lambda_max] of the spectrum of D^-1*A. Contrary to
+// Gauss-Seidel it only needs matrix vector products, hence it runs in parallel
+CINO_INLINE
+void MultigridPCG::smooth(Level & L) const
+{
+    const uint degree = 2;
+
+    double lambda_min = L.lambda_max/30.0;
+    double theta      = 0.5*(L.lambda_max + lambda_min);
+    double delta      = 0.5*(L.lambda_max - lambda_min);
+    double sigma      = theta/delta;
+    double rho        = 1.0/sigma;
+
+    residual(L.A, L.b, L.x, L.r);
+    L.d = L.inv_diag.cwiseProduct(L.r)/theta;
+    L.x += L.d;
+    for(uint k=1; k<degree; ++k)
+    {
+        double rho_next = 1.0/(2.0*sigma - rho);
+        residual(L.A, L.b, L.x, L.r);
+        L.d = (rho_next*rho)*L.d + (2.0*rho_next/delta)*L.inv_diag.cwiseProduct(L.r);
+        L.x += L.d;
+        rho = rho_next;
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void MultigridPCG::multiply(const RowMatrix & A, const Eigen::VectorXd & x, Eigen::VectorXd & y)
+{
+    y.resize(A.rows());
+    PARALLEL_FOR(0, A.rows(), 10000, [&](uint i)
+    {
+        double s = 0;
+        for(RowMatrix::InnerIterator it(A,i); it; ++it) s += it.value()*x[it.col()];
+        y[i] = s;
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// scatters the rows of A, so that the transpose does not need to be stored
+// (serial, as rows of A scatter into overlapping entries of y)
+CINO_INLINE
+void MultigridPCG::transpose_multiply(const RowMatrix & A, const Eigen::VectorXd & x, Eigen::VectorXd & y)
+{
+    y = Eigen::VectorXd::Zero(A.cols());
+    for(uint i=0; i<A.rows(); ++i)
+    {
+        double xi = x[i];
+        for(RowMatrix::InnerIterator it(A,i); it; ++it) y[it.col()] += it.value()*xi;
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void MultigridPCG::residual(const RowMatrix & A, const Eigen::VectorXd & b, const Eigen::VectorXd & x, Eigen::VectorXd & r)
+{
+    r.resize(A.rows());
+    PARALLEL_FOR(0, A.rows(), 10000, [&](uint i)
+    {
+        double s = b[i];
+        for(RowMatrix::InnerIterator it(A,i); it; ++it) s -= it.value()*x[it.col()];
+        r[i] = s;
+    });
+}
+
+}
@@ -478,6 +478,14 @@ bool Octree::contains(const vec3d & p, const bool strict, std::unordered_set<uin
 
 CINO_INLINE
 bool Octree::intersects_ray(const vec3d & p, const vec3d & dir, double & min_t, uint & id) const
+{
+    return intersects_ray(p, dir, max_uint, min_t, id);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool Octree::intersects_ray(const vec3d & p, const vec3d & dir, const uint skip_id, double & min_t, uint & id) const
 {
     assert(root != nullptr);
 
@@ -494,36 +502,37 @@ bool Octree::intersects_ray(const vec3d & p, const vec3d & dir, double & min_t,
     PrioQueue q;
     q.push(obj);
 
-    while(!q.empty() && q.top().node->is_inner())
+    // nodes and hits are sorted by distance: stop as soon as a hit is on top
+    while(!q.empty() && q.top().index<0)
     {
         Obj obj = q.top();
         q.pop();
 
-        for(int i=0; i<8; ++i)
+        if(obj.node->is_inner())
         {
-            OctreeNode *child = obj.node->children[i];
-            if(child->bbox.intersects_ray(p, dir, t, pos))
+            for(int i=0; i<8; ++i)
             {
-                if(child->is_inner())
+                OctreeNode *child = obj.node->children[i];
+                if(child->bbox.intersects_ray(p, dir, t, pos))
                 {
-                    Obj obj;
-                    obj.node = child;
-                    obj.dist = t;
-                    q.push(obj);
+                    Obj next;
+                    next.node = child;
+                    next.dist = t;
+                    q.push(next);
                 }
-                else
+            }
+        }
+        else
+        {
+            for(uint i : obj.node->item_indices)
+            {
+                if(items.at(i)->id!=skip_id && items.at(i)->intersects_ray(p, dir, t, pos))
                 {
-                    for(uint i : child->item_indices)
-                    {
-                        if(items.at(i)->intersects_ray(p, dir, t, pos))
-                        {
-                            Obj obj;
-                            obj.node  = child;
-                            obj.index = items.at(i)->id;
-                            obj.dist  = t;
-                            q.push(obj);
-                        }
-                    }
+                    Obj hit;
+                    hit.node  = obj.node;
+                    hit.index = items.at(i)->id;
+                    hit.dist  = t;
+                    q.push(hit);
                 }
             }
         }
@@ -536,8 +545,7 @@ bool Octree::intersects_ray(const vec3d & p, const vec3d & dir, double & min_t,
     }
 
     if(q.empty()) return false;
-    assert(q.top().index>=0);
-    id    = items.at(q.top().index)->id;
+    id    = q.top().index;
     min_t = q.top().dist;
     return true;
 }
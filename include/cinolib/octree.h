@@ -199,6 +199,7 @@ class Octree
         // returns respectively the first and the full list of intersections
         // between items in the octree and a ray R(t) := p + t * dir
         bool intersects_ray(const vec3d & p, const vec3d & dir, double & min_t, uint & id) const; // first hit
+        bool intersects_ray(const vec3d & p, const vec3d & dir, const uint skip_id, double & min_t, uint & id) const; // first hit, ignoring item skip_id
         bool intersects_ray(const vec3d & p, const vec3d & dir, std::set<std::pair<double,uint>> & all_hits) const;
 
         // note: these queries become exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
@@ -56,7 +56,7 @@ void padding(AbstractPolyhedralMesh<M,V,E,F,P> & m, const bool inwards)
         {
 			vec3d pos_to_add = m.vert(vid);
             uint  new_vid = m.vert_add(pos_to_add);       // update position;
-            vec3d off     = m.vert_data(vid).normal*l*0.5;
+            vec3d off     = m.vert_normal(vid)*l*0.5;
             if(inwards) m.vert(  vid  ) -= off;
             else        m.vert(new_vid) += off;
             vmap[vid] = new_vid;
@@ -88,7 +88,8 @@ static void PARALLEL_FOR(      uint   beg,
     else
     {
         // estimate number of threads in the pool
-        const static unsigned n_threads      = (n_threads_hint==0u) ? 8u : n_threads_hint;
+        // (NOT static: the hint may change from call to call)
+        const unsigned n_threads = (n_threads_hint==0u) ? 8u : n_threads_hint;
 
         // split the full range into sub ranges of equal size
         uint slice = (uint)std::round(n/static_cast<double>(n_threads));
@@ -0,0 +1,182 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/point_kdtree.h>
+#include <cinolib/parallel_for.h>
+#include <algorithm>
+#include <numeric>
+
+namespace cinolib
+{
+
+CINO_INLINE
+void PointKdTree::build(const std::vector<vec3d> & points)
+{
+    ids.resize(points.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    axis.resize(points.size());
+
+    // splits range [beg,end) at its median, along the axis of largest extent
+    auto split = [&](const uint beg, const uint end)
+    {
+        vec3d lo = points[ids[beg]];
+        vec3d hi = lo;
+        for(uint i=beg+1; i<end; ++i)
+        {
+            lo = lo.min(points[ids[i]]);
+            hi = hi.max(points[ids[i]]);
+        }
+        vec3d   delta = hi - lo;
+        uint8_t a     = (delta[0]>=delta[1] && delta[0]>=delta[2]) ? 0 : ((delta[1]>=delta[2]) ? 1 : 2);
+        uint    mid   = (beg+end)/2;
+        std::nth_element(ids.begin()+beg, ids.begin()+mid, ids.begin()+end, [&](const uint i, const uint j)
+        {
+            return points[i][a] < points[j][a];
+        });
+        axis[mid] = a;
+    };
+
+    // serially split the upper levels, until there are enough subtrees to keep all threads busy
+    std::vector<std::pair<uint,uint>> ranges, next;
+    if(!points.empty()) ranges.push_back(std::make_pair(0u, uint(points.size())));
+    while(!ranges.empty() && ranges.size()<256 && ranges.front().second-ranges.front().first>1024)
+    {
+        next.clear();
+        for(auto r : ranges)
+        {
+            split(r.first, r.second);
+            uint mid = (r.first+r.second)/2;
+            if(r.first<mid)    next.push_back(std::make_pair(r.first, mid));
+            if(mid+1<r.second) next.push_back(std::make_pair(mid+1, r.second));
+        }
+        ranges.swap(next);
+    }
+
+    PARALLEL_FOR(0, uint(ranges.size()), 2, [&](uint i)
+    {
+        std::vector<std::pair<uint,uint>> stack = { ranges[i] };
+        while(!stack.empty())
+        {
+            auto r = stack.back();
+            stack.pop_back();
+            split(r.first, r.second);
+            uint mid = (r.first+r.second)/2;
+            if(r.first<mid)    stack.push_back(std::make_pair(r.first, mid));
+            if(mid+1<r.second) stack.push_back(std::make_pair(mid+1, r.second));
+        }
+    });
+
+    pts.resize(points.size());
+    for(uint i=0; i<ids.size(); ++i) pts[i] = points[ids[i]];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void PointKdTree::clear()
+{
+    pts.clear();
+    ids.clear();
+    axis.clear();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+bool PointKdTree::closest_point(const vec3d & p, uint & id, double & dist) const
+{
+    return closest_point(p, [](const uint){ return true; }, id, dist);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<typename Filter>
+CINO_INLINE
+bool PointKdTree::closest_point(const vec3d & p, const Filter & valid, uint & id, double & dist) const
+{
+    id   = UINT_MAX;
+    dist = inf_double;
+    vec3d off(0,0,0);
+    visit(0, size(), p, valid, off, 0.0, id, dist);
+    return id!=UINT_MAX;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// off contains the (per axis) offset between p and the cell of the current node, and
+// cell_dist the squared distance between p and the cell. Subtrees are visited only if
+// their cell is not farther than the current closest point (Arya and Mount, 1993)
+template<typename Filter>
+CINO_INLINE
+void PointKdTree::visit(const uint     beg,
+                        const uint     end,
+                        const vec3d  & p,
+                        const Filter & valid,
+                              vec3d  & off,
+                        const double   cell_dist,
+                              uint   & id,
+                              double & dist) const
+{
+    if(beg>=end) return;
+
+    uint   mid = (beg+end)/2;
+    double d   = pts[mid].dist(p);
+    if((d<dist || (d==dist && ids[mid]<id)) && valid(ids[mid]))
+    {
+        id   = ids[mid];
+        dist = d;
+    }
+    if(end-beg==1) return;
+
+    uint8_t a     = axis[mid];
+    double  delta = p[a] - pts[mid][a];
+    uint    near_beg = (delta<0) ? beg   : mid+1;
+    uint    near_end = (delta<0) ? mid   : end;
+    uint    far_beg  = (delta<0) ? mid+1 : beg;
+    uint    far_end  = (delta<0) ? end   : mid;
+
+    visit(near_beg, near_end, p, valid, off, cell_dist, id, dist);
+
+    double old_off = off[a];
+    double far_dist = cell_dist - old_off*old_off + delta*delta;
+    if(far_dist <= dist*dist)
+    {
+        off[a] = delta;
+        visit(far_beg, far_end, p, valid, off, far_dist, id, dist);
+        off[a] = old_off;
+    }
+}
+
+}
@@ -0,0 +1,100 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_POINT_KDTREE_H
+#define CINO_POINT_KDTREE_H
+
+#include <cinolib/geometry/vec_mat.h>
+#include <cinolib/min_max_inf.h>
+#include <climits>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Minimal static kd-tree for nearest point queries. The tree is implicit:
+ * points are reordered so that the node of range [beg,end) is the median
+ * point (beg+end)/2, and no child pointers are stored. The upper levels are
+ * split serially, the remaining subtrees are built in parallel.
+ *
+ * Queries can be restricted to a subset of the points with a filter (e.g.
+ * to skip hidden mesh elements). Filtered points are simply skipped during
+ * the visit, hence the filter can change from query to query without having
+ * to rebuild the tree. Ties are broken in favour of the smallest index, so
+ * results are the same of a linear search over all the (valid) points.
+*/
+
+class PointKdTree
+{
+    public:
+
+        void build(const std::vector<vec3d> & points);
+        void clear();
+
+        bool empty() const { return ids.empty(); }
+        uint size()  const { return uint(ids.size()); }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // returns false if the tree is empty, or if no point passes the filter
+        bool closest_point(const vec3d & p, uint & id, double & dist) const;
+
+        template<typename Filter> // bool valid(const uint id)
+        bool closest_point(const vec3d & p, const Filter & valid, uint & id, double & dist) const;
+
+    protected:
+
+        template<typename Filter>
+        void visit(const uint     beg,
+                   const uint     end,
+                   const vec3d  & p,
+                   const Filter & valid,
+                         vec3d  & off,
+                   const double   cell_dist,
+                         uint   & id,
+                         double & dist) const;
+
+        std::vector<vec3d>   pts;   // points, in tree order
+        std::vector<uint>    ids;   // index of each point in the input vector
+        std::vector<uint8_t> axis;  // split axis of each node
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "point_kdtree.cpp"
+#endif
+
+#endif // CINO_POINT_KDTREE_H
@@ -0,0 +1,199 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/predicates_batched.h>
+#include <cinolib/predicates.h>
+#include <algorithm>
+#include <cmath>
+
+namespace cinolib
+{
+
+#ifdef CINOLIB_USES_SHEWCHUK_PREDICATES
+namespace
+{
+    // number of queries processed by each iteration of the filter
+    const uint PRED_BLOCK = 4;
+
+    // error bounds of the stage A filter, as defined in:
+    //
+    // Routines for Arbitrary Precision Floating-point Arithmetic and Fast Robust Geometric Predicates
+    // J.R. Shewchuk
+    // Discrete & Computational Geometry, 1997
+    //
+    const double pred_eps      = 1.1102230246251565e-16; // 2^-53
+    const double o2d_errboundA = (3.0 +  16.0*pred_eps)*pred_eps;
+    const double o3d_errboundA = (7.0 +  56.0*pred_eps)*pred_eps;
+}
+#endif
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint orient2d_batch(const double * pa, const uint stride_a,
+                    const double * pb, const uint stride_b,
+                    const double * pc, const uint stride_c,
+                    const uint     n,
+                          double * res)
+{
+#ifndef CINOLIB_USES_SHEWCHUK_PREDICATES
+    // inexact predicates: there is nothing to filter
+    for(uint i=0; i<n; ++i) res[i] = orient2d(pa + i*stride_a, pb + i*stride_b, pc + i*stride_c);
+    return 0;
+#else
+    uint n_exact = 0;
+    for(uint beg=0; beg<n; beg+=PRED_BLOCK)
+    {
+        const uint m = std::min(PRED_BLOCK, n-beg);
+
+        // gather the block in SoA layout (padding lanes are set to zero)
+        double acx[PRED_BLOCK], acy[PRED_BLOCK];
+        double bcx[PRED_BLOCK], bcy[PRED_BLOCK];
+        for(uint i=m; i<PRED_BLOCK; ++i) acx[i] = acy[i] = bcx[i] = bcy[i] = 0;
+        for(uint i=0; i<m; ++i)
+        {
+            const double *a = pa + (beg+i)*stride_a;
+            const double *b = pb + (beg+i)*stride_b;
+            const double *c = pc + (beg+i)*stride_c;
+            acx[i] = a[0] - c[0];
+            acy[i] = a[1] - c[1];
+            bcx[i] = b[0] - c[0];
+            bcy[i] = b[1] - c[1];
+        }
+
+        // branch free filter
+        double det[PRED_BLOCK];
+        bool   sure[PRED_BLOCK];
+        for(uint i=0; i<PRED_BLOCK; ++i)
+        {
+            double l = acx[i] * bcy[i];
+            double r = acy[i] * bcx[i];
+            det[i]  = l - r;
+            sure[i] = std::fabs(det[i]) > o2d_errboundA * (std::fabs(l) + std::fabs(r));
+        }
+
+        for(uint i=0; i<m; ++i)
+        {
+            if(sure[i]) res[beg+i] = det[i];
+            else
+            {
+                res[beg+i] = orient2d(pa + (beg+i)*stride_a,
+                                      pb + (beg+i)*stride_b,
+                                      pc + (beg+i)*stride_c);
+                ++n_exact;
+            }
+        }
+    }
+    return n_exact;
+#endif
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint orient3d_batch(const double * pa, const uint stride_a,
+                    const double * pb, const uint stride_b,
+                    const double * pc, const uint stride_c,
+                    const double * pd, const uint stride_d,
+                    const uint     n,
+                          double * res)
+{
+#ifndef CINOLIB_USES_SHEWCHUK_PREDICATES
+    // inexact predicates: there is nothing to filter
+    for(uint i=0; i<n; ++i) res[i] = orient3d(pa + i*stride_a, pb + i*stride_b, pc + i*stride_c, pd + i*stride_d);
+    return 0;
+#else
+    uint n_exact = 0;
+    for(uint beg=0; beg<n; beg+=PRED_BLOCK)
+    {
+        const uint m = std::min(PRED_BLOCK, n-beg);
+
+        // gather the block in SoA layout (padding lanes are set to zero)
+        double adx[PRED_BLOCK], ady[PRED_BLOCK], adz[PRED_BLOCK];
+        double bdx[PRED_BLOCK], bdy[PRED_BLOCK], bdz[PRED_BLOCK];
+        double cdx[PRED_BLOCK], cdy[PRED_BLOCK], cdz[PRED_BLOCK];
+        for(uint i=m; i<PRED_BLOCK; ++i) adx[i] = ady[i] = adz[i] = bdx[i] = bdy[i] = bdz[i] = cdx[i] = cdy[i] = cdz[i] = 0;
+        for(uint i=0; i<m; ++i)
+        {
+            const double *a = pa + (beg+i)*stride_a;
+            const double *b = pb + (beg+i)*stride_b;
+            const double *c = pc + (beg+i)*stride_c;
+            const double *d = pd + (beg+i)*stride_d;
+            adx[i] = a[0] - d[0]; ady[i] = a[1] - d[1]; adz[i] = a[2] - d[2];
+            bdx[i] = b[0] - d[0]; bdy[i] = b[1] - d[1]; bdz[i] = b[2] - d[2];
+            cdx[i] = c[0] - d[0]; cdy[i] = c[1] - d[1]; cdz[i] = c[2] - d[2];
+        }
+
+        // branch free filter (same expression and bound of Shewchuk's orient3d)
+        double det[PRED_BLOCK];
+        bool   sure[PRED_BLOCK];
+        for(uint i=0; i<PRED_BLOCK; ++i)
+        {
+            double bdxcdy = bdx[i] * cdy[i];
+            double cdxbdy = cdx[i] * bdy[i];
+            double cdxady = cdx[i] * ady[i];
+            double adxcdy = adx[i] * cdy[i];
+            double adxbdy = adx[i] * bdy[i];
+            double bdxady = bdx[i] * ady[i];
+
+            det[i] = adz[i] * (bdxcdy - cdxbdy)
+                   + bdz[i] * (cdxady - adxcdy)
+                   + cdz[i] * (adxbdy - bdxady);
+
+            double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz[i])
+                             + (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz[i])
+                             + (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz[i]);
+
+            sure[i] = std::fabs(det[i]) > o3d_errboundA * permanent;
+        }
+
+        for(uint i=0; i<m; ++i)
+        {
+            if(sure[i]) res[beg+i] = det[i];
+            else
+            {
+                res[beg+i] = orient3d(pa + (beg+i)*stride_a,
+                                      pb + (beg+i)*stride_b,
+                                      pc + (beg+i)*stride_c,
+                                      pd + (beg+i)*stride_d);
+                ++n_exact;
+            }
+        }
+    }
+    return n_exact;
+#endif
+}
+
+}
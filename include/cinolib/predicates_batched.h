@@ -0,0 +1,95 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_PREDICATES_BATCHED_H
+#define CINO_PREDICATES_BATCHED_H
+
+#include <cinolib/cino_inline.h>
+#include <sys/types.h>
+
+namespace cinolib
+{
+
+/* Batched versions of the orient2d and orient3d predicates, meant for
+ * algorithms that evaluate many orientations at once (e.g. all the vertices
+ * of a set of triangles against the supporting plane of another triangle).
+ *
+ * Each query is first evaluated in floating point together with the a priori
+ * error bound of Shewchuk's adaptive predicates (the "stage A" filter). This
+ * first pass is branch free and processes queries in blocks stored as SoA,
+ * so that the compiler can map it to the SIMD units of the target (SSE/AVX/NEON,
+ * depending on the compilation flags). Only the uncertain queries (i.e. those
+ * whose determinant is smaller than the error bound) are re-evaluated with
+ * the scalar orient2d/orient3d defined in predicates.h, which are exact if
+ * CINOLIB_USES_SHEWCHUK_PREDICATES is defined. The sign of each output is
+ * therefore the same that the scalar predicate would return. If the symbol
+ * CINOLIB_USES_SHEWCHUK_PREDICATES is not defined there is no exact path to
+ * fall back to, and queries are simply evaluated with the inexact predicates.
+ *
+ * Input points are read from arrays with a given stride (in doubles). A zero
+ * stride means that the same point is used for all the queries. For example,
+ * to test n points against the plane of triangle abc:
+ *
+ *      orient3d_batch(a,0, b,0, c,0, points,3, n, res);
+ *
+ * The methods return the number of queries that failed the filter and were
+ * computed with the scalar fallback. The filter pays off on large batches
+ * (thousands of queries). For a handful of orientations the scalar predicates
+ * are faster.
+*/
+
+CINO_INLINE
+uint orient2d_batch(const double * pa, const uint stride_a,
+                    const double * pb, const uint stride_b,
+                    const double * pc, const uint stride_c,
+                    const uint     n,
+                          double * res);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint orient3d_batch(const double * pa, const uint stride_a,
+                    const double * pb, const uint stride_b,
+                    const double * pc, const uint stride_c,
+                    const double * pd, const uint stride_d,
+                    const uint     n,
+                          double * res);
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "predicates_batched.cpp"
+#endif
+
+#endif // CINO_PREDICATES_BATCHED_H
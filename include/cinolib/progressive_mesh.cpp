@@ -0,0 +1,212 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/progressive_mesh.h>
+#include <cinolib/min_max_inf.h>
+#include <algorithm>
+#include <cassert>
+
+namespace cinolib
+{
+
+CINO_INLINE
+ProgressiveMesh::ProgressiveMesh(const std::vector<vec3d> & verts,
+                                 const std::vector<uint>  & tris)
+    : base_verts(verts)
+    , base_tris(tris)
+    , tri_death(tris.size()/3, max_uint)
+{}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void ProgressiveMesh::add_collapse(const uint                v_keep,
+                                   const uint                v_rem,
+                                   const vec3d             & pos,
+                                   const std::vector<uint> & dead_tris)
+{
+    uint level = num_levels();
+    for(uint tid : dead_tris)
+    {
+        assert(tri_death.at(tid)==max_uint);
+        tri_death.at(tid) = level;
+    }
+    Collapse c;
+    c.v_keep  = v_keep;
+    c.v_rem   = v_rem;
+    c.pos     = pos;
+    c.n_polys = num_polys(level-1) - uint(dead_tris.size());
+    collapses.push_back(c);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint ProgressiveMesh::num_verts(const uint level) const
+{
+    assert(level<num_levels());
+    return uint(base_verts.size()) - level;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint ProgressiveMesh::num_polys(const uint level) const
+{
+    assert(level<num_levels());
+    return (level==0) ? uint(base_tris.size()/3) : collapses.at(level-1).n_polys;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint ProgressiveMesh::level_with_polys(const uint n_polys) const
+{
+    if(num_polys(0)<=n_polys) return 0;
+    // triangle counts are non increasing along the sequence
+    auto it = std::lower_bound(collapses.begin(), collapses.end(), n_polys,
+                               [](const Collapse & c, const uint n){ return c.n_polys > n; });
+    if(it==collapses.end()) return uint(collapses.size());
+    return uint(it - collapses.begin()) + 1;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+std::vector<uint> ProgressiveMesh::vert_map(const uint level) const
+{
+    assert(level<num_levels());
+
+    // representative of each base vertex. Visiting the collapses backwards,
+    // the representative of v_keep is final when v_rem gets redirected to it
+    std::vector<uint> rep(base_verts.size());
+    for(uint vid=0; vid<rep.size(); ++vid) rep[vid] = vid;
+    for(uint i=level; i>0; --i)
+    {
+        const Collapse & c = collapses[i-1];
+        rep[c.v_rem] = rep[c.v_keep];
+    }
+
+    // compact ids of the surviving vertices (in base order)
+    std::vector<uint> fresh_id(base_verts.size(), max_uint);
+    uint fresh = 0;
+    for(uint vid=0; vid<rep.size(); ++vid)
+    {
+        if(rep[vid]==vid) fresh_id[vid] = fresh++;
+    }
+    for(uint vid=0; vid<rep.size(); ++vid) rep[vid] = fresh_id[rep[vid]];
+    assert(fresh==num_verts(level));
+    return rep;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void ProgressiveMesh::extract(const uint           level,
+                              std::vector<vec3d> & verts,
+                              std::vector<uint>  & tris) const
+{
+    std::vector<uint> base2level;
+    extract(level, verts, tris, base2level);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void ProgressiveMesh::extract(const uint           level,
+                              std::vector<vec3d> & verts,
+                              std::vector<uint>  & tris,
+                              std::vector<uint>  & base2level) const
+{
+    base2level = vert_map(level);
+
+    verts.resize(num_verts(level));
+    for(uint vid=0; vid<base_verts.size(); ++vid)
+    {
+        verts[base2level[vid]] = base_verts[vid];
+    }
+    for(uint i=0; i<level; ++i)
+    {
+        verts[base2level[collapses[i].v_keep]] = collapses[i].pos;
+    }
+
+    tris.clear();
+    tris.reserve(3*num_polys(level));
+    for(uint tid=0; tid<tri_death.size(); ++tid)
+    {
+        if(tri_death[tid]<=level) continue;
+        tris.push_back(base2level[base_tris[3*tid+0]]);
+        tris.push_back(base2level[base_tris[3*tid+1]]);
+        tris.push_back(base2level[base_tris[3*tid+2]]);
+    }
+    assert(tris.size()==3*num_polys(level));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<typename T>
+CINO_INLINE
+std::vector<T> ProgressiveMesh::field_to_level(const uint level, const std::vector<T> & base_field) const
+{
+    assert(base_field.size()==base_verts.size());
+    std::vector<uint>   base2level = vert_map(level);
+    std::vector<T>      res(num_verts(level), T(0.0));
+    std::vector<double> count(num_verts(level), 0.0);
+    for(uint vid=0; vid<base_verts.size(); ++vid)
+    {
+        res[base2level[vid]] = res[base2level[vid]] + base_field[vid];
+        count[base2level[vid]] += 1.0;
+    }
+    for(uint vid=0; vid<res.size(); ++vid) res[vid] = res[vid] * (1.0/count[vid]);
+    return res;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<typename T>
+CINO_INLINE
+std::vector<T> ProgressiveMesh::field_to_base(const uint level, const std::vector<T> & level_field) const
+{
+    assert(level_field.size()==num_verts(level));
+    std::vector<uint> base2level = vert_map(level);
+    std::vector<T>    res(base_verts.size());
+    for(uint vid=0; vid<base_verts.size(); ++vid)
+    {
+        res[vid] = level_field[base2level[vid]];
+    }
+    return res;
+}
+
+}
@@ -0,0 +1,137 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_PROGRESSIVE_MESH_H
+#define CINO_PROGRESSIVE_MESH_H
+
+#include <vector>
+#include <sys/types.h>
+#include <cinolib/cino_inline.h>
+#include <cinolib/geometry/vec_mat.h>
+
+namespace cinolib
+{
+
+/* Level of detail hierarchy of a triangle mesh, encoded as the base (finest)
+ * mesh plus the ordered sequence of half edge collapses that simplified it, as in:
+ *
+ *     Progressive Meshes
+ *     H.Hoppe
+ *     ACM SIGGRAPH (1996)
+ *
+ * Level l is the mesh obtained by applying the first l collapses to the base mesh
+ * (level 0 is the base mesh itself). Vertices and triangles are never renumbered
+ * along the sequence: collapses only redirect vertices to the ones they merge into,
+ * and each triangle disappears at a well defined level. Any level can therefore be
+ * extracted with one linear sweep over the base mesh, without replaying the
+ * simplification, and per vertex fields can be moved across levels through the
+ * clusters of base vertices that each level vertex represents.
+ *
+ * The hierarchy is filled by simplification algorithms (see QEM_simplification.h)
+*/
+
+class ProgressiveMesh
+{
+    public:
+
+        struct Collapse
+        {
+            uint  v_keep;  // vertex that survives the collapse (base mesh id)
+            uint  v_rem;   // vertex merged into v_keep (base mesh id)
+            vec3d pos;     // position of v_keep after the collapse
+            uint  n_polys; // number of triangles after the collapse
+        };
+
+        explicit ProgressiveMesh(){}
+        explicit ProgressiveMesh(const std::vector<vec3d> & verts,
+                                 const std::vector<uint>  & tris);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // appends a collapse. dead_tris are the base triangles that degenerate with it
+        void add_collapse(const uint                v_keep,
+                          const uint                v_rem,
+                          const vec3d             & pos,
+                          const std::vector<uint> & dead_tris);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint num_levels()                const { return uint(collapses.size())+1; }
+        uint num_verts(const uint level) const;
+        uint num_polys(const uint level) const;
+
+        // finest level with at most n_polys triangles (the coarsest one, if none has)
+        uint level_with_polys(const uint n_polys) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // map from base vertices to the vertices of a level (each level vertex
+        // represents the cluster of base vertices that collapsed into it)
+        std::vector<uint> vert_map(const uint level) const;
+
+        void extract(const uint           level,
+                     std::vector<vec3d> & verts,
+                     std::vector<uint>  & tris) const;
+
+        void extract(const uint           level,
+                     std::vector<vec3d> & verts,
+                     std::vector<uint>  & tris,
+                     std::vector<uint>  & base2level) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // per vertex fields: base to level (average over the clusters) and
+        // level to base (each base vertex takes the value of its cluster)
+        template<typename T>
+        std::vector<T> field_to_level(const uint level, const std::vector<T> & base_field) const;
+
+        template<typename T>
+        std::vector<T> field_to_base(const uint level, const std::vector<T> & level_field) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        std::vector<vec3d>    base_verts;
+        std::vector<uint>     base_tris;
+        std::vector<Collapse> collapses;
+        std::vector<uint>     tri_death;  // level at which each base triangle disappears (max_uint if never)
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "progressive_mesh.cpp"
+#endif
+
+#endif // CINO_PROGRESSIVE_MESH_H
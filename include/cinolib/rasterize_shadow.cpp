@@ -0,0 +1,161 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/rasterize_shadow.h>
+#include <cinolib/parallel_for.h>
+#include <cinolib/min_max_inf.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+namespace cinolib
+{
+
+template<class Mesh>
+CINO_INLINE
+void rasterize_shadow(const Mesh    & m,
+                      const vec3d   & dir,
+                      const uint      w,
+                      const uint      h,
+                            uint8_t * data,
+                      const bool      parallel)
+{
+    memset(data, 0x00, w*h);
+    if(m.num_verts()==0) return;
+
+    // model-view transformation (same as cast_shadow): the mesh is centered at the
+    // origin, scaled to fit the [-1,1] cube and rotated so that dir becomes the Z axis
+    vec3d  Z(0,0,1);
+    vec3d  a = dir.cross(Z);
+    vec3d  c = m.centroid();
+    double s = 2.0/m.bbox().diag();
+    mat3d  R = mat3d::DIAG(1.0);
+    if(a.normalize()>1e-12) R = mat3d::ROT_3D(a, Z.angle_rad(dir));
+    else if(dir.z()<0)      R = mat3d::ROT_3D(vec3d(1,0,0), M_PI);
+
+    // only the first two rows of R matter for an orthographic projection along Z.
+    // Vertices are mapped from [-1,1] straight to pixel coordinates
+    vec3d rx(R(0,0), R(0,1), R(0,2));
+    vec3d ry(R(1,0), R(1,1), R(1,2));
+    std::vector<double> px(m.num_verts());
+    std::vector<double> py(m.num_verts());
+    PARALLEL_FOR(0, m.num_verts(), parallel ? 10000 : UINT_MAX, [&](const uint vid)
+    {
+        vec3d p = (m.vert(vid) - c) * s;
+        px[vid] = (rx.dot(p) + 1.0) * 0.5 * w;
+        py[vid] = (ry.dot(p) + 1.0) * 0.5 * h;
+    });
+
+    // scan converts the rows in [row_beg,row_end) of triangle (v0,v1,v2)
+    auto raster_tri = [&](const uint v0, const uint v1, const uint v2, const int row_beg, const int row_end)
+    {
+        const uint   v[3]  = { v0, v1, v2 };
+        const double y_min = std::min({py[v0], py[v1], py[v2]});
+        const double y_max = std::max({py[v0], py[v1], py[v2]});
+        // rows whose center y+0.5 falls within [y_min,y_max]
+        int r0 = std::max(row_beg, (int)std::ceil (y_min-0.5));
+        int r1 = std::min(row_end, (int)std::floor(y_max-0.5)+1);
+        for(int row=r0; row<r1; ++row)
+        {
+            double y  = row + 0.5;
+            double xl =  inf_double;
+            double xr = -inf_double;
+            for(uint i=0; i<3; ++i)
+            {
+                double xa = px[v[i]], ya = py[v[i]];
+                double xb = px[v[(i+1)%3]], yb = py[v[(i+1)%3]];
+                if(y<std::min(ya,yb) || y>std::max(ya,yb)) continue;
+                if(ya==yb)
+                {
+                    xl = std::min({xl,xa,xb});
+                    xr = std::max({xr,xa,xb});
+                }
+                else
+                {
+                    double x = xa + (y-ya)*(xb-xa)/(yb-ya);
+                    xl = std::min(xl,x);
+                    xr = std::max(xr,x);
+                }
+            }
+            // columns whose center x+0.5 falls within [xl,xr]
+            int c0 = std::max(0,      (int)std::ceil (xl-0.5));
+            int c1 = std::min((int)w, (int)std::floor(xr-0.5)+1);
+            if(c0<c1) memset(data + size_t(row)*w + c0, 0xFF, c1-c0);
+        }
+    };
+
+    if(!parallel)
+    {
+        for(uint pid=0; pid<m.num_polys(); ++pid)
+        {
+            const std::vector<uint> & tris = m.poly_tessellation(pid);
+            for(uint i=0; i+2<tris.size(); i+=3) raster_tri(tris[i], tris[i+1], tris[i+2], 0, h);
+        }
+        return;
+    }
+
+    // bin triangles into horizontal bands of rows. Each band is rasterized by
+    // a single thread, hence threads write on disjoint portions of the buffer
+    const uint band_h  = 16;
+    const uint n_bands = (h + band_h - 1)/band_h;
+    std::vector<std::vector<uint>> bands(n_bands);
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        const std::vector<uint> & tris = m.poly_tessellation(pid);
+        for(uint i=0; i+2<tris.size(); i+=3)
+        {
+            double y_min = std::min({py[tris[i]], py[tris[i+1]], py[tris[i+2]]});
+            double y_max = std::max({py[tris[i]], py[tris[i+1]], py[tris[i+2]]});
+            int b0 = std::max(0,            (int)std::floor(y_min/band_h));
+            int b1 = std::min((int)n_bands-1, (int)std::floor(y_max/band_h));
+            for(int b=b0; b<=b1; ++b)
+            {
+                bands[b].push_back(tris[i  ]);
+                bands[b].push_back(tris[i+1]);
+                bands[b].push_back(tris[i+2]);
+            }
+        }
+    }
+    PARALLEL_FOR(0, n_bands, 2, [&](const uint b)
+    {
+        const std::vector<uint> & tris = bands[b];
+        int row_beg = b*band_h;
+        int row_end = std::min(h, (b+1)*band_h);
+        for(uint i=0; i<tris.size(); i+=3) raster_tri(tris[i], tris[i+1], tris[i+2], row_beg, row_end);
+    });
+}
+
+}
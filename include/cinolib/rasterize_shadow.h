@@ -0,0 +1,76 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_RASTERIZE_SHADOW_H
+#define CINO_RASTERIZE_SHADOW_H
+
+#include <cinolib/geometry/vec_mat.h>
+
+namespace cinolib
+{
+
+/* Headless counterpart of cast_shadow. The mesh is projected along the light
+ * direction with the same model-view transformation used by cast_shadow, and
+ * its triangles (polygons are split with their tessellation) are scan converted
+ * on the CPU, with no need for a GL context. This makes it possible to compute
+ * shadows on machines with no GPU/display, and to rasterize along multiple
+ * directions concurrently (one buffer per thread).
+ *
+ * A pixel belongs to the shadow if its center is inside (or on the boundary of)
+ * at least one projected triangle. Output pixels are 0x00 (background) or 0xFF
+ * (foreground), as in the stencil buffer produced by cast_shadow. Differently
+ * from the GL version geometry is never clipped along the depth axis.
+ *
+ * If parallel is true, rows are split in bands that are rasterized by different
+ * threads. Set it to false when the function is already called from within a
+ * parallel loop.
+*/
+
+template<class Mesh>
+CINO_INLINE
+void rasterize_shadow(const Mesh    & m,                // mesh to be rasterized
+                      const vec3d   & dir,              // light direction
+                      const uint      w,                // width
+                      const uint      h,                // height
+                            uint8_t * data,             // w x h buffer, 8 bits per pixel
+                      const bool      parallel = true);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "rasterize_shadow.cpp"
+#endif
+
+#endif // CINO_RASTERIZE_SHADOW_H
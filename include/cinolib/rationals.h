@@ -41,6 +41,7 @@
 #include <CGAL/Lazy_exact_nt.h>
 #include <CGAL/Gmpq.h>
 #include <cinolib/cino_inline.h>
+#include <cinolib/filtered_predicates.h>
 
 namespace cinolib
 {
@@ -50,6 +51,22 @@ typedef CGAL::Lazy_exact_nt<CGAL::Gmpq> CGAL_Q;
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+// lazy rationals carry an interval approximation of their value, which
+// allows to filter predicates without building expression DAGs (see
+// orient2d_sign in filtered_predicates.h)
+//
+template<>
+struct IntervalTraits<CGAL_Q>
+{
+    static Interval to_interval(const CGAL_Q & x)
+    {
+        std::pair<double,double> i = CGAL::to_interval(x);
+        return { i.first, i.second };
+    }
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
 template <class T>
 CINO_INLINE
 T orient3d(const T * pa,
@@ -35,6 +35,7 @@
 *********************************************************************************/
 #include <cinolib/remesh_BotschKobbelt2004.h>
 #include <cinolib/tangential_smoothing.h>
+#include <cinolib/tracer.h>
 
 namespace cinolib
 {
@@ -53,12 +54,15 @@ void remesh_Botsch_Kobbelt_2004(Trimesh<M,V,E,P> & m,
                                 const double       target_edge_length,
                                 const bool         preserve_marked_features)
 {
+    CINO_PROFILE_SCOPE("remesh_Botsch_Kobbelt_2004");
+
     double l = (target_edge_length>0) ? target_edge_length : m.edge_avg_length();
 
     // 1) split too long edges
     //
     uint count = 0;
     uint ne = m.num_edges();
+    CINO_PROFILE_BLOCK("remesh_Botsch_Kobbelt_2004::split")
     for(uint eid=0; eid<ne; ++eid)
     {
         if (m.edge_length(eid) > 4./3.*l)
@@ -83,6 +87,7 @@ void remesh_Botsch_Kobbelt_2004(Trimesh<M,V,E,P> & m,
     // 2) collapse too short edges
     //
     count = 0;
+    CINO_PROFILE_BLOCK("remesh_Botsch_Kobbelt_2004::collapse")
     for(uint eid=0; eid<m.num_edges(); ++eid)
     {
         bool inc_to_marked = false;
@@ -106,6 +111,7 @@ void remesh_Botsch_Kobbelt_2004(Trimesh<M,V,E,P> & m,
     // 3) optimize per vert valence
     //
     count = 0;
+    CINO_PROFILE_BLOCK("remesh_Botsch_Kobbelt_2004::flip")
     for(uint eid=0; eid<m.num_edges(); ++eid)
     {
         if (preserve_marked_features && m.edge_data(eid).flags[MARKED]) continue;
@@ -143,14 +149,17 @@ void remesh_Botsch_Kobbelt_2004(Trimesh<M,V,E,P> & m,
 
         if(before>after) // flip only if minimize sqrd deviation from ideal valence
         {
-            P   data    = m.poly_data(m.adj_e2p(eid).front());
-            int new_eid = m.edge_flip(eid);
+            uint              pid0    = m.adj_e2p(eid).front();
+            P                 data    = m.poly_data(pid0);
+            AttributeChannels attr    = m.poly_channels().item(pid0);
+            int               new_eid = m.edge_flip(eid);
 
             if(new_eid>=0) // copy per poly attributes in the newly generated poly (but restore right normal!)
             {
                 for(uint pid : m.adj_e2p(new_eid))
                 {
                     m.poly_data(pid) = data;
+                    m.poly_channels().copy(pid, attr, 0);
                     m.update_p_normal(pid);
                 }
                 m.update_v_normal(m.edge_vert_id(new_eid,0));
@@ -164,6 +173,7 @@ void remesh_Botsch_Kobbelt_2004(Trimesh<M,V,E,P> & m,
 
     // 4) relocate vertices by tangential smoothing
     //
+    CINO_PROFILE_BLOCK("remesh_Botsch_Kobbelt_2004::smooth")
     for(uint vid=0; vid<m.num_verts(); ++vid)
     {
         bool anchored = false;
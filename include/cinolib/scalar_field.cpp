@@ -107,9 +107,9 @@ void ScalarField::copy_to_mesh(Mesh & m, const int tex_coord) const
         {
             switch (tex_coord)
             {
-                case U_param : m.vert_data(vid).uvw[0] = (*this)[vid]; break;
-                case V_param : m.vert_data(vid).uvw[1] = (*this)[vid]; break;
-                case W_param : m.vert_data(vid).uvw[2] = (*this)[vid]; break;
+                case U_param : m.vert_uvw(vid)[0] = (*this)[vid]; break;
+                case V_param : m.vert_uvw(vid)[1] = (*this)[vid]; break;
+                case W_param : m.vert_uvw(vid)[2] = (*this)[vid]; break;
                 default: assert(false);
             }
         }
@@ -120,14 +120,14 @@ void ScalarField::copy_to_mesh(Mesh & m, const int tex_coord) const
         {
             switch (tex_coord)
             {
-                case UV_param : m.vert_data(vid).uvw[0] = (*this)[vid];
-                                m.vert_data(vid).uvw[1] = (*this)[vid + nv];
+                case UV_param : m.vert_uvw(vid)[0] = (*this)[vid];
+                                m.vert_uvw(vid)[1] = (*this)[vid + nv];
                                 break;
-                case UW_param : m.vert_data(vid).uvw[0] = (*this)[vid];
-                                m.vert_data(vid).uvw[2] = (*this)[vid + nv];
+                case UW_param : m.vert_uvw(vid)[0] = (*this)[vid];
+                                m.vert_uvw(vid)[2] = (*this)[vid + nv];
                                 break;
-                case VW_param : m.vert_data(vid).uvw[1] = (*this)[vid];
-                                m.vert_data(vid).uvw[2] = (*this)[vid + nv];
+                case VW_param : m.vert_uvw(vid)[1] = (*this)[vid];
+                                m.vert_uvw(vid)[2] = (*this)[vid + nv];
                                 break;
                 default: assert(false);
             }
@@ -139,9 +139,9 @@ void ScalarField::copy_to_mesh(Mesh & m, const int tex_coord) const
         uint nv2 = nv*2;
         for(uint vid=0; vid<nv; ++vid)
         {
-            m.vert_data(vid).uvw[0] = (*this)[vid];
-            m.vert_data(vid).uvw[1] = (*this)[vid + nv];
-            m.vert_data(vid).uvw[2] = (*this)[vid + nv2];
+            m.vert_uvw(vid)[0] = (*this)[vid];
+            m.vert_uvw(vid)[1] = (*this)[vid + nv];
+            m.vert_uvw(vid)[2] = (*this)[vid + nv2];
         }
     }
     else assert(false);
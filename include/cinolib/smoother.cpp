@@ -88,9 +88,9 @@ void mesh_smoother(      AbstractPolygonMesh<M1,V1,E1,P1> & m,
         }
         switch(count)
         {
-            case 0  : m.vert_data(vid).label = REGULAR; break;
-            case 2  : m.vert_data(vid).label = FEATURE; break;
-            default : m.vert_data(vid).label = CORNER;  break;
+            case 0  : m.vert_label(vid) = REGULAR; break;
+            case 2  : m.vert_label(vid) = FEATURE; break;
+            default : m.vert_label(vid) = CORNER;  break;
         }
     }
 
@@ -127,7 +127,7 @@ void mesh_smoother(      AbstractPolygonMesh<M1,V1,E1,P1> & m,
         double dist;
         uint   pid;
         o_srf.closest_point(m.vert(vid), pid, p, dist);
-        vec3d n = target.poly_data(pid).normal;
+        vec3d n = target.poly_normal(pid);
 
         // reduces energy for mapping to distant points
         // because they are likely to be wrong assignments
@@ -229,7 +229,7 @@ void mesh_smoother(      AbstractPolygonMesh<M1,V1,E1,P1> & m,
         laplacian();
         for(uint vid=0; vid<m.num_verts(); ++vid)
         {
-            switch(m.vert_data(vid).label)
+            switch(m.vert_label(vid))
             {
                 case REGULAR: tangent_space(vid); break;
                 case FEATURE: tangent_line(vid);  break;
@@ -250,7 +250,7 @@ void mesh_smoother(      AbstractPolygonMesh<M1,V1,E1,P1> & m,
         {
             vec3d p(res[vid], res[nv+vid], res[2*nv+vid]);
 
-            switch(m.vert_data(vid).label)
+            switch(m.vert_label(vid))
             {
                 case REGULAR: m.vert(vid) = (opt.reproject_on_target) ? o_srf.closest_point(p)    : p; break;
                 case CORNER:  m.vert(vid) = (opt.reproject_on_target) ? o_corner.closest_point(p) : p; break;
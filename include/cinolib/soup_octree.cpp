@@ -0,0 +1,927 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/soup_octree.h>
+#include <cinolib/how_many_seconds.h>
+#include <cinolib/parallel_for.h>
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <array>
+
+namespace cinolib
+{
+
+template<class Soup>
+CINO_INLINE
+SoupOctree<Soup>::SoupOctree(const uint max_depth,
+                             const uint items_per_leaf)
+: max_depth(max_depth)
+, items_per_leaf(items_per_leaf)
+{}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::clear()
+{
+    soup.clear();
+    nodes.clear();
+    leaf_items.clear();
+    octant_costs.clear();
+    tree_depth = 0;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::build()
+{
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    nodes.clear();
+    leaf_items.clear();
+    octant_costs.clear();
+    tree_depth = 0;
+
+    uint n_items = soup.size();
+    if(n_items==0) return;
+
+    std::vector<uint> items(n_items);
+    std::iota(items.begin(), items.end(), 0);
+    nodes.emplace_back();
+    split(0, items, 1);
+    update_bboxes();
+
+    // cache the cost of each octant, to detect when refit degrades its quality
+    for(uint c=nodes.front().child_beg; c<nodes.front().child_end; ++c)
+    {
+        octant_costs.push_back(traversal_cost(c));
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        double t = how_many_seconds(t0,t1);
+        std::cout << ":::::::::::::::::::::::::::::::::::::::::::::::::::" << std::endl;
+        std::cout << "SoupOctree created (" << t << "s)                  " << std::endl;
+        std::cout << "#Items                   : " << soup.size()          << std::endl;
+        std::cout << "#Nodes                   : " << nodes.size()         << std::endl;
+        std::cout << "#Leaves                  : " << num_leaves()         << std::endl;
+        std::cout << "Max depth                : " << max_depth            << std::endl;
+        std::cout << "Depth                    : " << tree_depth           << std::endl;
+        std::cout << "Prescribed items per leaf: " << items_per_leaf       << std::endl;
+        std::cout << "Max items per leaf       : " << max_items_per_leaf() << std::endl;
+        std::cout << "Traversal cost           : " << traversal_cost()     << std::endl;
+        std::cout << "Memory                   : " << memory_in_bytes()/1048576.0 << "MB" << std::endl;
+        std::cout << ":::::::::::::::::::::::::::::::::::::::::::::::::::" << std::endl;
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::split(const uint root, const std::vector<uint> & items, const uint root_depth)
+{
+    assert(!nodes.at(root).is_inner());
+
+    std::vector<AABB> boxes(items.size());
+    PARALLEL_FOR(0, (uint)items.size(), 1000, [&](uint i)
+    {
+        boxes[i] = soup.aabb(items[i]);
+    });
+
+    // construction-only data, indexed by local node ids: the global id of each node,
+    // the octant it spans (used for splitting), and the list of items it contains
+    // (positions in vector items, flattened into leaf_items at the end)
+    std::vector<uint>              node_ids = { root };
+    std::vector<AABB>              cells;
+    std::vector<std::vector<uint>> node_items(1, std::vector<uint>(items.size()));
+    cells.emplace_back(boxes);
+    std::iota(node_items.front().begin(), node_items.front().end(), 0);
+    tree_depth = std::max(tree_depth, root_depth);
+
+    // split one level at a time. Nodes on the same level are processed in parallel,
+    // and their children are appended to the node list at the end of each level
+    std::vector<uint> level = { 0 };
+    for(uint depth=root_depth; depth<max_depth; ++depth)
+    {
+        std::vector<uint> to_split;
+        for(uint lid : level)
+        {
+            if(node_items.at(lid).size()>items_per_leaf) to_split.push_back(lid);
+        }
+        if(to_split.empty()) break;
+
+        std::vector<std::array<std::vector<uint>,8>> children_items(to_split.size());
+        PARALLEL_FOR(0, (uint)to_split.size(), 2, [&](uint k)
+        {
+            uint lid = to_split.at(k);
+            AABB octants[8];
+            for(int i=0; i<8; ++i) octants[i] = octant(cells.at(lid),i);
+            for(uint it : node_items.at(lid))
+            {
+                for(int i=0; i<8; ++i)
+                {
+                    if(octants[i].intersects_box(boxes.at(it))) children_items.at(k)[i].push_back(it);
+                }
+            }
+        });
+
+        std::vector<uint> next_level;
+        for(uint k=0; k<to_split.size(); ++k)
+        {
+            uint lid = to_split.at(k);
+            uint nid = node_ids.at(lid);
+            nodes.at(nid).child_beg = (uint)nodes.size();
+            for(int i=0; i<8; ++i)
+            {
+                // empty octants are not stored
+                if(children_items.at(k)[i].empty()) continue;
+                next_level.push_back((uint)node_ids.size());
+                node_ids.push_back((uint)nodes.size());
+                nodes.emplace_back();
+                cells.push_back(octant(cells.at(lid),i));
+                node_items.emplace_back(std::move(children_items.at(k)[i]));
+            }
+            nodes.at(nid).child_end = (uint)nodes.size();
+            std::vector<uint>().swap(node_items.at(lid));
+        }
+        level.swap(next_level);
+        tree_depth = std::max(tree_depth, depth+1);
+    }
+
+    // flatten leaf items
+    for(uint lid=0; lid<node_ids.size(); ++lid)
+    {
+        SoupOctreeNode & node = nodes.at(node_ids.at(lid));
+        if(node.is_inner()) continue;
+        node.item_beg = (uint)leaf_items.size();
+        for(uint i : node_items.at(lid)) leaf_items.push_back(items.at(i));
+        node.item_end = (uint)leaf_items.size();
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+uint SoupOctree<Soup>::refit(const double max_cost_increase)
+{
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    if(nodes.empty()) return 0;
+
+    update_bboxes();
+
+    // partial rebuild of the octants whose traversal cost degraded too much
+    uint n_rebuilt = 0;
+    for(uint c=nodes.front().child_beg; c<nodes.front().child_end; ++c)
+    {
+        double & ref_cost = octant_costs.at(c-nodes.front().child_beg);
+        double   cost     = traversal_cost(c);
+        if(cost <= ref_cost*(1.0+max_cost_increase)) continue;
+
+        // collect the items of the octant and detach its (old) subtree
+        std::vector<uint> items;
+        std::vector<uint> lifo = { c };
+        while(!lifo.empty())
+        {
+            const SoupOctreeNode & node = nodes.at(lifo.back());
+            lifo.pop_back();
+            for(uint i=node.child_beg; i<node.child_end; ++i) lifo.push_back(i);
+            items.insert(items.end(), leaf_items.begin()+node.item_beg, leaf_items.begin()+node.item_end);
+        }
+        std::sort(items.begin(), items.end());
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+
+        nodes.at(c) = SoupOctreeNode();
+        split(c, items, 2);
+        ++n_rebuilt;
+    }
+
+    if(n_rebuilt>0)
+    {
+        compact();
+        update_bboxes();
+        for(uint c=nodes.front().child_beg; c<nodes.front().child_end; ++c)
+        {
+            octant_costs.at(c-nodes.front().child_beg) = traversal_cost(c);
+        }
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Refit	" << how_many_seconds(t0,t1) << " seconds (" << n_rebuilt << " octants rebuilt)" << std::endl;
+    }
+
+    return n_rebuilt;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// Surface Area Heuristic: the probability that a random ray hitting the box of node n
+// also hits the box of a descendant d is area(d)/area(n). Traversing an inner node costs 1,
+// testing an item costs 1, hence the expected cost of a query starting from n is
+//
+//    sum_{inner d} area(d)/area(n)  +  sum_{leaf d} area(d)/area(n) * #items(d)
+//
+// The cost is scale invariant, hence rigid motions and uniform scaling do not affect it
+template<class Soup>
+CINO_INLINE
+double SoupOctree<Soup>::traversal_cost(const uint nid) const
+{
+    if(nodes.empty()) return 0.0;
+
+    auto area = [](const AABB & b) -> double
+    {
+        vec3d d = b.delta();
+        return 2.0*(d[0]*d[1] + d[1]*d[2] + d[2]*d[0]);
+    };
+
+    double cost = 0.0;
+    std::vector<uint> lifo = { nid };
+    while(!lifo.empty())
+    {
+        const SoupOctreeNode & node = nodes.at(lifo.back());
+        lifo.pop_back();
+        if(node.is_inner())
+        {
+            cost += area(node.bbox);
+            for(uint c=node.child_beg; c<node.child_end; ++c) lifo.push_back(c);
+        }
+        else cost += area(node.bbox) * (node.item_end-node.item_beg);
+    }
+    double a = area(nodes.at(nid).bbox);
+    return (a>0) ? cost/a : 0.0;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// removes the nodes (and leaf items) no longer reachable from the root after a partial
+// rebuild. Nodes are re-numbered in breadth first order, so that children remain contiguous
+// and stored after their father. The indices of the root's children do not change
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::compact()
+{
+    std::vector<SoupOctreeNode> new_nodes;
+    std::vector<uint>           new_items;
+    std::vector<uint>           depth = { 1 };
+    new_nodes.reserve(nodes.size());
+    new_items.reserve(leaf_items.size());
+    new_nodes.push_back(nodes.front());
+    tree_depth = 1;
+
+    for(uint nid=0; nid<new_nodes.size(); ++nid)
+    {
+        SoupOctreeNode node = new_nodes.at(nid);
+        if(node.is_inner())
+        {
+            new_nodes.at(nid).child_beg = (uint)new_nodes.size();
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                new_nodes.push_back(nodes.at(c));
+                depth.push_back(depth.at(nid)+1);
+            }
+            new_nodes.at(nid).child_end = (uint)new_nodes.size();
+            tree_depth = std::max(tree_depth, depth.at(nid)+1);
+        }
+        else
+        {
+            new_nodes.at(nid).item_beg = (uint)new_items.size();
+            new_items.insert(new_items.end(), leaf_items.begin()+node.item_beg, leaf_items.begin()+node.item_end);
+            new_nodes.at(nid).item_end = (uint)new_items.size();
+        }
+    }
+    nodes.swap(new_nodes);
+    leaf_items.swap(new_items);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// same octant ordering of Octree::subdivide
+template<class Soup>
+CINO_INLINE
+AABB SoupOctree<Soup>::octant(const AABB & cell, const int i)
+{
+    vec3d min = cell.min;
+    vec3d max = cell.max;
+    vec3d avg = cell.center();
+    switch(i)
+    {
+        case 0 : return AABB(vec3d(min[0], min[1], min[2]), vec3d(avg[0], avg[1], avg[2]));
+        case 1 : return AABB(vec3d(avg[0], min[1], min[2]), vec3d(max[0], avg[1], avg[2]));
+        case 2 : return AABB(vec3d(avg[0], avg[1], min[2]), vec3d(max[0], max[1], avg[2]));
+        case 3 : return AABB(vec3d(min[0], avg[1], min[2]), vec3d(avg[0], max[1], avg[2]));
+        case 4 : return AABB(vec3d(min[0], min[1], avg[2]), vec3d(avg[0], avg[1], max[2]));
+        case 5 : return AABB(vec3d(avg[0], min[1], avg[2]), vec3d(max[0], avg[1], max[2]));
+        case 6 : return AABB(vec3d(avg[0], avg[1], avg[2]), vec3d(max[0], max[1], max[2]));
+        case 7 : return AABB(vec3d(min[0], avg[1], avg[2]), vec3d(avg[0], max[1], max[2]));
+        default: assert(false);
+    }
+    return cell;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::update_bboxes()
+{
+    // leaves first (in parallel), then inner nodes from the bottom up.
+    // Nodes are created level by level, hence children always have higher
+    // indices than their father, and a reverse scan is a valid bottom-up visit
+    PARALLEL_FOR(0, (uint)nodes.size(), 1000, [&](uint nid)
+    {
+        SoupOctreeNode & node = nodes.at(nid);
+        if(node.is_inner()) return;
+        node.bbox.reset();
+        for(uint i=node.item_beg; i<node.item_end; ++i)
+        {
+            node.bbox.push(soup.aabb(leaf_items.at(i)));
+        }
+    });
+    for(int nid=(int)nodes.size()-1; nid>=0; --nid)
+    {
+        SoupOctreeNode & node = nodes.at(nid);
+        if(!node.is_inner()) continue;
+        node.bbox.reset();
+        for(uint c=node.child_beg; c<node.child_end; ++c)
+        {
+            node.bbox.push(nodes.at(c).bbox);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+template<class M, class V, class E, class P>
+CINO_INLINE
+void SoupOctree<Soup>::build_from_mesh_polys(const AbstractPolygonMesh<M,V,E,P> & m)
+{
+    static_assert(std::is_same<Soup,TriangleSoup>::value, "polygon meshes require a TriangleSoup");
+    assert(soup.empty());
+    std::vector<uint> tris;
+    std::vector<uint> ids;
+    tris.reserve(3*m.num_polys());
+    ids.reserve(m.num_polys());
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        const std::vector<uint> & tess = m.poly_tessellation(pid);
+        tris.insert(tris.end(), tess.begin(), tess.end());
+        ids.insert(ids.end(), tess.size()/3, pid);
+    }
+    soup.reference(m.vector_verts(), tris, ids);
+    build();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void SoupOctree<Soup>::build_from_mesh_polys(const AbstractPolyhedralMesh<M,V,E,F,P> & m)
+{
+    static_assert(std::is_same<Soup,TetSoup>::value, "polyhedral meshes require a TetSoup");
+    assert(soup.empty());
+    assert(m.mesh_type()==TETMESH && "Unsupported element");
+    std::vector<uint> tets;
+    tets.reserve(4*m.num_polys());
+    for(uint pid=0; pid<m.num_polys(); ++pid)
+    {
+        tets.insert(tets.end(), m.adj_p2v(pid).begin(), m.adj_p2v(pid).end());
+    }
+    soup.reference(m.vector_verts(), tets);
+    build();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+template<class M, class V, class E, class P>
+CINO_INLINE
+void SoupOctree<Soup>::build_from_mesh_edges(const AbstractMesh<M,V,E,P> & m)
+{
+    static_assert(std::is_same<Soup,SegmentSoup>::value, "mesh edges require a SegmentSoup");
+    assert(soup.empty());
+    soup.reference(m.vector_verts(), m.vector_edges());
+    build();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+template<class M, class V, class E, class P>
+CINO_INLINE
+void SoupOctree<Soup>::build_from_mesh_points(const AbstractMesh<M,V,E,P> & m)
+{
+    static_assert(std::is_same<Soup,PointSoup>::value, "mesh points require a PointSoup");
+    assert(soup.empty());
+    soup.reference(m.vector_verts(), std::vector<uint>());
+    build();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::build_from_vectors(const std::vector<vec3d> & verts,
+                                          const std::vector<uint>  & tris)
+{
+    static_assert(std::is_same<Soup,TriangleSoup>::value, "triangle vectors require a TriangleSoup");
+    assert(soup.empty());
+    soup.reference(verts, tris);
+    build();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+uint SoupOctree<Soup>::num_leaves() const
+{
+    uint count = 0;
+    for(const auto & node : nodes) if(!node.is_inner()) ++count;
+    return count;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+uint SoupOctree<Soup>::max_items_per_leaf() const
+{
+    uint max = 0;
+    for(const auto & node : nodes) max = std::max(max, node.item_end-node.item_beg);
+    return max;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+size_t SoupOctree<Soup>::memory_in_bytes() const
+{
+    return sizeof(*this) - sizeof(Soup)                  +
+           soup.memory_in_bytes()                        +
+           nodes.capacity()      * sizeof(SoupOctreeNode) +
+           leaf_items.capacity() * sizeof(uint)           +
+           octant_costs.capacity() * sizeof(double);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::debug_mode(const bool b)
+{
+    print_debug_info = b;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+vec3d SoupOctree<Soup>::closest_point(const vec3d & p) const
+{
+    uint   id;
+    vec3d  pos;
+    double dist;
+    closest_point(p, id, pos, dist);
+    return pos;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// best first search: nodes are visited in order of distance from p, and
+// the visit stops as soon as the closest node is farther than the best item
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::closest_point(const vec3d  & p,            // query point
+                                           uint   & id,           // id of the item T closest to p
+                                           vec3d  & pos,          // point in T closest to p
+                                           double & d_sqrd) const // SQUARED distance between pos and p
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    typedef std::pair<double,uint> Entry; // (squared distance, node)
+    std::priority_queue<Entry,std::vector<Entry>,std::greater<Entry>> q;
+    q.push(std::make_pair(nodes.front().bbox.dist_sqrd(p),0u));
+    d_sqrd = inf_double;
+
+    while(!q.empty() && q.top().first<d_sqrd)
+    {
+        const SoupOctreeNode & node = nodes.at(q.top().second);
+        q.pop();
+
+        if(node.is_inner())
+        {
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                double d = nodes.at(c).bbox.dist_sqrd(p);
+                if(d<d_sqrd) q.push(std::make_pair(d,c));
+            }
+        }
+        else
+        {
+            for(uint i=node.item_beg; i<node.item_end; ++i)
+            {
+                uint   it = leaf_items.at(i);
+                vec3d  c  = soup.point_closest_to(it,p);
+                double d  = c.dist_sqrd(p);
+                if(d<d_sqrd)
+                {
+                    d_sqrd = d;
+                    pos    = c;
+                    id     = soup.id(it);
+                }
+            }
+        }
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Closest point\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// this query becomes exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::contains(const vec3d & p, const bool strict, uint & id) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    // NOTE: node boxes are tight, and may be flat (e.g. for axis aligned triangles).
+    // They are therefore always tested in non strict mode
+    std::vector<uint> lifo;
+    if(nodes.front().bbox.contains(p)) lifo.push_back(0);
+
+    while(!lifo.empty())
+    {
+        const SoupOctreeNode & node = nodes.at(lifo.back());
+        lifo.pop_back();
+
+        if(node.is_inner())
+        {
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                if(nodes.at(c).bbox.contains(p)) lifo.push_back(c);
+            }
+        }
+        else
+        {
+            for(uint i=node.item_beg; i<node.item_end; ++i)
+            {
+                uint it = leaf_items.at(i);
+                if(soup.contains(it,p,strict))
+                {
+                    id = soup.id(it);
+                    if(print_debug_info)
+                    {
+                        Time::time_point t1 = Time::now();
+                        std::cout << "Contains query (first item)\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+                    }
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// this query becomes exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::contains(const vec3d & p, const bool strict, std::unordered_set<uint> & ids) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    std::vector<uint> lifo;
+    if(nodes.front().bbox.contains(p)) lifo.push_back(0);
+
+    while(!lifo.empty())
+    {
+        const SoupOctreeNode & node = nodes.at(lifo.back());
+        lifo.pop_back();
+
+        if(node.is_inner())
+        {
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                if(nodes.at(c).bbox.contains(p)) lifo.push_back(c);
+            }
+        }
+        else
+        {
+            for(uint i=node.item_beg; i<node.item_end; ++i)
+            {
+                uint it = leaf_items.at(i);
+                if(soup.contains(it,p,strict)) ids.insert(soup.id(it));
+            }
+        }
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Contains query (all items)\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+
+    return !ids.empty();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// best first search: nodes are visited in order of entry point along the ray,
+// and the visit stops as soon as the next node is farther than the best hit
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::intersects_ray(const vec3d & p, const vec3d & dir, double & min_t, uint & id) const
+{
+    return intersects_ray(p, dir, max_uint, min_t, id);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::intersects_ray(const vec3d & p, const vec3d & dir, const uint skip_id, double & min_t, uint & id) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    vec3d  pos;
+    double t;
+    if(!nodes.front().bbox.intersects_ray(p, dir, t, pos)) return false;
+
+    typedef std::pair<double,uint> Entry; // (entry point, node)
+    std::priority_queue<Entry,std::vector<Entry>,std::greater<Entry>> q;
+    q.push(std::make_pair(t,0u));
+    min_t = inf_double;
+
+    while(!q.empty() && q.top().first<=min_t)
+    {
+        const SoupOctreeNode & node = nodes.at(q.top().second);
+        q.pop();
+
+        if(node.is_inner())
+        {
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                if(nodes.at(c).bbox.intersects_ray(p, dir, t, pos) && t<=min_t)
+                {
+                    q.push(std::make_pair(t,c));
+                }
+            }
+        }
+        else
+        {
+            for(uint i=node.item_beg; i<node.item_end; ++i)
+            {
+                uint it = leaf_items.at(i);
+                if(soup.id(it)!=skip_id && soup.intersects_ray(it, p, dir, t, pos) && t<min_t)
+                {
+                    min_t = t;
+                    id    = soup.id(it);
+                }
+            }
+        }
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Intersects ray\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+
+    return min_t<inf_double;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::intersects_ray(const vec3d & p, const vec3d & dir, std::set<std::pair<double,uint>> & all_hits) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    vec3d  pos;
+    double t;
+    std::vector<uint> lifo;
+    if(nodes.front().bbox.intersects_ray(p, dir, t, pos)) lifo.push_back(0);
+
+    while(!lifo.empty())
+    {
+        const SoupOctreeNode & node = nodes.at(lifo.back());
+        lifo.pop_back();
+
+        if(node.is_inner())
+        {
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                if(nodes.at(c).bbox.intersects_ray(p, dir, t, pos)) lifo.push_back(c);
+            }
+        }
+        else
+        {
+            for(uint i=node.item_beg; i<node.item_end; ++i)
+            {
+                uint it = leaf_items.at(i);
+                if(soup.intersects_ray(it, p, dir, t, pos))
+                {
+                    all_hits.insert(std::make_pair(t,soup.id(it)));
+                }
+            }
+        }
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Intersects ray\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+
+    return !all_hits.empty();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// this query becomes exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::intersects_segment(const vec3d s[], const bool ignore_if_valid_complex, std::unordered_set<uint> & ids) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    std::vector<uint> candidates;
+    items_intersecting_box(AABB(s[0],s[1]), candidates);
+
+    for(uint it : candidates)
+    {
+        if(soup.intersects_segment(it, s, ignore_if_valid_complex)) ids.insert(soup.id(it));
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Intersects segment\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+
+    return !ids.empty();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// this query becomes exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::intersects_triangle(const vec3d t[], const bool ignore_if_valid_complex, std::unordered_set<uint> & ids) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    std::vector<uint> candidates;
+    std::vector<vec3d> list = {t[0],t[1],t[2]};
+    items_intersecting_box(AABB(list), candidates);
+
+    for(uint it : candidates)
+    {
+        if(soup.intersects_triangle(it, t, ignore_if_valid_complex)) ids.insert(soup.id(it));
+    }
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Intersects triangle\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+
+    return !ids.empty();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+bool SoupOctree<Soup>::intersects_box(const AABB & b, std::unordered_set<uint> & ids) const
+{
+    assert(!nodes.empty());
+
+    typedef std::chrono::steady_clock Time;
+    Time::time_point t0 = Time::now();
+
+    std::vector<uint> items;
+    items_intersecting_box(b, items);
+    for(uint it : items) ids.insert(soup.id(it));
+
+    if(print_debug_info)
+    {
+        Time::time_point t1 = Time::now();
+        std::cout << "Intersects box\t" << how_many_seconds(t0,t1) << " seconds" << std::endl;
+    }
+
+    return !ids.empty();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Soup>
+CINO_INLINE
+void SoupOctree<Soup>::items_intersecting_box(const AABB & b, std::vector<uint> & items) const
+{
+    std::vector<uint> lifo;
+    if(nodes.front().bbox.intersects_box(b)) lifo.push_back(0);
+
+    while(!lifo.empty())
+    {
+        const SoupOctreeNode & node = nodes.at(lifo.back());
+        lifo.pop_back();
+
+        if(node.is_inner())
+        {
+            for(uint c=node.child_beg; c<node.child_end; ++c)
+            {
+                if(nodes.at(c).bbox.intersects_box(b)) lifo.push_back(c);
+            }
+        }
+        else
+        {
+            for(uint i=node.item_beg; i<node.item_end; ++i)
+            {
+                uint it = leaf_items.at(i);
+                if(soup.aabb(it).intersects_box(b)) items.push_back(it);
+            }
+        }
+    }
+
+    // items spanning multiple leaves are found multiple times
+    std::sort(items.begin(), items.end());
+    items.erase(std::unique(items.begin(), items.end()), items.end());
+}
+
+}
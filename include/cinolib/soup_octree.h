@@ -0,0 +1,199 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_SOUP_OCTREE_H
+#define CINO_SOUP_OCTREE_H
+
+#include <cinolib/geometry/primitive_soup.h>
+#include <cinolib/meshes/meshes.h>
+#include <unordered_set>
+#include <set>
+
+namespace cinolib
+{
+
+class SoupOctreeNode
+{
+    public:
+        AABB bbox;          // tight box containing all the items in the subtree
+        uint child_beg = 0; // children are stored contiguously in SoupOctree::nodes
+        uint child_end = 0;
+        uint item_beg  = 0; // items of a leaf are stored contiguously in SoupOctree::leaf_items
+        uint item_end  = 0;
+        bool is_inner() const { return child_end>child_beg; }
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+/* Octree specialized at compile time on the type of primitive it contains.
+ * Differently from Octree, items are not heap allocated SpatialDataStructureItem,
+ * but live in a homogeneous Soup (PointSoup, SegmentSoup, TriangleSoup, TetSoup,
+ * SphereSoup) and queries do not go through virtual calls. Nodes are stored in a
+ * single flat array, and leaves index a single flat array of items.
+ *
+ * Usage:
+ *
+ *  i)   Create an empty octree
+ *  ii)  Populate o.soup, either pushing copies of the primitives or referencing
+ *       an external vertex array (e.g. the vertices of a mesh)
+ *  iii) Call build to make the tree
+ *
+ * The build_from_mesh_xxx facilities do ii) and iii) in one shot, and reference
+ * the mesh vertices without copying them. The mesh must outlive the octree.
+ * If the mesh deforms (e.g. ARAP, MCF, smoothing), calling refit is enough to
+ * bring the tree up to date, without rebuilding it from scratch.
+ *
+ * Example:
+ *
+ *  SoupOctree<TriangleSoup> o;
+ *  o.build_from_mesh_polys(m);
+ *  vec3d p = o.closest_point(q);
+*/
+
+template<class Soup>
+class SoupOctree
+{
+    public:
+
+        explicit SoupOctree(const uint max_depth      = 7,
+                            const uint items_per_leaf = 50);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void build();
+        void clear();
+
+        // updates the node boxes after the items moved (e.g. because the soup references the
+        // vertices of a mesh that has been deformed), without re-partitioning the tree. Octants
+        // whose traversal cost grew more than max_cost_increase (w.r.t. their last (re)build)
+        // are rebuilt from scratch. Returns the number of rebuilt octants
+        uint refit(const double max_cost_increase = 0.5);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        template<class M, class V, class E, class P>
+        void build_from_mesh_polys(const AbstractPolygonMesh<M,V,E,P> & m);
+
+        template<class M, class V, class E, class F, class P>
+        void build_from_mesh_polys(const AbstractPolyhedralMesh<M,V,E,F,P> & m);
+
+        template<class M, class V, class E, class P>
+        void build_from_mesh_edges(const AbstractMesh<M,V,E,P> & m);
+
+        template<class M, class V, class E, class P>
+        void build_from_mesh_points(const AbstractMesh<M,V,E,P> & m);
+
+        void build_from_vectors(const std::vector<vec3d> & verts,
+                                const std::vector<uint>  & tris);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint   depth()              const { return tree_depth; }
+        uint   num_leaves()         const;
+        uint   max_items_per_leaf() const;
+        size_t memory_in_bytes()    const;
+
+        // expected cost of a query starting at node nid, according to the Surface Area Heuristic
+        double traversal_cost(const uint nid = 0) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        void debug_mode(const bool b);
+
+        // QUERIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // returns pos, id and distance of the item that is closest to query point p
+        void  closest_point(const vec3d & p, uint & id, vec3d & pos, double & d_sqrd) const;
+        vec3d closest_point(const vec3d & p) const;
+
+        // returns respectively the first item and the full list of items containing query point p
+        // note: this query becomes exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
+        bool contains(const vec3d & p, const bool strict, uint & id) const;
+        bool contains(const vec3d & p, const bool strict, std::unordered_set<uint> & ids) const;
+
+        // returns respectively the first and the full list of intersections
+        // between items in the octree and a ray R(t) := p + t * dir
+        bool intersects_ray(const vec3d & p, const vec3d & dir, double & min_t, uint & id) const; // first hit
+        bool intersects_ray(const vec3d & p, const vec3d & dir, const uint skip_id, double & min_t, uint & id) const; // first hit, ignoring item skip_id
+        bool intersects_ray(const vec3d & p, const vec3d & dir, std::set<std::pair<double,uint>> & all_hits) const;
+
+        // note: these queries become exact if CINOLIB_USES_SHEWCHUK_PREDICATES is defined
+        bool intersects_segment (const vec3d s[], const bool ignore_if_valid_complex, std::unordered_set<uint> & ids) const;
+        bool intersects_triangle(const vec3d t[], const bool ignore_if_valid_complex, std::unordered_set<uint> & ids) const;
+
+        // WARNING: this function may return false positives because it only checks intersection
+        // between the box b and the AABB of the items in the tree (see Octree::intersects_box)
+        bool intersects_box(const AABB & b, std::unordered_set<uint> & ids) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        Soup                        soup;       // all items live here
+        std::vector<SoupOctreeNode> nodes;      // nodes[0] is the root. Children always follow their father
+        std::vector<uint>           leaf_items; // indices of soup elements, grouped by leaf
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+    protected:
+
+        // appends to the tree a subtree rooted at node root (at depth root_depth), containing items
+        void split(const uint root, const std::vector<uint> & items, const uint root_depth);
+
+        // removes nodes and leaf items that became unreachable after a partial rebuild
+        void compact();
+
+        // indices (NOT ids!) of the soup elements whose AABB intersects box b
+        void items_intersecting_box(const AABB & b, std::vector<uint> & items) const;
+
+        // recomputes the AABB of each node, bottom up
+        void update_bboxes();
+
+        // i-th child of a cell (same ordering of Octree::subdivide)
+        static AABB octant(const AABB & cell, const int i);
+
+        uint max_depth;      // maximum allowed depth of the tree
+        uint items_per_leaf; // prescribed number of items per leaf (can't go deeper than max_depth anyways)
+        uint tree_depth = 0; // actual depth of the tree
+        bool print_debug_info = false;
+
+        std::vector<double> octant_costs; // traversal cost of the root's children at their last (re)build
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "soup_octree.cpp"
+#endif
+
+#endif // CINO_SOUP_OCTREE_H
@@ -49,12 +49,16 @@ namespace cinolib
 // http://stackoverflow.com/questions/9600801/evenly-distributing-n-points-on-a-sphere
 //
 CINO_INLINE
-void sphere_coverage(const uint n_samples, std::vector<vec3d> & points)
+void sphere_coverage(const uint n_samples, std::vector<vec3d> & points, const bool randomize)
 {
     points.clear();
 
-    srand(unsigned(time(NULL)));
-    double rnd      = rand() * n_samples;
+    double rnd = 0;
+    if(randomize)
+    {
+        srand(unsigned(time(NULL)));
+        rnd = rand() * n_samples;
+    }
     double offset   = 2.0/double(n_samples);
     double increment = M_PI * (3.0 - sqrt(5.0));
 
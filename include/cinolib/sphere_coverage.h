@@ -55,8 +55,12 @@ namespace cinolib
 //    Mathematical Geosciences 42(1) - 2010
 //    Springer
 //
+// By default the lattice is randomly rotated around the Y axis at each call.
+// Set randomize to false to always obtain the same set of points (e.g. to
+// reuse results that were computed and cached on a previous call)
+//
 CINO_INLINE
-void sphere_coverage(const uint n_samples, std::vector<vec3d> & points);
+void sphere_coverage(const uint n_samples, std::vector<vec3d> & points, const bool randomize = true);
 
 }
 
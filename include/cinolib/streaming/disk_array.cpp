@@ -0,0 +1,148 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/streaming/disk_array.h>
+#include <cinolib/streaming/file_io.h>
+#include <algorithm>
+#include <cassert>
+
+namespace cinolib
+{
+
+template<class T>
+CINO_INLINE
+DiskArray<T>::DiskArray(const size_t max_memory, const size_t page_size)
+{
+    items_per_page = std::max(size_t(1), page_size/sizeof(T));
+    max_pages      = std::max(size_t(2), max_memory/(items_per_page*sizeof(T)));
+    f = file_temp("DiskArray()");
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+DiskArray<T>::~DiskArray()
+{
+    if(f) fclose(f);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void DiskArray<T>::resize(const size_t n, const T & fill)
+{
+    assert(n_items==0 && "DiskArray: resize is only supported on empty arrays");
+    fill_value = fill;
+    n_items    = n;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void DiskArray<T>::push_back(const T & item)
+{
+    ++n_items;
+    set(n_items-1, item);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+const T & DiskArray<T>::get(const size_t i)
+{
+    assert(i<n_items);
+    return fetch(i/items_per_page).items[i%items_per_page];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void DiskArray<T>::set(const size_t i, const T & item)
+{
+    assert(i<n_items);
+    Page & p = fetch(i/items_per_page);
+    p.items[i%items_per_page] = item;
+    p.dirty = true;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+typename DiskArray<T>::Page & DiskArray<T>::fetch(const size_t page_id)
+{
+    auto it = cache.find(page_id);
+    if(it!=cache.end())
+    {
+        lru.splice(lru.begin(), lru, it->second);
+        return lru.front();
+    }
+
+    // recycle the least recently used page, if the cache is full
+    if(cache.size()>=max_pages)
+    {
+        Page & old = lru.back();
+        if(old.dirty)
+        {
+            file_seek(f, int64_t(old.id*items_per_page*sizeof(T)), SEEK_SET, "DiskArray::fetch()");
+            file_write(f, old.items.data(), sizeof(T), items_per_page, "DiskArray::fetch()");
+            if(on_disk.size()<=old.id) on_disk.resize(old.id+1, false);
+            on_disk[old.id] = true;
+        }
+        cache.erase(old.id);
+        lru.splice(lru.begin(), lru, std::prev(lru.end()));
+    }
+    else lru.emplace_front();
+
+    Page & p = lru.front();
+    p.id     = page_id;
+    p.dirty  = false;
+    p.items.resize(items_per_page);
+    if(page_id<on_disk.size() && on_disk[page_id])
+    {
+        file_seek(f, int64_t(page_id*items_per_page*sizeof(T)), SEEK_SET, "DiskArray::fetch()");
+        file_read(f, p.items.data(), sizeof(T), items_per_page, "DiskArray::fetch()");
+    }
+    else std::fill(p.items.begin(), p.items.end(), fill_value);
+    cache[page_id] = lru.begin();
+    return p;
+}
+
+}
@@ -0,0 +1,112 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_DISK_ARRAY_H
+#define CINO_DISK_ARRAY_H
+
+#include <cinolib/cino_inline.h>
+#include <cstdio>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Array of trivially copyable items that lives in an anonymous temporary
+ * file, accessed through a bounded cache of fixed size pages. This is the
+ * building block of out-of-core algorithms: it offers random access to
+ * arrays much larger than the available memory, and it is efficient when
+ * accesses are spatially coherent (e.g. mesh elements sorted along a space
+ * filling curve). Pages are evicted in least recently used order, and only
+ * written back to disk if they were modified.
+ *
+ * The array can grow either one item at a time (push_back), or all at once
+ * (resize). In the latter case items that are never written are equal to the
+ * fill value, and take no space on disk. The temporary file is deleted when
+ * the array is destroyed.
+ *
+ * NOTE: this class is not thread safe, not even for reading.
+*/
+
+template<class T>
+class DiskArray
+{
+    public:
+
+        explicit DiskArray(const size_t max_memory = 64<<20, // bytes used for caching
+                           const size_t page_size  = 1<<16); // bytes
+        ~DiskArray();
+
+        DiskArray(const DiskArray &) = delete;
+        DiskArray & operator=(const DiskArray &) = delete;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        size_t size() const { return n_items; }
+        void   resize(const size_t n, const T & fill = T()); // only on empty arrays
+        void   push_back(const T & item);
+
+        const T & get(const size_t i);
+        void      set(const size_t i, const T & item);
+
+    protected:
+
+        struct Page
+        {
+            size_t         id;
+            bool           dirty;
+            std::vector<T> items;
+        };
+
+        Page & fetch(const size_t page_id);
+
+        FILE                                                          *f = nullptr;
+        size_t                                                         n_items = 0;
+        size_t                                                         items_per_page;
+        size_t                                                         max_pages;
+        T                                                              fill_value = T();
+        std::vector<bool>                                              on_disk; // pages written to disk at least once
+        std::list<Page>                                                lru;     // most recently used first
+        std::unordered_map<size_t,typename std::list<Page>::iterator> cache;
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "disk_array.cpp"
+#endif
+
+#endif // CINO_DISK_ARRAY_H
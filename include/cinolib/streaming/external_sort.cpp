@@ -0,0 +1,172 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/streaming/external_sort.h>
+#include <cinolib/streaming/file_io.h>
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+namespace cinolib
+{
+
+template<class T>
+CINO_INLINE
+RecordReader<T>::RecordReader(FILE *f, const int64_t offset, const size_t n, const size_t buffer_size)
+    : f(f)
+    , offset(offset)
+    , n_left(n)
+    , buf_cap(std::max(size_t(1), buffer_size/sizeof(T)))
+{}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+const T & RecordReader<T>::top()
+{
+    if(pos==buf.size()) refill();
+    assert(pos<buf.size());
+    return buf[pos];
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void RecordReader<T>::pop()
+{
+    if(pos==buf.size()) refill();
+    ++pos;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T>
+CINO_INLINE
+void RecordReader<T>::refill()
+{
+    size_t n = std::min(n_left, buf_cap);
+    buf.resize(n);
+    file_seek(f, offset, SEEK_SET, "RecordReader::refill()");
+    file_read(f, buf.data(), sizeof(T), n, "RecordReader::refill()");
+    offset += int64_t(n*sizeof(T));
+    n_left -= n;
+    pos     = 0;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class T, class Compare>
+CINO_INLINE
+size_t external_sort(FILE          *in,
+                     FILE          *out,
+                     const Compare  cmp,
+                     const size_t   max_memory)
+{
+    file_seek(in, 0, SEEK_END, "external_sort()");
+    size_t n = size_t(file_tell(in, "external_sort()"))/sizeof(T);
+    rewind(in);
+    rewind(out);
+
+    size_t run_size = std::max(size_t(1024), max_memory/sizeof(T));
+    if(n<=run_size)
+    {
+        std::vector<T> items(n);
+        file_read(in, items.data(), sizeof(T), n, "external_sort()");
+        std::sort(items.begin(), items.end(), cmp);
+        file_write(out, items.data(), sizeof(T), n, "external_sort()");
+        fflush(out);
+        return n;
+    }
+
+    // sorted runs, all stored in the same temporary file
+    FILE *runs = file_temp("external_sort()");
+    std::vector<size_t> run_beg;
+    {
+        std::vector<T> items;
+        for(size_t beg=0; beg<n; beg+=run_size)
+        {
+            items.resize(std::min(run_size, n-beg));
+            file_read(in, items.data(), sizeof(T), items.size(), "external_sort()");
+            std::sort(items.begin(), items.end(), cmp);
+            file_write(runs, items.data(), sizeof(T), items.size(), "external_sort()");
+            run_beg.push_back(beg);
+        }
+    }
+    run_beg.push_back(n);
+    fflush(runs);
+
+    // k-way merge. Memory is split evenly among the input buffers
+    uint   k       = uint(run_beg.size()-1);
+    size_t buf_mem = std::max(size_t(4096), max_memory/(k+1));
+    std::vector<RecordReader<T>> readers;
+    for(uint i=0; i<k; ++i)
+    {
+        readers.emplace_back(runs, int64_t(run_beg[i]*sizeof(T)), run_beg[i+1]-run_beg[i], buf_mem);
+    }
+    auto greater = [&](const uint a, const uint b)
+    {
+        const T & ta = readers[a].top();
+        const T & tb = readers[b].top();
+        if(cmp(ta,tb)) return false;
+        if(cmp(tb,ta)) return true;
+        return a>b; // stable w.r.t. run order
+    };
+    std::priority_queue<uint,std::vector<uint>,decltype(greater)> q(greater);
+    for(uint i=0; i<k; ++i) if(!readers[i].eof()) q.push(i);
+
+    std::vector<T> out_buf;
+    out_buf.reserve(std::max(size_t(1), buf_mem/sizeof(T)));
+    while(!q.empty())
+    {
+        uint i = q.top();
+        q.pop();
+        out_buf.push_back(readers[i].top());
+        if(out_buf.size()==out_buf.capacity())
+        {
+            file_write(out, out_buf.data(), sizeof(T), out_buf.size(), "external_sort()");
+            out_buf.clear();
+        }
+        readers[i].pop();
+        if(!readers[i].eof()) q.push(i);
+    }
+    file_write(out, out_buf.data(), sizeof(T), out_buf.size(), "external_sort()");
+    fflush(out);
+    fclose(runs);
+    return n;
+}
+
+}
@@ -0,0 +1,96 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_EXTERNAL_SORT_H
+#define CINO_EXTERNAL_SORT_H
+
+#include <cinolib/cino_inline.h>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Buffered sequential reader of fixed size records (trivially copyable items)
+ * stored in a binary file, starting at a given offset. It reads at most n records.
+*/
+
+template<class T>
+class RecordReader
+{
+    public:
+
+        RecordReader(FILE *f, const int64_t offset, const size_t n, const size_t buffer_size = 1<<16); // bytes
+
+        bool      eof() const { return pos==buf.size() && n_left==0; }
+        const T & top();  // current record (requires !eof())
+        void      pop();  // move to the next record
+
+    protected:
+
+        void refill();
+
+        FILE          *f;
+        int64_t        offset; // of the next record to read from file
+        size_t         n_left; // records still on file
+        size_t         pos = 0;
+        std::vector<T> buf;
+        size_t         buf_cap;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+/* Sorts the records (trivially copyable items) contained in file in, writing
+ * them in file out, using at most max_memory bytes. Records are first sorted
+ * in runs that fit in memory, then runs are merged with a k-way merge. Both
+ * files are read/written from their beginning, in binary mode. Returns the
+ * number of records.
+*/
+
+template<class T, class Compare>
+CINO_INLINE
+size_t external_sort(FILE          *in,
+                     FILE          *out,
+                     const Compare  cmp,
+                     const size_t   max_memory);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "external_sort.cpp"
+#endif
+
+#endif // CINO_EXTERNAL_SORT_H
@@ -0,0 +1,143 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/streaming/file_io.h>
+#include <cstdlib>
+#include <iostream>
+#ifndef _WIN32
+#include <sys/types.h>
+#endif
+
+namespace cinolib
+{
+
+CINO_INLINE
+void file_seek(FILE *f, const int64_t offset, const int origin, const char *caller)
+{
+#ifdef _WIN32
+    int err = _fseeki64(f, offset, origin);
+#else
+    int err = fseeko(f, off_t(offset), origin);
+#endif
+    if(err!=0)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : seek failed" << std::endl;
+        exit(-1);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+int64_t file_tell(FILE *f, const char *caller)
+{
+#ifdef _WIN32
+    int64_t pos = _ftelli64(f);
+#else
+    int64_t pos = int64_t(ftello(f));
+#endif
+    if(pos<0)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : tell failed" << std::endl;
+        exit(-1);
+    }
+    return pos;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void file_read(FILE *f, void *data, const size_t size, const size_t n, const char *caller)
+{
+    if(n>0 && fread(data, size, n, f)!=n)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : read failed" << std::endl;
+        exit(-1);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void file_write(FILE *f, const void *data, const size_t size, const size_t n, const char *caller)
+{
+    if(n>0 && fwrite(data, size, n, f)!=n)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : write failed (disk full?)" << std::endl;
+        exit(-1);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+FILE *file_open(const char *filename, const char *mode, const char *caller)
+{
+    FILE *f = fopen(filename, mode);
+    if(!f)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : couldn't open file " << filename << std::endl;
+        exit(-1);
+    }
+    return f;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+FILE *file_temp(const char *caller)
+{
+    FILE *f = tmpfile();
+    if(!f)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : couldn't create temporary file" << std::endl;
+        exit(-1);
+    }
+    return f;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void file_close(FILE *f, const char *caller)
+{
+    if(fclose(f)!=0)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : " << caller << " : write failed (disk full?)" << std::endl;
+        exit(-1);
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_FILE_IO_H
+#define CINO_FILE_IO_H
+
+#include <cinolib/cino_inline.h>
+#include <cstdint>
+#include <cstdio>
+
+namespace cinolib
+{
+
+/* Thin wrappers around the C file API used by the out-of-core algorithms.
+ * Seek/tell use 64 bit offsets on all platforms (files larger than 2GB are
+ * the norm here). All other functions report the failure, referring to the
+ * calling routine (caller), and terminate the program, as there is no way to
+ * recover from a failed read/write in the middle of a streamed pass.
+*/
+
+CINO_INLINE
+void file_seek(FILE *f, const int64_t offset, const int origin, const char *caller);
+
+CINO_INLINE
+int64_t file_tell(FILE *f, const char *caller);
+
+CINO_INLINE
+void file_read(FILE *f, void *data, const size_t size, const size_t n, const char *caller);
+
+CINO_INLINE
+void file_write(FILE *f, const void *data, const size_t size, const size_t n, const char *caller);
+
+CINO_INLINE
+FILE *file_open(const char *filename, const char *mode, const char *caller);
+
+CINO_INLINE
+FILE *file_temp(const char *caller); // anonymous file, deleted on fclose
+
+CINO_INLINE
+void file_close(FILE *f, const char *caller); // flushes pending writes
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "file_io.cpp"
+#endif
+
+#endif // CINO_FILE_IO_H
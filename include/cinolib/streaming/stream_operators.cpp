@@ -0,0 +1,456 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/streaming/stream_operators.h>
+#include <cinolib/streaming/file_io.h>
+#include <cinolib/geometry/triangle_utils.h>
+#include <cinolib/standard_elements_tables.h>
+#include <cinolib/marching_tets.h>
+#include <cinolib/quality_tet.h>
+#include <cinolib/string_utilities.h>
+#include <cinolib/min_max_inf.h>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <unordered_map>
+
+namespace cinolib
+{
+
+CINO_INLINE
+void stream_vert_normals(const StreamedMesh                                     & m,
+                         const std::function<void(const uint, const vec3d &)>  & callback)
+{
+    assert(m.simplex_size()==3);
+    MeshChunk c;
+    std::vector<vec3d> n;
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        m.load_chunk(cid, c);
+        n.assign(c.n_owned_verts, vec3d(0,0,0));
+        for(uint eid=0; eid<c.num_elems(); ++eid)
+        {
+            vec3d tn = triangle_normal(c.elem_vert(eid,0), c.elem_vert(eid,1), c.elem_vert(eid,2));
+            for(uint i=0; i<3; ++i)
+            {
+                uint vid = c.elem_vert_id(eid,i);
+                if(vid<c.n_owned_verts) n[vid] += tn;
+            }
+        }
+        for(uint vid=0; vid<c.n_owned_verts; ++vid)
+        {
+            n[vid].normalize();
+            callback(c.vert_gid[vid], n[vid]);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_poly_quality(const StreamedMesh                                     & m,
+                         const std::function<double(const vec3d *)>            & quality,
+                         const std::function<void(const uint, const double)>   & callback)
+{
+    MeshChunk c;
+    vec3d p[4];
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        m.load_chunk(cid, c);
+        for(uint eid=0; eid<c.n_owned_elems; ++eid)
+        {
+            for(uint i=0; i<c.simplex_size; ++i) p[i] = c.elem_vert(eid,i);
+            callback(c.elem_gid[eid], quality(p));
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_poly_quality(const StreamedMesh                                     & m,
+                         const std::function<void(const uint, const double)>   & callback)
+{
+    assert(m.simplex_size()==4);
+    stream_poly_quality(m, [](const vec3d *p)
+    {
+        return tet_scaled_jacobian(p[0], p[1], p[2], p[3]);
+    }, callback);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void chunk_adjacency(const MeshChunk & c, std::vector<uint> & adj)
+{
+    struct Facet { std::array<uint,3> key; uint eid; uint off; };
+
+    uint nf = c.simplex_size;
+    std::vector<Facet> facets;
+    facets.reserve(c.num_elems()*nf);
+    for(uint eid=0; eid<c.num_elems(); ++eid)
+    for(uint off=0; off<nf; ++off)
+    {
+        Facet f;
+        if(nf==4) f.key = { c.vert_gid[c.elem_vert_id(eid,TET_FACES[off][0])],
+                            c.vert_gid[c.elem_vert_id(eid,TET_FACES[off][1])],
+                            c.vert_gid[c.elem_vert_id(eid,TET_FACES[off][2])] };
+        else      f.key = { c.vert_gid[c.elem_vert_id(eid,TRI_EDGES[off][0])],
+                            c.vert_gid[c.elem_vert_id(eid,TRI_EDGES[off][1])], 0 };
+        if(f.key[0]>f.key[1]) std::swap(f.key[0], f.key[1]);
+        if(nf==4 && f.key[1]>f.key[2]) std::swap(f.key[1], f.key[2]);
+        if(nf==4 && f.key[0]>f.key[1]) std::swap(f.key[0], f.key[1]);
+        f.eid = eid;
+        f.off = off;
+        facets.push_back(f);
+    }
+    std::sort(facets.begin(), facets.end(), [](const Facet & a, const Facet & b)
+    {
+        return (a.key!=b.key) ? a.key<b.key : a.eid<b.eid;
+    });
+
+    adj.assign(c.n_owned_elems*nf, max_uint);
+    for(size_t i=0; i+1<facets.size(); ++i)
+    {
+        const Facet & a = facets[i];
+        const Facet & b = facets[i+1];
+        if(a.key!=b.key) continue;
+        if(a.eid<c.n_owned_elems) adj[a.eid*nf+a.off] = b.eid;
+        if(b.eid<c.n_owned_elems) adj[b.eid*nf+b.off] = a.eid;
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_export_surface(const StreamedMesh       & m,
+                                 StreamedSoupWriter & out)
+{
+    assert(out.arity()==m.simplex_size()-1);
+    MeshChunk c;
+    std::vector<uint> adj;
+    uint64_t keys[3];
+    vec3d    pos[3];
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        m.load_chunk(cid, c);
+        chunk_adjacency(c, adj);
+        for(uint eid=0; eid<c.n_owned_elems; ++eid)
+        for(uint off=0; off<c.simplex_size; ++off)
+        {
+            if(adj[eid*c.simplex_size+off]!=max_uint) continue;
+            for(uint i=0; i<out.arity(); ++i)
+            {
+                uint vid = c.elem_vert_id(eid, (c.simplex_size==4) ? TET_FACES[off][i] : TRI_EDGES[off][i]);
+                keys[i]  = c.vert_gid[vid];
+                pos[i]   = c.verts[vid];
+            }
+            out.add(keys, pos);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void chunk_marching_tets(const MeshChunk           & c,
+                         const std::vector<double> & f,
+                         const double                isovalue,
+                               StreamedSoupWriter  & out)
+{
+    assert(c.simplex_size==4 && out.arity()==3);
+
+    // configurations of all the elements (the halo ones are
+    // necessary to filter triangles lying on tet faces)
+    std::vector<unsigned char> conf(c.num_elems());
+    std::vector<bool>          swapped(c.num_elems());
+    for(uint eid=0; eid<c.num_elems(); ++eid)
+    {
+        double func[] =
+        {
+            f[c.elem_vert_id(eid,0)],
+            f[c.elem_vert_id(eid,1)],
+            f[c.elem_vert_id(eid,2)],
+            f[c.elem_vert_id(eid,3)]
+        };
+        bool s;
+        conf[eid]    = marching_tets_config(isovalue, func, s);
+        swapped[eid] = s;
+    }
+
+    std::vector<uint> adj;
+    chunk_adjacency(c, adj);
+
+    std::array<uint,3> tris[2];
+    uint64_t keys[3];
+    vec3d    pos[3];
+    for(uint eid=0; eid<c.n_owned_elems; ++eid)
+    {
+        uint vids[] =
+        {
+            c.elem_vert_id(eid,0),
+            c.elem_vert_id(eid,1),
+            c.elem_vert_id(eid,2),
+            c.elem_vert_id(eid,3)
+        };
+        double func[] = { f[vids[0]], f[vids[1]], f[vids[2]], f[vids[3]] };
+
+        // as in marching_tets, tie breaks use (global) element ids
+        bool defer[4];
+        for(uint i=0; i<4; ++i)
+        {
+            uint a   = adj[eid*4+i];
+            defer[i] = (a!=max_uint && c.elem_gid[eid]<c.elem_gid[a] && conf[a]!=0xF);
+        }
+        unsigned char conf_eid = marching_tets_filter(conf[eid], isovalue, func, defer);
+
+        uint n = marching_tets_triangles(conf_eid, swapped[eid], tris);
+        for(uint t=0; t<n; ++t)
+        {
+            for(uint i=0; i<3; ++i)
+            {
+                uint   v_a = vids[TET_EDGES[tris[t][i]][0]];
+                uint   v_b = vids[TET_EDGES[tris[t][i]][1]];
+                double f_a = func[TET_EDGES[tris[t][i]][0]];
+                double f_b = func[TET_EDGES[tris[t][i]][1]];
+                if(f_a < f_b)
+                {
+                    std::swap(v_a, v_b);
+                    std::swap(f_a, f_b);
+                }
+                double alpha = (isovalue - f_a) / (f_b - f_a);
+                pos[i] = (1.0 - alpha) * c.verts[v_a] + alpha * c.verts[v_b];
+
+                uint64_t g_a = c.vert_gid[v_a];
+                uint64_t g_b = c.vert_gid[v_b];
+                keys[i] = (std::min(g_a,g_b) << 32) | std::max(g_a,g_b);
+            }
+            out.add(keys, pos);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_marching_tets(const StreamedMesh                                          & m,
+                          const std::function<double(const uint, const vec3d &)>     & field,
+                          const double                                                 isovalue,
+                                StreamedSoupWriter                                   & out)
+{
+    assert(m.simplex_size()==4);
+    MeshChunk c;
+    std::vector<double> f;
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        m.load_chunk(cid, c);
+        f.resize(c.num_verts());
+        for(uint vid=0; vid<c.num_verts(); ++vid) f[vid] = field(c.vert_gid[vid], c.verts[vid]);
+        chunk_marching_tets(c, f, isovalue, out);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_slice(const StreamedMesh       & m,
+                  const Plane              & p,
+                        StreamedSoupWriter & out)
+{
+    assert(out.arity()==m.simplex_size()-1);
+    MeshChunk c;
+    std::vector<double> f;
+    uint64_t keys[2];
+    vec3d    pos[2];
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        // skip chunks that are entirely on one side of the plane
+        double d_min =  inf_double;
+        double d_max = -inf_double;
+        for(const vec3d & corner : m.chunk_bbox(cid).corners())
+        {
+            double d = p.point_plane_dist_signed(corner);
+            d_min = std::min(d_min, d);
+            d_max = std::max(d_max, d);
+        }
+        if(d_min>0 || d_max<0) continue;
+
+        m.load_chunk(cid, c);
+        f.resize(c.num_verts());
+        for(uint vid=0; vid<c.num_verts(); ++vid) f[vid] = p.point_plane_dist_signed(c.verts[vid]);
+
+        if(c.simplex_size==4)
+        {
+            chunk_marching_tets(c, f, 0, out);
+            continue;
+        }
+
+        // triangles: a segment for each triangle with one vertex on a side of the plane
+        // and two on the other side. Points that coincide with a mesh vertex are keyed
+        // by that vertex (so that they are welded), the others by the edge they lie on
+        for(uint eid=0; eid<c.n_owned_elems; ++eid)
+        {
+            uint n = 0;
+            for(uint i=0; i<3 && n<2; ++i)
+            {
+                uint   v_a = c.elem_vert_id(eid, TRI_EDGES[i][0]);
+                uint   v_b = c.elem_vert_id(eid, TRI_EDGES[i][1]);
+                double f_a = f[v_a];
+                double f_b = f[v_b];
+                if((f_a>0)==(f_b>0)) continue;
+                if(f_a<f_b)
+                {
+                    std::swap(v_a, v_b);
+                    std::swap(f_a, f_b);
+                }
+                uint64_t g_a = c.vert_gid[v_a];
+                uint64_t g_b = c.vert_gid[v_b];
+                if(f_b==0)
+                {
+                    pos[n]  = c.verts[v_b];
+                    keys[n] = (g_b << 32) | g_b;
+                }
+                else
+                {
+                    double alpha = f_a / (f_a - f_b);
+                    pos[n]  = (1.0 - alpha) * c.verts[v_a] + alpha * c.verts[v_b];
+                    keys[n] = (std::min(g_a,g_b) << 32) | std::max(g_a,g_b);
+                }
+                ++n;
+            }
+            if(n==2) out.add(keys, pos);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_clip(const StreamedMesh       & m,
+                 const Plane              & p,
+                       StreamedSoupWriter & out)
+{
+    assert(out.arity()==m.simplex_size());
+    MeshChunk c;
+    uint64_t keys[4];
+    vec3d    pos[4];
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        double d_min =  inf_double;
+        double d_max = -inf_double;
+        for(const vec3d & corner : m.chunk_bbox(cid).corners())
+        {
+            double d = p.point_plane_dist_signed(corner);
+            d_min = std::min(d_min, d);
+            d_max = std::max(d_max, d);
+        }
+        if(d_max<=0) continue;
+        bool keep_all = (d_min>0);
+
+        m.load_chunk(cid, c);
+        for(uint eid=0; eid<c.n_owned_elems; ++eid)
+        {
+            vec3d centroid(0,0,0);
+            for(uint i=0; i<c.simplex_size; ++i)
+            {
+                uint vid = c.elem_vert_id(eid,i);
+                keys[i]  = c.vert_gid[vid];
+                pos[i]   = c.verts[vid];
+                centroid += pos[i];
+            }
+            centroid /= double(c.simplex_size);
+            if(keep_all || p.point_plane_dist_signed(centroid)>0) out.add(keys, pos);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void stream_convert(const StreamedMesh & m,
+                    const char         * filename)
+{
+    std::string ext = get_file_extension(filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if((ext!="obj" && ext!="off" && ext!="mesh") || (m.simplex_size()==4 && ext!="mesh"))
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : stream_convert() : unsupported format " << ext << std::endl;
+        exit(-1);
+    }
+
+    setlocale(LC_NUMERIC, "en_US.UTF-8"); // makes sure "." is the decimal separator
+
+    FILE *fp = file_open(filename, "w", "stream_convert()");
+
+    if(ext=="off") fprintf(fp, "OFF\n%u %u 0\n", m.num_verts(), m.num_elems());
+    if(ext=="mesh") fprintf(fp, "MeshVersionFormatted 1\nDimension 3\nVertices\n%u\n", m.num_verts());
+
+    // owned vertices (elements) of chunk i come right after the ones of chunk i-1,
+    // hence it suffices to visit the chunks in order, first for vertices and then
+    // for elements
+    MeshChunk c;
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        m.load_chunk(cid, c);
+        for(uint vid=0; vid<c.n_owned_verts; ++vid)
+        {
+            const vec3d & p = c.verts[vid];
+            if(ext=="obj")  fprintf(fp, "v %.17g %.17g %.17g\n", p[0], p[1], p[2]); else
+            if(ext=="off")  fprintf(fp, "%.17g %.17g %.17g\n",   p[0], p[1], p[2]); else
+            if(ext=="mesh") fprintf(fp, "%.17g %.17g %.17g 0\n", p[0], p[1], p[2]);
+        }
+    }
+
+    if(ext=="mesh") fprintf(fp, "%s\n%u\n", (m.simplex_size()==4) ? "Tetrahedra" : "Triangles", m.num_elems());
+    for(uint cid=0; cid<m.num_chunks(); ++cid)
+    {
+        m.load_chunk(cid, c);
+        for(uint eid=0; eid<c.n_owned_elems; ++eid)
+        {
+            if(ext=="obj") fprintf(fp, "f");
+            if(ext=="off") fprintf(fp, "3");
+            for(uint i=0; i<c.simplex_size; ++i)
+            {
+                uint vid = c.vert_gid[c.elem_vert_id(eid,i)];
+                fprintf(fp, " %u", (ext=="off") ? vid : vid+1);
+            }
+            fprintf(fp, (ext=="mesh") ? " 0\n" : "\n");
+        }
+    }
+    if(ext=="mesh") fprintf(fp, "End\n");
+    file_close(fp, "stream_convert()");
+}
+
+}
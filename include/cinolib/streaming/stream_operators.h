@@ -0,0 +1,158 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_STREAM_OPERATORS_H
+#define CINO_STREAM_OPERATORS_H
+
+#include <cinolib/streaming/streamed_mesh.h>
+#include <cinolib/streaming/streamed_soup_writer.h>
+#include <cinolib/geometry/plane.h>
+#include <functional>
+
+namespace cinolib
+{
+
+/* Out-of-core counterparts of a few common mesh processing operators. They all
+ * work on a StreamedMesh (see streamed_mesh.h) and process one chunk at a time,
+ * hence the peak memory is bounded by the size of the largest chunk (plus the
+ * buffers of the output writer, if any). Per element and per vertex results are
+ * returned through callbacks that receive global ids, and are called exactly
+ * once for each element/vertex. Results that are meshes are sent to an out-of-core
+ * writer, which welds vertices shared among chunks.
+ *
+ * Results match the ones obtained with the in-core operators of the library
+ * on the same mesh, up to vertex and element ordering.
+*/
+
+// per vertex normals of a triangle mesh, computed as in Trimesh::update_v_normal
+//
+CINO_INLINE
+void stream_vert_normals(const StreamedMesh                                     & m,
+                         const std::function<void(const uint, const vec3d &)>  & callback); // (vert gid, normal)
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// per element quality, according to any metric that depends on the element
+// vertices only. The second version uses the scaled jacobian of tetrahedra
+//
+CINO_INLINE
+void stream_poly_quality(const StreamedMesh                                     & m,
+                         const std::function<double(const vec3d *)>            & quality,   // simplex_size() points
+                         const std::function<void(const uint, const double)>   & callback); // (elem gid, quality)
+
+CINO_INLINE
+void stream_poly_quality(const StreamedMesh                                     & m,
+                         const std::function<void(const uint, const double)>   & callback);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// boundary of the mesh, i.e. triangles for tetmeshes (oriented outwards, as in
+// export_surface) and segments for trimeshes. Output vertices are the input
+// ones, identified by their global ids
+//
+CINO_INLINE
+void stream_export_surface(const StreamedMesh       & m,
+                                 StreamedSoupWriter & out); // arity: simplex_size()-1
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// iso-surface of a scalar field defined at the vertices of a tetmesh, extracted
+// as in marching_tets. The field is evaluated once for each vertex of each chunk
+// (halo vertices are evaluated in multiple chunks), hence it should be cheap.
+// Output vertices are identified by the (global) edge they lie on
+//
+CINO_INLINE
+void stream_marching_tets(const StreamedMesh                                          & m,
+                          const std::function<double(const uint, const vec3d &)>     & field, // (vert gid, pos)
+                          const double                                                 isovalue,
+                                StreamedSoupWriter                                   & out);  // arity: 3
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// intersection between the mesh and a plane: triangles for tetmeshes (i.e.
+// marching tets on the signed distance from the plane), segments for trimeshes.
+// Chunks that do not intersect the plane are skipped
+//
+CINO_INLINE
+void stream_slice(const StreamedMesh       & m,
+                  const Plane              & p,
+                        StreamedSoupWriter & out); // arity: simplex_size()-1
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// elements whose centroid lies on the positive side of the plane (i.e. the
+// one the plane normal points to). Chunks that entirely lie on one side of
+// the plane are either skipped or copied without per element tests
+//
+CINO_INLINE
+void stream_clip(const StreamedMesh       & m,
+                 const Plane              & p,
+                       StreamedSoupWriter & out); // arity: simplex_size()
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// writes the mesh in a standard format (OBJ, OFF for trimeshes, MESH for
+// both), with vertices and elements in global id order
+//
+CINO_INLINE
+void stream_convert(const StreamedMesh & m,
+                    const char         * filename);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// marching tets on the owned elements of a chunk, with the field sampled at
+// the chunk vertices (owned and halo)
+//
+CINO_INLINE
+void chunk_marching_tets(const MeshChunk           & c,
+                         const std::vector<double> & f,
+                         const double                isovalue,
+                               StreamedSoupWriter  & out);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// for each facet of each owned element, the (local) element adjacent through
+// it, or max_uint if none. Facets are ordered as in TET_FACES/TRI_EDGES
+//
+CINO_INLINE
+void chunk_adjacency(const MeshChunk & c, std::vector<uint> & adj);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "stream_operators.cpp"
+#endif
+
+#endif // CINO_STREAM_OPERATORS_H
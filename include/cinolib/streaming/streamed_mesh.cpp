@@ -0,0 +1,529 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/streaming/streamed_mesh.h>
+#include <cinolib/streaming/disk_array.h>
+#include <cinolib/streaming/external_sort.h>
+#include <cinolib/streaming/file_io.h>
+#include <cinolib/string_utilities.h>
+#include <cinolib/min_max_inf.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+namespace cinolib
+{
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+void MeshChunk::to_mesh(Trimesh<M,V,E,P> & m) const
+{
+    assert(simplex_size==3);
+    m = Trimesh<M,V,E,P>(verts, elems);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+void MeshChunk::to_mesh(Tetmesh<M,V,E,F,P> & m) const
+{
+    assert(simplex_size==4);
+    m = Tetmesh<M,V,E,F,P>(verts, elems);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+StreamedMesh::StreamedMesh(const char * filename)
+{
+    f = file_open(filename, "rb", "StreamedMesh()");
+    Header h;
+    if(fread(&header, sizeof(Header), 1, f)!=1 || memcmp(header.magic, h.magic, 8)!=0)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : StreamedMesh() : " << filename << " is not a streamed mesh" << std::endl;
+        exit(-1);
+    }
+    table.resize(header.num_chunks);
+    file_seek(f, int64_t(header.table_offset), SEEK_SET, "StreamedMesh()");
+    file_read(f, table.data(), sizeof(ChunkInfo), table.size(), "StreamedMesh()");
+    for(const ChunkInfo & c : table)
+    {
+        chunk_bb.push_back(AABB(vec3d(c.bbox[0], c.bbox[1], c.bbox[2]), vec3d(c.bbox[3], c.bbox[4], c.bbox[5])));
+        bb.push(chunk_bb.back());
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+StreamedMesh::~StreamedMesh()
+{
+    if(f) fclose(f);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void StreamedMesh::load_chunk(const uint cid, MeshChunk & chunk) const
+{
+    const ChunkInfo & c = table.at(cid);
+    uint nv = c.n_owned_verts + c.n_halo_verts;
+    uint ne = c.n_owned_elems + c.n_halo_elems;
+
+    chunk.id            = cid;
+    chunk.simplex_size  = header.simplex_size;
+    chunk.n_owned_verts = c.n_owned_verts;
+    chunk.n_owned_elems = c.n_owned_elems;
+    chunk.verts.resize(nv);
+    chunk.vert_gid.resize(nv);
+    chunk.elems.resize(ne*header.simplex_size);
+    chunk.elem_gid.resize(ne);
+
+    for(uint i=0; i<c.n_owned_verts; ++i) chunk.vert_gid[i] = c.first_vert+i;
+    for(uint i=0; i<c.n_owned_elems; ++i) chunk.elem_gid[i] = c.first_elem+i;
+
+    std::vector<double> xyz(3*nv);
+    file_seek(f, int64_t(c.offset), SEEK_SET, "StreamedMesh::load_chunk()");
+    file_read(f, chunk.vert_gid.data()+c.n_owned_verts, sizeof(uint),   c.n_halo_verts,     "StreamedMesh::load_chunk()");
+    file_read(f, xyz.data(),                            sizeof(double), xyz.size(),         "StreamedMesh::load_chunk()");
+    file_read(f, chunk.elem_gid.data()+c.n_owned_elems, sizeof(uint),   c.n_halo_elems,     "StreamedMesh::load_chunk()");
+    file_read(f, chunk.elems.data(),                    sizeof(uint),   chunk.elems.size(), "StreamedMesh::load_chunk()");
+
+    for(uint i=0; i<nv; ++i) chunk.verts[i] = vec3d(xyz[3*i], xyz[3*i+1], xyz[3*i+2]);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint64_t morton_code(const vec3d & p, const AABB & b)
+{
+    auto spread = [](uint64_t x)
+    {
+        x &= 0x1FFFFF;
+        x = (x | x << 32) & 0x1F00000000FFFF;
+        x = (x | x << 16) & 0x1F0000FF0000FF;
+        x = (x | x <<  8) & 0x100F00F00F00F00F;
+        x = (x | x <<  4) & 0x10C30C30C30C30C3;
+        x = (x | x <<  2) & 0x1249249249249249;
+        return x;
+    };
+    uint64_t code = 0;
+    for(uint i=0; i<3; ++i)
+    {
+        double   d = b.max[i]-b.min[i];
+        double   t = (d>0) ? (p[i]-b.min[i])/d : 0.0;
+        uint64_t q = uint64_t(std::min(std::max(t,0.0),1.0) * double(0x1FFFFF));
+        code |= spread(q) << i;
+    }
+    return code;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void make_streamed_mesh(const char          * input_filename,
+                        const char          * output_filename,
+                        const StreamOptions & opt)
+{
+    struct Elem       { uint64_t key; uint id; uint v[4]; };
+    struct Incidence  { uint vid; uint chunk; uint elem; };
+    struct Halo       { uint chunk; uint elem; };
+
+    size_t mem = std::max(opt.max_memory, size_t(16)<<20);
+
+    setlocale(LC_NUMERIC, "en_US.UTF-8"); // makes sure "." is the decimal separator
+
+    FILE *in = file_open(input_filename, "r", "make_streamed_mesh()");
+
+    // 1) parse the input file, one line at a time. Coordinates go into a disk
+    //    backed array, elements are appended to a temporary file (tris and tets
+    //    are kept separate, as MESH files may contain both)
+    DiskArray<vec3d> coords(mem/8);
+    FILE *tris = file_temp("make_streamed_mesh()");
+    FILE *tets = file_temp("make_streamed_mesh()");
+    size_t n_tris = 0, n_tets = 0;
+    AABB   bb;
+
+    auto add_poly = [&](const std::vector<uint> & p)
+    {
+        Elem e;
+        e.key  = 0;
+        e.v[3] = 0;
+        for(uint i=2; i<p.size(); ++i) // triangle fan
+        {
+            e.id   = uint(n_tris++);
+            e.v[0] = p[0];
+            e.v[1] = p[i-1];
+            e.v[2] = p[i];
+            file_write(tris, &e, sizeof(Elem), 1, "make_streamed_mesh()");
+        }
+    };
+
+    std::string ext = get_file_extension(input_filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    char line[4096];
+    if(ext=="obj")
+    {
+        while(fgets(line, sizeof(line), in))
+        {
+            if(line[0]=='v' && line[1]==' ')
+            {
+                vec3d p;
+                if(sscanf(line+2, "%lf %lf %lf", &p[0], &p[1], &p[2])==3)
+                {
+                    coords.push_back(p);
+                    bb.push(p);
+                }
+            }
+            else if(line[0]=='f' && line[1]==' ')
+            {
+                // vertex indices may be negative (relative) and be followed by /vt/vn
+                std::vector<uint> p;
+                char *tok = strtok(line+2, " \t\r\n");
+                while(tok)
+                {
+                    long id = strtol(tok, nullptr, 10);
+                    p.push_back(uint((id<0) ? long(coords.size())+id : id-1));
+                    tok = strtok(nullptr, " \t\r\n");
+                }
+                add_poly(p);
+            }
+        }
+    }
+    else if(ext=="off")
+    {
+        uint nv=0, np=0, ne=0;
+        do { if(!fgets(line, sizeof(line), in)) break; } while(strstr(line,"OFF")==nullptr);
+        do { if(!fgets(line, sizeof(line), in)) break; } while(sscanf(line, "%u %u %u", &nv, &np, &ne)!=3);
+        for(uint i=0; i<nv; ++i)
+        {
+            vec3d p;
+            if(fscanf(in, "%lf %lf %lf", &p[0], &p[1], &p[2])!=3) break;
+            coords.push_back(p);
+            bb.push(p);
+        }
+        for(uint i=0; i<np; ++i)
+        {
+            uint n;
+            if(fscanf(in, "%u", &n)!=1) break;
+            std::vector<uint> p(n);
+            for(uint & vid : p) if(fscanf(in, "%u", &vid)!=1) break;
+            if(!fgets(line, sizeof(line), in)) line[0]='\0'; // colors, if any
+            add_poly(p);
+        }
+    }
+    else if(ext=="mesh")
+    {
+        char word[256];
+        while(fscanf(in, "%255s", word)==1)
+        {
+            if(word[0]=='#')
+            {
+                if(!fgets(line, sizeof(line), in)) break;
+                continue;
+            }
+            if(strcmp(word,"End")==0) break;
+            uint n = 0, arity = 0;
+            if(strcmp(word,"Vertices"  )==0) arity = 0; else
+            if(strcmp(word,"Triangles" )==0) arity = 3; else
+            if(strcmp(word,"Tetrahedra")==0) arity = 4; else
+            if(strcmp(word,"Edges"     )==0) arity = 2; else
+            if(strcmp(word,"Quadrilaterals")==0) arity = 4; else
+            if(strcmp(word,"Hexahedra" )==0) arity = 8; else
+            if(strcmp(word,"Prisms"    )==0) arity = 6; else
+            if(strcmp(word,"Pyramids"  )==0) arity = 5; else
+            continue; // MeshVersionFormatted, Dimension, and their values
+            if(fscanf(in, "%u", &n)!=1) break;
+            for(uint i=0; i<n; ++i)
+            {
+                if(strcmp(word,"Vertices")==0)
+                {
+                    vec3d p;
+                    int   l;
+                    if(fscanf(in, "%lf %lf %lf %d", &p[0], &p[1], &p[2], &l)!=4) break;
+                    coords.push_back(p);
+                    bb.push(p);
+                    continue;
+                }
+                std::vector<uint> p(arity);
+                int l;
+                for(uint & vid : p) if(fscanf(in, "%u", &vid)!=1) break;
+                if(fscanf(in, "%d", &l)!=1) break;
+                for(uint & vid : p) vid -= 1;
+                if(strcmp(word,"Triangles")==0)
+                {
+                    add_poly(p);
+                }
+                else if(strcmp(word,"Tetrahedra")==0)
+                {
+                    Elem e;
+                    e.key = 0;
+                    e.id  = uint(n_tets++);
+                    std::copy(p.begin(), p.end(), e.v);
+                    file_write(tets, &e, sizeof(Elem), 1, "make_streamed_mesh()");
+                }
+            }
+        }
+    }
+    else
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : make_streamed_mesh() : unsupported format " << ext << std::endl;
+        exit(-1);
+    }
+    fclose(in);
+
+    if(n_tets==0 && n_tris==0)
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : make_streamed_mesh() : " << input_filename << " contains no triangles nor tetrahedra" << std::endl;
+        exit(-1);
+    }
+
+    uint   simplex = (n_tets>0) ? 4 : 3;
+    FILE  *raw     = (n_tets>0) ? tets : tris;
+    size_t ne      = (n_tets>0) ? n_tets : n_tris;
+    size_t nv      = coords.size();
+    fclose((n_tets>0) ? tris : tets);
+    fflush(raw);
+
+    // 2) sort elements along a Morton curve passing through their centroids
+    FILE *keyed  = file_temp("make_streamed_mesh()");
+    FILE *sorted = file_temp("make_streamed_mesh()");
+    {
+        RecordReader<Elem> r(raw, 0, ne);
+        for(; !r.eof(); r.pop())
+        {
+            Elem  e = r.top();
+            vec3d c(0,0,0);
+            for(uint i=0; i<simplex; ++i) c += coords.get(e.v[i]);
+            e.key = morton_code(c/double(simplex), bb);
+            file_write(keyed, &e, sizeof(Elem), 1, "make_streamed_mesh()");
+        }
+        fclose(raw);
+        fflush(keyed);
+    }
+    external_sort<Elem>(keyed, sorted, [](const Elem & a, const Elem & b)
+    {
+        return (a.key!=b.key) ? a.key<b.key : a.id<b.id;
+    }, mem/4);
+    fclose(keyed);
+
+    // 3) split in chunks, and renumber vertices in order of first reference
+    uint elems_per_chunk = opt.elems_per_chunk;
+    if(elems_per_chunk==0) elems_per_chunk = uint(std::max(size_t(4096), mem/(simplex==4 ? 4096 : 2048)));
+    uint n_chunks = uint((ne + elems_per_chunk - 1)/elems_per_chunk);
+
+    DiskArray<uint>              new_vid(mem/8);
+    DiskArray<vec3d>             new_coords(mem/8);
+    DiskArray<std::array<uint,4>> new_elems(mem/8);
+    std::vector<uint>            vert_beg(n_chunks+1, 0);
+    FILE *inc = file_temp("make_streamed_mesh()");
+    new_vid.resize(nv, max_uint);
+    {
+        RecordReader<Elem> r(sorted, 0, ne);
+        for(uint eid=0; !r.eof(); r.pop(), ++eid)
+        {
+            const Elem & e = r.top();
+            uint cid = eid/elems_per_chunk;
+            if(eid%elems_per_chunk==0) vert_beg[cid] = uint(new_coords.size());
+            std::array<uint,4> ev = {0,0,0,0};
+            for(uint i=0; i<simplex; ++i)
+            {
+                uint vid = new_vid.get(e.v[i]);
+                if(vid==max_uint)
+                {
+                    vid = uint(new_coords.size());
+                    new_vid.set(e.v[i], vid);
+                    new_coords.push_back(coords.get(e.v[i]));
+                }
+                ev[i] = vid;
+                Incidence ic = { vid, cid, eid };
+                file_write(inc, &ic, sizeof(Incidence), 1, "make_streamed_mesh()");
+            }
+            new_elems.push_back(ev);
+        }
+        vert_beg[n_chunks] = uint(new_coords.size());
+        fclose(sorted);
+        fflush(inc);
+    }
+    if(new_coords.size()<nv)
+    {
+        std::cout << "make_streamed_mesh: " << nv-new_coords.size() << " unreferenced vertices were removed" << std::endl;
+        nv = new_coords.size();
+    }
+
+    // 4) halos: for each vertex shared among chunks, each of its elements
+    //    becomes part of the halo of all the other chunks that share it
+    FILE *halo        = file_temp("make_streamed_mesh()");
+    FILE *halo_sorted = file_temp("make_streamed_mesh()");
+    {
+        FILE *inc_sorted = file_temp("make_streamed_mesh()");
+        size_t n = external_sort<Incidence>(inc, inc_sorted, [](const Incidence & a, const Incidence & b)
+        {
+            if(a.vid  !=b.vid  ) return a.vid  <b.vid;
+            if(a.chunk!=b.chunk) return a.chunk<b.chunk;
+            return a.elem<b.elem;
+        }, mem/4);
+        fclose(inc);
+
+        std::vector<Incidence> group;
+        std::vector<uint>      group_chunks;
+        auto flush_group = [&]()
+        {
+            group_chunks.clear();
+            for(const Incidence & ic : group) if(group_chunks.empty() || group_chunks.back()!=ic.chunk) group_chunks.push_back(ic.chunk);
+            if(group_chunks.size()<2) return;
+            for(const Incidence & ic : group)
+            for(uint cid : group_chunks)
+            {
+                if(cid==ic.chunk) continue;
+                Halo h = { cid, ic.elem };
+                file_write(halo, &h, sizeof(Halo), 1, "make_streamed_mesh()");
+            }
+        };
+        RecordReader<Incidence> r(inc_sorted, 0, n);
+        for(; !r.eof(); r.pop())
+        {
+            if(!group.empty() && group.front().vid!=r.top().vid)
+            {
+                flush_group();
+                group.clear();
+            }
+            group.push_back(r.top());
+        }
+        flush_group();
+        fclose(inc_sorted);
+        fflush(halo);
+    }
+    size_t n_halo = external_sort<Halo>(halo, halo_sorted, [](const Halo & a, const Halo & b)
+    {
+        return (a.chunk!=b.chunk) ? a.chunk<b.chunk : a.elem<b.elem;
+    }, mem/4);
+    fclose(halo);
+
+    // 5) write chunks
+    FILE *out = file_open(output_filename, "wb", "make_streamed_mesh()");
+    StreamedMesh::Header header;
+    header.simplex_size = simplex;
+    header.num_chunks   = n_chunks;
+    header.num_verts    = nv;
+    header.num_elems    = ne;
+    file_write(out, &header, sizeof(header), 1, "make_streamed_mesh()");
+
+    std::vector<StreamedMesh::ChunkInfo> table(n_chunks);
+    RecordReader<Halo> hr(halo_sorted, 0, n_halo);
+    std::unordered_map<uint,uint> halo_vmap;
+    std::vector<uint>             halo_verts, halo_elems, elems;
+    std::vector<double>           xyz;
+    for(uint cid=0; cid<n_chunks; ++cid)
+    {
+        StreamedMesh::ChunkInfo & c = table[cid];
+        c.offset        = uint64_t(file_tell(out, "make_streamed_mesh()"));
+        c.first_vert    = vert_beg[cid];
+        c.n_owned_verts = vert_beg[cid+1]-vert_beg[cid];
+        c.first_elem    = cid*elems_per_chunk;
+        c.n_owned_elems = uint(std::min(size_t(elems_per_chunk), ne-c.first_elem));
+
+        halo_elems.clear();
+        for(; !hr.eof() && hr.top().chunk==cid; hr.pop())
+        {
+            if(halo_elems.empty() || halo_elems.back()!=hr.top().elem) halo_elems.push_back(hr.top().elem);
+        }
+
+        halo_vmap.clear();
+        halo_verts.clear();
+        elems.clear();
+        AABB box;
+        auto add_elem_verts = [&](const uint eid, const bool owned)
+        {
+            const std::array<uint,4> & ev = new_elems.get(eid);
+            for(uint i=0; i<simplex; ++i)
+            {
+                uint vid = ev[i];
+                if(vid>=c.first_vert && vid<c.first_vert+c.n_owned_verts)
+                {
+                    elems.push_back(vid-c.first_vert);
+                }
+                else
+                {
+                    auto it = halo_vmap.find(vid);
+                    if(it==halo_vmap.end())
+                    {
+                        it = halo_vmap.insert(std::make_pair(vid, c.n_owned_verts+uint(halo_verts.size()))).first;
+                        halo_verts.push_back(vid);
+                    }
+                    elems.push_back(it->second);
+                }
+                if(owned) box.push(new_coords.get(vid));
+            }
+        };
+        for(uint i=0; i<c.n_owned_elems; ++i) add_elem_verts(c.first_elem+i, true);
+        for(uint eid : halo_elems) add_elem_verts(eid, false);
+        c.n_halo_verts = uint(halo_verts.size());
+        c.n_halo_elems = uint(halo_elems.size());
+        for(uint i=0; i<3; ++i)
+        {
+            c.bbox[i  ] = box.min[i];
+            c.bbox[i+3] = box.max[i];
+        }
+
+        xyz.clear();
+        for(uint i=0; i<c.n_owned_verts; ++i)
+        {
+            const vec3d & p = new_coords.get(c.first_vert+i);
+            xyz.insert(xyz.end(), {p[0], p[1], p[2]});
+        }
+        for(uint vid : halo_verts)
+        {
+            const vec3d & p = new_coords.get(vid);
+            xyz.insert(xyz.end(), {p[0], p[1], p[2]});
+        }
+        file_write(out, halo_verts.data(), sizeof(uint),   halo_verts.size(), "make_streamed_mesh()");
+        file_write(out, xyz.data(),        sizeof(double), xyz.size(),        "make_streamed_mesh()");
+        file_write(out, halo_elems.data(), sizeof(uint),   halo_elems.size(), "make_streamed_mesh()");
+        file_write(out, elems.data(),      sizeof(uint),   elems.size(),      "make_streamed_mesh()");
+    }
+    fclose(halo_sorted);
+
+    header.table_offset = uint64_t(file_tell(out, "make_streamed_mesh()"));
+    file_write(out, table.data(), sizeof(StreamedMesh::ChunkInfo), table.size(), "make_streamed_mesh()");
+    rewind(out);
+    file_write(out, &header, sizeof(header), 1, "make_streamed_mesh()");
+    file_close(out, "make_streamed_mesh()");
+}
+
+}
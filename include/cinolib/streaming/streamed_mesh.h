@@ -0,0 +1,187 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_STREAMED_MESH_H
+#define CINO_STREAMED_MESH_H
+
+#include <cinolib/geometry/vec_mat.h>
+#include <cinolib/geometry/aabb.h>
+#include <cinolib/meshes/trimesh.h>
+#include <cinolib/meshes/tetmesh.h>
+#include <cstdio>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Out-of-core representation of simplicial meshes (triangles or tetrahedra) that
+ * do not fit in memory. The mesh is stored in a binary file split into chunks of
+ * spatially coherent elements (elements are sorted along a Morton curve), which
+ * can be loaded and processed one at a time, in bounded memory.
+ *
+ * Vertices and elements are renumbered in chunk order: each chunk owns a contiguous
+ * range of element ids and a contiguous range of vertex ids, and each vertex is
+ * owned by the first chunk that references it. Besides its own elements, each chunk
+ * stores a halo made of all the elements of other chunks that share at least one
+ * vertex with it (and their vertices). As a result, any query that depends on the
+ * one ring of an owned vertex (e.g. normals), or on the element adjacent to an owned
+ * element through a facet (e.g. boundary extraction), can be answered exactly
+ * within the chunk. See stream_operators.h for a set of operators that work this way.
+ *
+ * Files are created from standard formats (OBJ, OFF for triangles, MESH for either
+ * triangles or tetrahedra) with make_streamed_mesh, which is itself out-of-core:
+ * vertices and elements are held in disk backed arrays and sorted with external
+ * sorting, so that at no time the whole mesh is in memory.
+ *
+ * The memory used both to build the file and to process its chunks is controlled
+ * by StreamOptions::max_memory. The chunk size is fixed at construction time.
+*/
+
+struct StreamOptions
+{
+    size_t max_memory      = size_t(1)<<30; // bytes
+    uint   elems_per_chunk = 0;             // 0 : derived from max_memory
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// a chunk loaded in memory. Owned verts/elements come first, then the halo ones
+//
+struct MeshChunk
+{
+    uint               id            = 0;
+    uint               simplex_size  = 0; // 3: triangles, 4: tetrahedra
+    uint               n_owned_verts = 0;
+    uint               n_owned_elems = 0;
+    std::vector<vec3d> verts;
+    std::vector<uint>  vert_gid;          // global ids
+    std::vector<uint>  elems;             // simplex_size local vertex ids per element
+    std::vector<uint>  elem_gid;          // global ids
+
+    uint  num_verts() const { return uint(verts.size());    }
+    uint  num_elems() const { return uint(elem_gid.size()); }
+    uint  elem_vert_id(const uint eid, const uint off) const { return elems[eid*simplex_size+off]; }
+    const vec3d & elem_vert(const uint eid, const uint off) const { return verts[elem_vert_id(eid,off)]; }
+
+    // in memory meshes made of owned and halo elements (local ids), to
+    // use any of the in-core algorithms of the library on a single chunk
+    template<class M, class V, class E, class P>
+    void to_mesh(Trimesh<M,V,E,P> & m) const;
+
+    template<class M, class V, class E, class F, class P>
+    void to_mesh(Tetmesh<M,V,E,F,P> & m) const;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+class StreamedMesh
+{
+    public:
+
+        explicit StreamedMesh(const char * filename);
+        ~StreamedMesh();
+
+        StreamedMesh(const StreamedMesh &) = delete;
+        StreamedMesh & operator=(const StreamedMesh &) = delete;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint         simplex_size()             const { return header.simplex_size; }
+        uint         num_verts()                const { return uint(header.num_verts); }
+        uint         num_elems()                const { return uint(header.num_elems); }
+        uint         num_chunks()               const { return header.num_chunks; }
+        const AABB & bbox()                     const { return bb; }
+        const AABB & chunk_bbox(const uint cid) const { return chunk_bb.at(cid); } // bbox of the owned elements
+
+        // NOTE: not thread safe (chunks are read from a single file stream)
+        void load_chunk(const uint cid, MeshChunk & chunk) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // on disk layout. The header is at the beginning of the file, the
+        // chunk table at the end, and the chunks in between. Each chunk is
+        // stored as: halo vert ids (uint), coordinates (double, owned first),
+        // halo elem ids (uint), elements (uint local vert ids, owned first)
+        struct Header
+        {
+            char     magic[8]     = {'C','I','N','O','S','T','R','1'};
+            uint32_t simplex_size = 0;
+            uint32_t num_chunks   = 0;
+            uint64_t num_verts    = 0;
+            uint64_t num_elems    = 0;
+            uint64_t table_offset = 0;
+        };
+        struct ChunkInfo
+        {
+            uint64_t offset;
+            uint32_t first_vert, n_owned_verts, n_halo_verts;
+            uint32_t first_elem, n_owned_elems, n_halo_elems;
+            double   bbox[6];
+        };
+
+    protected:
+
+        FILE                  *f = nullptr;
+        Header                 header;
+        std::vector<ChunkInfo> table;
+        std::vector<AABB>      chunk_bb;
+        AABB                   bb;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// converts a mesh in OBJ/OFF (triangles) or MESH (tetrahedra, or triangles
+// if there are no tetrahedra) format into a streamed mesh. Polygons with
+// more than three vertices are triangulated as fans
+//
+CINO_INLINE
+void make_streamed_mesh(const char          * input_filename,
+                        const char          * output_filename,
+                        const StreamOptions & opt = StreamOptions());
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// 63 bit Morton code of point p, quantized w.r.t. box b (21 bits per axis)
+//
+CINO_INLINE
+uint64_t morton_code(const vec3d & p, const AABB & b);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "streamed_mesh.cpp"
+#endif
+
+#endif // CINO_STREAMED_MESH_H
@@ -0,0 +1,188 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/streaming/streamed_soup_writer.h>
+#include <cinolib/streaming/external_sort.h>
+#include <cinolib/streaming/file_io.h>
+#include <cinolib/string_utilities.h>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
+#include <iostream>
+
+namespace cinolib
+{
+
+CINO_INLINE
+StreamedSoupWriter::StreamedSoupWriter(const uint arity, const size_t max_memory)
+    : n_corners(arity)
+    , max_mem(max_memory)
+{
+    assert(arity>=2 && arity<=4);
+    corners = file_temp("StreamedSoupWriter()");
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+StreamedSoupWriter::~StreamedSoupWriter()
+{
+    if(corners) fclose(corners);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void StreamedSoupWriter::add(const uint64_t keys[], const vec3d pos[])
+{
+    assert(corners!=nullptr && "StreamedSoupWriter: elements cannot be added after write()");
+    for(uint i=0; i<n_corners; ++i)
+    {
+        Corner c = { keys[i], n_elems*n_corners+i, { pos[i][0], pos[i][1], pos[i][2] } };
+        file_write(corners, &c, sizeof(Corner), 1, "StreamedSoupWriter::add()");
+    }
+    ++n_elems;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void StreamedSoupWriter::write(const char * filename)
+{
+    struct Index { uint64_t slot; uint vid; };
+
+    std::string ext = get_file_extension(filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if(ext!="obj" && ext!="off" && ext!="mesh")
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : StreamedSoupWriter::write() : unsupported format " << ext << std::endl;
+        exit(-1);
+    }
+    if(n_corners==4 && ext!="mesh")
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : StreamedSoupWriter::write() : tetrahedra can only be written in MESH format" << std::endl;
+        exit(-1);
+    }
+
+    FILE *sorted_corners = file_temp("StreamedSoupWriter::write()");
+    FILE *verts          = file_temp("StreamedSoupWriter::write()");
+    FILE *index          = file_temp("StreamedSoupWriter::write()");
+    FILE *sorted_index   = file_temp("StreamedSoupWriter::write()");
+
+    // weld corners with the same key. Vertex ids follow key order
+    fflush(corners);
+    size_t n = external_sort<Corner>(corners, sorted_corners, [](const Corner & a, const Corner & b)
+    {
+        return (a.key!=b.key) ? a.key<b.key : a.slot<b.slot;
+    }, max_mem);
+    fclose(corners);
+    corners = nullptr;
+
+    uint nv = 0;
+    RecordReader<Corner> rc(sorted_corners, 0, n);
+    for(uint64_t prev_key=0; !rc.eof(); rc.pop())
+    {
+        const Corner & c = rc.top();
+        if(nv==0 || c.key!=prev_key)
+        {
+            file_write(verts, c.pos, sizeof(double), 3, "StreamedSoupWriter::write()");
+            prev_key = c.key;
+            ++nv;
+        }
+        Index id = { c.slot, nv-1 };
+        file_write(index, &id, sizeof(Index), 1, "StreamedSoupWriter::write()");
+    }
+    fclose(sorted_corners);
+    fflush(verts);
+    fflush(index);
+
+    // back to element order
+    external_sort<Index>(index, sorted_index, [](const Index & a, const Index & b)
+    {
+        return a.slot<b.slot;
+    }, max_mem);
+    fclose(index);
+
+    auto for_each_elem = [&](std::function<void(const uint *)> func)
+    {
+        RecordReader<Index> r(sorted_index, 0, n);
+        std::vector<uint> e(n_corners);
+        while(!r.eof())
+        {
+            for(uint i=0; i<n_corners; ++i, r.pop()) e[i] = r.top().vid;
+            bool collapsed = false;
+            for(uint i=0; i<n_corners; ++i)
+            for(uint j=i+1; j<n_corners; ++j) if(e[i]==e[j]) collapsed = true;
+            if(!collapsed) func(e.data());
+        }
+    };
+    uint ne = 0;
+    for_each_elem([&](const uint *){ ++ne; });
+
+    setlocale(LC_NUMERIC, "en_US.UTF-8"); // makes sure "." is the decimal separator
+
+    FILE *fp = file_open(filename, "w", "StreamedSoupWriter::write()");
+
+    if(ext=="off") fprintf(fp, "OFF\n%u %u 0\n", nv, ne);
+    if(ext=="mesh") fprintf(fp, "MeshVersionFormatted 1\nDimension 3\nVertices\n%u\n", nv);
+    RecordReader<std::array<double,3>> rv(verts, 0, nv);
+    for(; !rv.eof(); rv.pop())
+    {
+        const std::array<double,3> & p = rv.top();
+        if(ext=="obj")  fprintf(fp, "v %.17g %.17g %.17g\n", p[0], p[1], p[2]); else
+        if(ext=="off")  fprintf(fp, "%.17g %.17g %.17g\n",   p[0], p[1], p[2]); else
+        if(ext=="mesh") fprintf(fp, "%.17g %.17g %.17g 0\n", p[0], p[1], p[2]);
+    }
+    fclose(verts);
+
+    if(ext=="mesh")
+    {
+        const char *section[] = { "", "", "Edges", "Triangles", "Tetrahedra" };
+        fprintf(fp, "%s\n%u\n", section[n_corners], ne);
+    }
+    for_each_elem([&](const uint *e)
+    {
+        if(ext=="obj") fprintf(fp, (n_corners==2) ? "l" : "f");
+        if(ext=="off") fprintf(fp, "%u", n_corners);
+        for(uint i=0; i<n_corners; ++i) fprintf(fp, " %u", (ext=="off") ? e[i] : e[i]+1);
+        fprintf(fp, (ext=="mesh") ? " 0\n" : "\n");
+    });
+    if(ext=="mesh") fprintf(fp, "End\n");
+    file_close(fp, "StreamedSoupWriter::write()");
+    fclose(sorted_index);
+}
+
+}
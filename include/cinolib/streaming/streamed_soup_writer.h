@@ -0,0 +1,103 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_STREAMED_SOUP_WRITER_H
+#define CINO_STREAMED_SOUP_WRITER_H
+
+#include <cinolib/geometry/vec_mat.h>
+#include <cstdio>
+
+namespace cinolib
+{
+
+/* Out-of-core writer for meshes produced one element at a time by streaming
+ * operators (e.g. slicing, iso-surfacing, boundary extraction). Each element
+ * corner comes with a 64 bit key that identifies it globally (e.g. the id of
+ * the input vertex it comes from, or the pair of vertex ids of the edge it
+ * lies on), and corners with the same key are welded into a single vertex.
+ *
+ * Elements are appended to a temporary file as they come. At writing time,
+ * corners are sorted by key with external sorting to assign vertex ids, and
+ * sorted back in element order to write the connectivity. Memory usage is
+ * therefore bounded by max_memory, regardless of the size of the output.
+ *
+ * Supported formats are OBJ, OFF and MESH. Elements can be segments (arity 2),
+ * triangles (arity 3) or tetrahedra (arity 4, MESH only). Elements where two
+ * corners are welded together are discarded.
+*/
+
+class StreamedSoupWriter
+{
+    public:
+
+        explicit StreamedSoupWriter(const uint   arity,
+                                    const size_t max_memory = size_t(1)<<28); // bytes
+        ~StreamedSoupWriter();
+
+        StreamedSoupWriter(const StreamedSoupWriter &) = delete;
+        StreamedSoupWriter & operator=(const StreamedSoupWriter &) = delete;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint   arity()     const { return n_corners; }
+        size_t num_elems() const { return n_elems;   }
+
+        void add(const uint64_t keys[], const vec3d pos[]); // arity() corners each
+        void write(const char * filename);                  // can be called only once
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        struct Corner
+        {
+            uint64_t key;
+            uint64_t slot; // element id * arity + offset
+            double   pos[3];
+        };
+
+    protected:
+
+        FILE   *corners   = nullptr;
+        uint    n_corners = 0;
+        size_t  n_elems   = 0;
+        size_t  max_mem   = 0;
+};
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "streamed_soup_writer.cpp"
+#endif
+
+#endif // CINO_STREAMED_SOUP_WRITER_H
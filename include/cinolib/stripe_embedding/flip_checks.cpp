@@ -36,6 +36,7 @@
 #include <cinolib/stripe_embedding/flip_checks.h>
 #include <cinolib/rationals.h>
 #include <cinolib/predicates.h>
+#include <cinolib/filtered_predicates.h>
 
 namespace cinolib
 {
@@ -59,9 +60,9 @@ bool flipped_q(SE_data & data,
                const uint v1,
                const uint v2)
 {
-    return (orient2d(&data.coords_q.at(2*v0),
-                     &data.coords_q.at(2*v1),
-                     &data.coords_q.at(2*v2)) <= 0);
+    return (orient2d_sign(&data.coords_q.at(2*v0),
+                          &data.coords_q.at(2*v1),
+                          &data.coords_q.at(2*v2)) <= 0);
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
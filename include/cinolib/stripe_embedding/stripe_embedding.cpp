@@ -38,18 +38,22 @@
 #include <cinolib/split_separating_simplices.h>
 #include <cinolib/geometry/n_sided_poygon.h>
 #include <cinolib/how_many_seconds.h>
+#include <cinolib/parallel_for.h>
+#include <cinolib/tracer.h>
+#include <climits>
 
 namespace cinolib
 {
 
+// combinatorial part of the stripe expansion: marks the vertices of the chain as embedded
+// and labels its edges. Vertex positions are computed later on, by solve_stripes
+//
+CINO_INLINE
 void embed_strip(SE_data & data, const std::vector<uint> & chain, const uint pivot)
 {
     assert(data.embedded.at(chain.front()));
     assert(data.embedded.at(chain.back()));
 
-    double delta_x = data.coords_d[2*chain.front()  ] - data.coords_d[2*chain.back()  ];
-    double delta_y = data.coords_d[2*chain.front()+1] - data.coords_d[2*chain.back()+1];
-
     for(uint i=1; i<chain.size(); ++i)
     {
         int eid = data.m.edge_id(chain[i],chain[i-1]);
@@ -61,33 +65,141 @@ void embed_strip(SE_data & data, const std::vector<uint> & chain, const uint piv
         assert(!data.embedded.at(chain[i  ]));
         data.embedded.at(chain[i]) = true;
         data.embedded_verts++;
+    }
+    ++data.fresh_id;
+
+    data.unsolved_offset.push_back(data.unsolved.size());
+    data.unsolved.insert(data.unsolved.end(), chain.begin(), chain.end());
+
+    if(data.store_stripes) // just for visuals
+    {
+        data.stripes_offset.push_back(data.stripes.size());
+        data.stripes.push_back(pivot);
+        for(uint vid : chain) data.stripes.push_back(vid);
+    }
+}
 
-        double t = (chain.size()-i-1)/double(chain.size());
-        data.coords_d.at(2*chain[i]  ) = data.coords_d[2*chain.back()  ] + t*delta_x;
-        data.coords_d.at(2*chain[i]+1) = data.coords_d[2*chain.back()+1] + t*delta_y;
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// positions the inner vertices of a chain along the segment connecting its endpoints.
+// Lazy exact numbers are reference counted and evaluated on demand, hence they cannot be
+// shared among threads: rational positions are computed on the exact values of the
+// endpoints (which must be already evaluated) and written in exact_q, one pair per vertex
+// of the chain. The caller copies them into data.coords_q
+//
+CINO_INLINE
+void solve_stripe(SE_data & data, const uint * chain, const uint size, CGAL_Q::ET * exact_q)
+{
+    CINO_PROFILE_SCOPE("stripe_embedding::stripe");
+
+    uint front = chain[0];
+    uint back  = chain[size-1];
+
+    double delta_x = data.coords_d[2*front  ] - data.coords_d[2*back  ];
+    double delta_y = data.coords_d[2*front+1] - data.coords_d[2*back+1];
+
+    // the default precision of MPFR is per thread
+    if(data.use_MPFR) mpfr::mpreal::set_default_prec(data.MPFR_precision);
+
+    for(uint i=1; i<size-1; ++i)
+    {
+        double t = (size-i-1)/double(size);
+        data.coords_d.at(2*chain[i]  ) = data.coords_d[2*back  ] + t*delta_x;
+        data.coords_d.at(2*chain[i]+1) = data.coords_d[2*back+1] + t*delta_y;
 
         if(data.use_rationals)
         {
-            CGAL_Q t = (chain.size()-i-1)/double(chain.size());
-            data.coords_q.at(2*chain[i]  ) = data.coords_q[2*chain.front()  ]*t + data.coords_q[2*chain.back()  ]*(1-t);
-            data.coords_q.at(2*chain[i]+1) = data.coords_q[2*chain.front()+1]*t + data.coords_q[2*chain.back()+1]*(1-t);
+            CGAL_Q::ET t = (size-i-1)/double(size);
+            CGAL_Q::ET s = CGAL_Q::ET(1) - t;
+            exact_q[2*i  ] = data.coords_q[2*front  ].exact()*t + data.coords_q[2*back  ].exact()*s;
+            exact_q[2*i+1] = data.coords_q[2*front+1].exact()*t + data.coords_q[2*back+1].exact()*s;
         }
 
         if(data.use_MPFR)
         {
-            mpfr::mpreal t = (chain.size()-i-1)/double(chain.size());
-            data.coords_m.at(2*chain[i]  ) = data.coords_m[2*chain.front()  ]*t + data.coords_m[2*chain.back()  ]*(1-t);
-            data.coords_m.at(2*chain[i]+1) = data.coords_m[2*chain.front()+1]*t + data.coords_m[2*chain.back()+1]*(1-t);
+            mpfr::mpreal t = (size-i-1)/double(size);
+            data.coords_m.at(2*chain[i]  ) = data.coords_m[2*front  ]*t + data.coords_m[2*back  ]*(1-t);
+            data.coords_m.at(2*chain[i]+1) = data.coords_m[2*front+1]*t + data.coords_m[2*back+1]*(1-t);
         }
     }
-    ++data.fresh_id;
+}
 
-    if(data.store_stripes) // just for visuals
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// computes vertex positions for all the stripes extracted so far. A stripe depends on
+// the stripes that embedded its endpoints (if any), and stripes that do not depend on
+// each other are independent. Stripes are therefore grouped in levels (a stripe belongs
+// to the level that follows the ones of the stripes it depends on), and all the stripes
+// in the same level are solved concurrently
+//
+CINO_INLINE
+void solve_stripes(SE_data & data)
+{
+    uint n = data.unsolved_offset.size();
+    if(n==0) return;
+
+    CINO_PROFILE_SCOPE("stripe_embedding::solve");
+
+    auto chain_beg = [&](const uint s) { return data.unsolved_offset.at(s); };
+    auto chain_end = [&](const uint s) { return (s+1<n) ? data.unsolved_offset.at(s+1) : (uint)data.unsolved.size(); };
+
+    // stripes are listed in order of extraction, hence each stripe
+    // comes after the stripes that embedded its endpoints
+    std::vector<int>  solved_by(data.m.num_verts(), -1);
+    std::vector<uint> level(n,0);
+    uint n_levels = 0;
+    for(uint s=0; s<n; ++s)
     {
-        data.stripes_offset.push_back(data.stripes.size());
-        data.stripes.push_back(pivot);
-        for(uint vid : chain) data.stripes.push_back(vid);
+        uint beg = chain_beg(s);
+        uint end = chain_end(s);
+        int  s0  = solved_by.at(data.unsolved.at(beg  ));
+        int  s1  = solved_by.at(data.unsolved.at(end-1));
+        if(s0>=0) level.at(s) = std::max(level.at(s), level.at(s0)+1);
+        if(s1>=0) level.at(s) = std::max(level.at(s), level.at(s1)+1);
+        for(uint i=beg+1; i+1<end; ++i) solved_by.at(data.unsolved.at(i)) = s;
+        n_levels = std::max(n_levels, level.at(s)+1);
     }
+    std::vector<std::vector<uint>> levels(n_levels);
+    for(uint s=0; s<n; ++s) levels.at(level.at(s)).push_back(s);
+
+    // with doubles only a stripe costs very little, and
+    // it makes sense to go parallel only for big levels
+    uint serial_if_less_than = (data.use_rationals || data.use_MPFR) ? 4 : 1000;
+    if(!data.parallel) serial_if_less_than = UINT_MAX;
+    std::vector<CGAL_Q::ET> exact_q(data.use_rationals ? 2*data.unsolved.size() : 0);
+    for(const std::vector<uint> & stripes : levels)
+    {
+        if(data.use_rationals)
+        {
+            // endpoints are shared among stripes: evaluate them before going parallel
+            for(uint s : stripes)
+            for(uint vid : {data.unsolved.at(chain_beg(s)), data.unsolved.at(chain_end(s)-1)})
+            {
+                data.coords_q.at(2*vid  ).exact();
+                data.coords_q.at(2*vid+1).exact();
+            }
+        }
+
+        PARALLEL_FOR(0, stripes.size(), serial_if_less_than, [&](const uint i)
+        {
+            uint s = stripes.at(i);
+            solve_stripe(data, &data.unsolved.at(chain_beg(s)), chain_end(s)-chain_beg(s), exact_q.data()+2*chain_beg(s));
+        });
+
+        if(data.use_rationals)
+        {
+            for(uint s : stripes)
+            for(uint i=chain_beg(s)+1; i+1<chain_end(s); ++i)
+            {
+                uint vid = data.unsolved.at(i);
+                data.coords_q.at(2*vid  ) = CGAL_Q(exact_q.at(2*i  ));
+                data.coords_q.at(2*vid+1) = CGAL_Q(exact_q.at(2*i+1));
+            }
+        }
+    }
+
+    data.unsolved_offset.clear();
+    data.unsolved.clear();
 }
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
@@ -179,6 +291,7 @@ void init(SE_data & data)
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+CINO_INLINE
 int chain_starting_index(SE_data & data, const uint pivot)
 {
     for(uint i=0; i<data.m.adj_v2v(pivot).size(); ++i)
@@ -192,6 +305,7 @@ int chain_starting_index(SE_data & data, const uint pivot)
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+CINO_INLINE
 bool colinearity_test_passed(SE_data & data, const std::vector<uint> & chain)
 {
     for(uint eid0 : data.m.adj_v2e(*chain.begin()))
@@ -208,6 +322,7 @@ bool colinearity_test_passed(SE_data & data, const std::vector<uint> & chain)
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+CINO_INLINE
 std::vector<uint> make_chain(SE_data & data, const uint pivot)
 {
     std::vector<uint> chain;
@@ -227,6 +342,7 @@ std::vector<uint> make_chain(SE_data & data, const uint pivot)
 
 //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
+CINO_INLINE
 bool expand_strips_around_pivot(SE_data & data, const uint pivot)
 {
     std::vector<uint> chain = make_chain(data,pivot);
@@ -246,6 +362,8 @@ void stripe_embedding(SE_data & data)
 
     if(!data.initialized) init(data);
 
+    CINO_PROFILE_SCOPE("stripe_embedding");
+
     uint count = 0;
     while(!data.q.empty())
     {
@@ -257,6 +375,8 @@ void stripe_embedding(SE_data & data)
         if(data.stop || (data.step_by_step && count==data.step_size)) break;
     }
 
+    solve_stripes(data);
+
     if(data.embedded_verts==data.m.num_verts())
     {
         data.converged = true;
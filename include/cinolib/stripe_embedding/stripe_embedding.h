@@ -94,6 +94,13 @@ struct SE_data
 
     std::queue<uint> q; // stripe espansion queue
 
+    // stripes are first extracted (a purely combinatorial process) and then solved, i.e. the
+    // positions of their vertices are computed. Stripes whose endpoints have been embedded can
+    // be solved independently, and are processed in parallel if this flag is set
+    bool parallel = true;
+    std::vector<uint> unsolved_offset; // starting index of each stripe that has not been solved yet
+    std::vector<uint> unsolved;        // serialized chains of such stripes
+
     // this is only for visuals. The following vectors will be filled only if store_stripes is true
     std::vector<uint> stripes_offset; // stripe starting index
     std::vector<uint> stripes;        // pivot + serialized chain of vertices opposite to the pivot
@@ -59,12 +59,6 @@ void subdivision_1_to_4(Trimesh<M,V,E,P> & m)
         auto v = m.poly_verts_id(pid);
         if(!m.poly_verts_are_CCW(pid,v[1],v[0])) std::swap(v[1],v[0]);
 
-        //       v2
-        //      /   \
-        //   e02 -- e12
-        //   /  \   /  \
-        // v0 -- e01 -- v1
-
         int e01 = m.edge_id(v[0],v[1]); assert(e01>=0);
         int e12 = m.edge_id(v[1],v[2]); assert(e12>=0);
         int e02 = m.edge_id(v[0],v[2]); assert(e02>=0);
@@ -73,10 +67,9 @@ void subdivision_1_to_4(Trimesh<M,V,E,P> & m)
         uint v12 = nv + e12;
         uint v02 = nv + e02;
 
-        m.poly_add(v[0], v01, v02);
-        m.poly_add( v01, v12, v02);
-        m.poly_add( v01,v[1], v12);
-        m.poly_add( v02, v12,v[2]);
+        uint t[12];
+        subdivision_1_to_4_children(v.data(), v01, v12, v02, t);
+        for(uint i=0; i<4; ++i) m.poly_add(t[3*i], t[3*i+1], t[3*i+2]);
     }
 
     // remove old triangles
@@ -89,4 +82,29 @@ void subdivision_1_to_4(Trimesh<M,V,E,P> & m)
     m.polys_remove(del);
 }
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void subdivision_1_to_4_children(const uint v[],
+                                 const uint v01,
+                                 const uint v12,
+                                 const uint v02,
+                                       uint children[])
+{
+    //       v2
+    //      /   \
+    //   e02 -- e12
+    //   /  \   /  \
+    // v0 -- e01 -- v1
+
+    uint t[12] =
+    {
+        v[0], v01, v02,
+         v01, v12, v02,
+         v01,v[1], v12,
+         v02, v12,v[2]
+    };
+    std::copy(t, t+12, children);
+}
+
 }
@@ -47,6 +47,16 @@ template<class M, class V, class E, class P>
 CINO_INLINE
 void subdivision_1_to_4(Trimesh<M,V,E,P> & m);
 
+// vertices of the four sub triangles of a (CCW) triangle v[], given the
+// ids of the vertices splitting its edges (v01, v12, v02)
+//
+CINO_INLINE
+void subdivision_1_to_4_children(const uint v[],
+                                 const uint v01,
+                                 const uint v12,
+                                 const uint v02,
+                                       uint children[]); // 4x3 entries
+
 }
 
 #ifndef  CINO_STATIC_LIB
@@ -107,21 +107,39 @@ void subdivision_barycentric(Tetmesh<M,V,E,F,P> & m)
         // tet centroid
         uint c = p_map.at(pid);
 
-        for(uint i=0; i<4; ++i)
-        {
-            // split i^th face
-            m.poly_add({c, f[i][0], e[i][0], fc[i]});
-            m.poly_add({c, e[i][0], f[i][1], fc[i]});
-            m.poly_add({c, f[i][1], e[i][1], fc[i]});
-            m.poly_add({c, e[i][1], f[i][2], fc[i]});
-            m.poly_add({c, f[i][2], e[i][2], fc[i]});
-            m.poly_add({c, e[i][2], f[i][0], fc[i]});
-        }
+        uint t[96];
+        subdivision_barycentric_children(f, e, fc, c, t);
+        for(uint i=0; i<24; ++i) m.poly_add({t[4*i], t[4*i+1], t[4*i+2], t[4*i+3]});
     }
 
     // remove the old polys
     for(int pid=np-1; pid>=0; --pid) m.poly_remove(pid);
 }
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void subdivision_barycentric_children(const uint f[][3],
+                                      const uint e[][3],
+                                      const uint fc[],
+                                      const uint c,
+                                            uint children[])
+{
+    for(uint i=0; i<4; ++i)
+    {
+        // split i^th face
+        uint t[24] =
+        {
+            c, f[i][0], e[i][0], fc[i],
+            c, e[i][0], f[i][1], fc[i],
+            c, f[i][1], e[i][1], fc[i],
+            c, e[i][1], f[i][2], fc[i],
+            c, f[i][2], e[i][2], fc[i],
+            c, e[i][2], f[i][0], fc[i]
+        };
+        std::copy(t, t+24, children+24*i);
+    }
+}
+
 
 }
@@ -49,6 +49,17 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void subdivision_barycentric(Tetmesh<M,V,E,F,P> & m);
 
+// vertices of the 24 sub tets of a tet with faces f[] (see TET_FACES), given
+// the ids of the vertices splitting the edges of each face (e[i][j] splits
+// edge (f[i][j],f[i][j+1])), the face centroids fc[] and the tet centroid c
+//
+CINO_INLINE
+void subdivision_barycentric_children(const uint f[][3],
+                                      const uint e[][3],
+                                      const uint fc[],
+                                      const uint c,
+                                            uint children[]); // 24x4 entries
+
 }
 
 #ifndef  CINO_STATIC_LIB
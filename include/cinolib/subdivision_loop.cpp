@@ -65,17 +65,11 @@ void subdivision_Loop(Tetmesh<M,V,E,F,P> & m)
         uint v13 = e_splits.at(m.edge_id(v1,v3));
         uint v23 = e_splits.at(m.edge_id(v2,v3));
 
-        // corners
-        m.poly_add({v20, v01, v03, v0});
-        m.poly_add({v13, v23, v03, v3});
-        m.poly_add({v23, v12, v20, v2});
-        m.poly_add({v12, v13, v01, v1});
-
-        // inner octahedron
-        m.poly_add({v01, v23, v12, v20});
-        m.poly_add({v01, v23, v20, v03});
-        m.poly_add({v01, v23, v03, v13});
-        m.poly_add({v01, v23, v13, v12});
+        uint e[] = { v01, v12, v20, v03, v13, v23 };
+        uint v[] = { v0, v1, v2, v3 };
+        uint t[32];
+        subdivision_Loop_children(v, e, t);
+        for(uint i=0; i<8; ++i) m.poly_add({t[4*i], t[4*i+1], t[4*i+2], t[4*i+3]});
 
         // TODO: I should tetrahedralize the inner octahedron
         // by always considering the longest inner diagonal
@@ -87,4 +81,35 @@ void subdivision_Loop(Tetmesh<M,V,E,F,P> & m)
     for(int pid=np-1; pid>=0; --pid) m.poly_remove(pid);
 }
 
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void subdivision_Loop_children(const uint v[],
+                               const uint e[],
+                                     uint children[])
+{
+    uint v01 = e[0];
+    uint v12 = e[1];
+    uint v20 = e[2];
+    uint v03 = e[3];
+    uint v13 = e[4];
+    uint v23 = e[5];
+
+    uint t[32] =
+    {
+        // corners
+        v20, v01, v03, v[0],
+        v13, v23, v03, v[3],
+        v23, v12, v20, v[2],
+        v12, v13, v01, v[1],
+
+        // inner octahedron
+        v01, v23, v12, v20,
+        v01, v23, v20, v03,
+        v01, v23, v03, v13,
+        v01, v23, v13, v12
+    };
+    std::copy(t, t+32, children);
+}
+
 }
@@ -55,6 +55,14 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void subdivision_Loop(Tetmesh<M,V,E,F,P> & m);
 
+// vertices of the eight sub tets of a tet v[], given the ids of the vertices
+// splitting its edges, ordered as (v01, v12, v20, v03, v13, v23)
+//
+CINO_INLINE
+void subdivision_Loop_children(const uint v[],
+                               const uint e[],
+                                     uint children[]); // 8x4 entries
+
 }
 
 #ifndef  CINO_STATIC_LIB
@@ -37,6 +37,7 @@
 #define CINO_SUBDIVISION_MIDPOINT_H
 
 #include <cinolib/meshes/meshes.h>
+#include <unordered_map>
 
 namespace cinolib
 {
@@ -59,9 +60,9 @@ template<class M, class V, class E, class F, class P>
 CINO_INLINE
 void subdivision_midpoint(const AbstractPolyhedralMesh<M,V,E,F,P> & m_in,
                                 AbstractPolyhedralMesh<M,V,E,F,P> & m_out,
-                                std::map<uint,uint>               & edge_verts,
-                                std::map<uint,uint>               & face_verts,
-                                std::map<uint,uint>               & poly_verts);
+                                std::unordered_map<uint,uint>     & edge_verts,
+                                std::unordered_map<uint,uint>     & face_verts,
+                                std::unordered_map<uint,uint>     & poly_verts);
 }
 
 #ifndef  CINO_STATIC_LIB
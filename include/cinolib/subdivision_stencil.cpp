@@ -0,0 +1,343 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/subdivision_stencil.h>
+#include <cinolib/subdivision_1_to_4.h>
+#include <cinolib/subdivision_loop.h>
+#include <cinolib/subdivision_barycentric.h>
+#include <cinolib/subdivision_midpoint.h>
+#include <cinolib/vector_serialization.h>
+#include <cinolib/parallel_for.h>
+
+namespace cinolib
+{
+
+template<class Mesh>
+template<class ControlMesh>
+CINO_INLINE
+CachedSubdivision<Mesh>::CachedSubdivision(const ControlMesh & m,
+                                           const int           scheme,
+                                           const uint          levels)
+{
+    build(m, scheme, levels);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Mesh>
+template<class ControlMesh>
+CINO_INLINE
+void CachedSubdivision<Mesh>::build(const ControlMesh & m,
+                                    const int           scheme,
+                                    const uint          levels)
+{
+    assert(levels>0);
+
+    S = subdivision_stencil(m, scheme);
+    subdivision_refine(m, scheme, refine_field(m.vector_verts()), refined);
+
+    for(uint l=1; l<levels; ++l)
+    {
+        // refine the current level with its own stencil, then chain the
+        // stencils so that S always maps control verts to finest verts
+        Eigen::SparseMatrix<double,Eigen::RowMajor> S_prev = S;
+        S = subdivision_stencil(refined, scheme);
+        Mesh prev = refined;
+        subdivision_refine(prev, scheme, refine_field(prev.vector_verts()), refined);
+        S = S * S_prev;
+    }
+    S.makeCompressed();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Mesh>
+CINO_INLINE
+void CachedSubdivision<Mesh>::update(const std::vector<vec3d> & control_verts)
+{
+    assert(control_verts.size()==size_t(S.cols()));
+    assert(refined.num_verts()==uint(S.rows()));
+
+    const int    *outer = S.outerIndexPtr();
+    const int    *inner = S.innerIndexPtr();
+    const double *value = S.valuePtr();
+    std::vector<vec3d> & verts = refined.vector_verts();
+    PARALLEL_FOR(0, uint(S.rows()), 1000, [&](uint vid)
+    {
+        vec3d p(0,0,0);
+        for(int i=outer[vid]; i<outer[vid+1]; ++i) p += value[i] * control_verts[inner[i]];
+        verts[vid] = p;
+    });
+
+    if(refined.mesh_data().update_normals) refined.update_normals();
+    if(refined.mesh_data().update_bbox)    refined.update_bbox();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Mesh>
+template<typename T>
+CINO_INLINE
+std::vector<T> CachedSubdivision<Mesh>::refine_field(const std::vector<T> & control_field) const
+{
+    assert(control_field.size()==size_t(S.cols()));
+
+    const int    *outer = S.outerIndexPtr();
+    const int    *inner = S.innerIndexPtr();
+    const double *value = S.valuePtr();
+    std::vector<T> res(S.rows());
+    PARALLEL_FOR(0, uint(S.rows()), 1000, [&](uint vid)
+    {
+        // each row has at least one entry
+        T f = value[outer[vid]] * control_field[inner[outer[vid]]];
+        for(int i=outer[vid]+1; i<outer[vid+1]; ++i) f = f + value[i] * control_field[inner[i]];
+        res[vid] = f;
+    });
+    return res;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class P>
+CINO_INLINE
+Eigen::SparseMatrix<double,Eigen::RowMajor> subdivision_stencil(const Trimesh<M,V,E,P> & m,
+                                                                const int                scheme)
+{
+    assert(scheme==SUBDIVISION_1_TO_4);
+    uint nv = m.num_verts();
+    return averaging_stencil(nv + m.num_edges(), nv,
+    [&](const uint row) -> uint
+    {
+        return (row<nv) ? 1 : 2;
+    },
+    [&](const uint row, int * vids)
+    {
+        if(row<nv) vids[0] = row; else
+        {
+            vids[0] = m.edge_vert_id(row-nv,0);
+            vids[1] = m.edge_vert_id(row-nv,1);
+        }
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+Eigen::SparseMatrix<double,Eigen::RowMajor> subdivision_stencil(const AbstractPolyhedralMesh<M,V,E,F,P> & m,
+                                                                const int                                 scheme)
+{
+    assert(scheme==SUBDIVISION_LOOP || scheme==SUBDIVISION_BARYCENTRIC || scheme==SUBDIVISION_MIDPOINT);
+    bool centroids = (scheme!=SUBDIVISION_LOOP);
+    uint nv = m.num_verts();
+    uint ne = m.num_edges();
+    uint nf = centroids ? m.num_faces() : 0;
+    uint np = centroids ? m.num_polys() : 0;
+    return averaging_stencil(nv+ne+nf+np, nv,
+    [&](const uint row) -> uint
+    {
+        if(row<nv)       return 1;
+        if(row<nv+ne)    return 2;
+        if(row<nv+ne+nf) return m.verts_per_face(row-nv-ne);
+        return m.verts_per_poly(row-nv-ne-nf);
+    },
+    [&](const uint row, int * vids)
+    {
+        if(row<nv)
+        {
+            vids[0] = row;
+        }
+        else if(row<nv+ne)
+        {
+            vids[0] = m.edge_vert_id(row-nv,0);
+            vids[1] = m.edge_vert_id(row-nv,1);
+        }
+        else if(row<nv+ne+nf)
+        {
+            std::copy(m.adj_f2v(row-nv-ne).begin(), m.adj_f2v(row-nv-ne).end(), vids);
+        }
+        else
+        {
+            std::copy(m.adj_p2v(row-nv-ne-nf).begin(), m.adj_p2v(row-nv-ne-nf).end(), vids);
+        }
+    });
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Mesh, class M, class V, class E, class P>
+CINO_INLINE
+void subdivision_refine(const Trimesh<M,V,E,P>   & m,
+                        const int                  scheme,
+                        const std::vector<vec3d> & verts,
+                              Mesh               & m_out)
+{
+    assert(scheme==SUBDIVISION_1_TO_4);
+    assert(verts.size()==m.num_verts()+m.num_edges());
+
+    uint nv = m.num_verts();
+    std::vector<uint> tris(12*m.num_polys());
+    PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+    {
+        uint v[] = { m.poly_vert_id(pid,0), m.poly_vert_id(pid,1), m.poly_vert_id(pid,2) };
+        if(!m.poly_verts_are_CCW(pid,v[1],v[0])) std::swap(v[1],v[0]);
+        uint v01 = nv + m.edge_id(v[0],v[1]);
+        uint v12 = nv + m.edge_id(v[1],v[2]);
+        uint v02 = nv + m.edge_id(v[0],v[2]);
+        subdivision_1_to_4_children(v, v01, v12, v02, &tris[12*pid]);
+    });
+    m_out.clear();
+    m_out.init(verts, polys_from_serialized_vids(tris,3));
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Mesh, class M, class V, class E, class F, class P>
+CINO_INLINE
+void subdivision_refine(const Tetmesh<M,V,E,F,P> & m,
+                        const int                  scheme,
+                        const std::vector<vec3d> & verts,
+                              Mesh               & m_out)
+{
+    uint nv = m.num_verts();
+    uint ne = m.num_edges();
+    uint nf = m.num_faces();
+    std::vector<uint> tets;
+
+    switch(scheme)
+    {
+        case SUBDIVISION_LOOP:
+        {
+            assert(verts.size()==nv+ne);
+            assert(m_out.mesh_type()==TETMESH);
+            tets.resize(32*m.num_polys());
+            PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+            {
+                uint v[] =
+                {
+                    m.poly_vert_id(pid,0),
+                    m.poly_vert_id(pid,1),
+                    m.poly_vert_id(pid,2),
+                    m.poly_vert_id(pid,3)
+                };
+                uint e[] =
+                {
+                    nv + m.edge_id(v[0],v[1]),
+                    nv + m.edge_id(v[1],v[2]),
+                    nv + m.edge_id(v[2],v[0]),
+                    nv + m.edge_id(v[0],v[3]),
+                    nv + m.edge_id(v[1],v[3]),
+                    nv + m.edge_id(v[2],v[3])
+                };
+                subdivision_Loop_children(v, e, &tets[32*pid]);
+            });
+            m_out.clear();
+            m_out.init(verts, polys_from_serialized_vids(tets,4));
+            break;
+        }
+
+        case SUBDIVISION_BARYCENTRIC:
+        {
+            assert(verts.size()==nv+ne+nf+m.num_polys());
+            assert(m_out.mesh_type()==TETMESH);
+            tets.resize(96*m.num_polys());
+            PARALLEL_FOR(0, m.num_polys(), 1000, [&](uint pid)
+            {
+                uint f[4][3], e[4][3], fc[4];
+                for(uint i=0; i<4; ++i)
+                {
+                    for(uint j=0; j<3; ++j) f[i][j] = m.poly_vert_id(pid, TET_FACES[i][j]);
+                    for(uint j=0; j<3; ++j) e[i][j] = nv + m.edge_id(f[i][j], f[i][(j+1)%3]);
+                    fc[i] = nv + ne + m.face_id({f[i][0], f[i][1], f[i][2]});
+                }
+                subdivision_barycentric_children(f, e, fc, nv+ne+nf+pid, &tets[96*pid]);
+            });
+            m_out.clear();
+            m_out.init(verts, polys_from_serialized_vids(tets,4));
+            break;
+        }
+
+        case SUBDIVISION_MIDPOINT: subdivision_midpoint(m, m_out); break;
+
+        default: assert(false);
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class Mesh, class M, class V, class E, class F, class P>
+CINO_INLINE
+void subdivision_refine(const AbstractPolyhedralMesh<M,V,E,F,P> & m,
+                        const int                                 scheme,
+                        const std::vector<vec3d>                & verts,
+                              Mesh                              & m_out)
+{
+    assert(scheme==SUBDIVISION_MIDPOINT);
+    assert(verts.size()==m.num_verts()+m.num_edges()+m.num_faces()+m.num_polys());
+    subdivision_midpoint(m, m_out);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+template<class RowSize, class RowVerts>
+CINO_INLINE
+Eigen::SparseMatrix<double,Eigen::RowMajor> averaging_stencil(const uint       n_rows,
+                                                              const uint       n_cols,
+                                                              const RowSize  & row_size,
+                                                              const RowVerts & row_verts)
+{
+    // row sizes are known in advance, hence the matrix is filled directly in CSR format, in parallel
+    std::vector<uint> offset(n_rows+1, 0);
+    for(uint row=0; row<n_rows; ++row) offset[row+1] = offset[row] + row_size(row);
+
+    Eigen::SparseMatrix<double,Eigen::RowMajor> S(n_rows, n_cols);
+    S.resizeNonZeros(offset.back());
+    int    *outer = S.outerIndexPtr();
+    int    *inner = S.innerIndexPtr();
+    double *value = S.valuePtr();
+    for(uint row=0; row<=n_rows; ++row) outer[row] = offset[row];
+
+    PARALLEL_FOR(0, n_rows, 1000, [&](uint row)
+    {
+        uint beg = offset[row];
+        uint end = offset[row+1];
+        row_verts(row, inner+beg);
+        std::sort(inner+beg, inner+end);
+        for(uint i=beg; i<end; ++i) value[i] = 1.0/double(end-beg);
+    });
+    return S;
+}
+
+}
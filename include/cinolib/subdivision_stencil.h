@@ -0,0 +1,171 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_SUBDIVISION_STENCIL_H
+#define CINO_SUBDIVISION_STENCIL_H
+
+#include <cinolib/meshes/meshes.h>
+#include <Eigen/Sparse>
+
+namespace cinolib
+{
+
+enum
+{
+    SUBDIVISION_1_TO_4,      // triangle meshes (see subdivision_1_to_4)
+    SUBDIVISION_LOOP,        // tet meshes      (see subdivision_Loop)
+    SUBDIVISION_BARYCENTRIC, // tet meshes      (see subdivision_barycentric)
+    SUBDIVISION_MIDPOINT     // volume meshes, refined as hexmeshes or polyhedral meshes (see subdivision_midpoint)
+};
+
+/* Subdivision of control meshes that change their positions but not their topology
+ * (e.g. deforming cages, or animations).
+ *
+ * All the schemes above place the new vertices at averages of the old ones (edge
+ * midpoints, face and element centroids) and append them after the old vertices.
+ * The positions of the refined vertices are therefore a linear function of the
+ * control positions, encoded by a sparse stencil matrix S (one row per refined
+ * vertex, one column per control vertex). Both the refined mesh and S are built
+ * once for a given control topology and number of levels (the stencils of the
+ * single levels are chained into one matrix). Afterwards, each update of the
+ * control positions costs one parallel SpMV, which writes directly into the
+ * vertices of the refined mesh. Per vertex fields (colors, uvw, ...) can be
+ * refined with the same stencil.
+ *
+ * Mesh is the type of the refined mesh. For drawable meshes, call updateGL()
+ * after each update.
+*/
+
+template<class Mesh>
+class CachedSubdivision
+{
+    public:
+
+        explicit CachedSubdivision(){}
+
+        template<class ControlMesh>
+        explicit CachedSubdivision(const ControlMesh & m,
+                                   const int           scheme,
+                                   const uint          levels = 1);
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        template<class ControlMesh>
+        void build(const ControlMesh & m,
+                   const int           scheme,
+                   const uint          levels = 1);
+
+        void update(const std::vector<vec3d> & control_verts);
+
+        template<typename T>
+        std::vector<T> refine_field(const std::vector<T> & control_field) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        const Mesh & mesh() const { return refined; }
+              Mesh & mesh()       { return refined; }
+
+        const Eigen::SparseMatrix<double,Eigen::RowMajor> & stencil() const { return S; }
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+    protected:
+
+        Mesh                                        refined;
+        Eigen::SparseMatrix<double,Eigen::RowMajor> S;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// stencil of one level of subdivision: the old vertices, followed by the edge
+// midpoints and, for the barycentric and midpoint schemes, by the face and
+// element centroids (in the order of the respective ids)
+//
+template<class M, class V, class E, class P>
+CINO_INLINE
+Eigen::SparseMatrix<double,Eigen::RowMajor> subdivision_stencil(const Trimesh<M,V,E,P> & m,
+                                                                const int                scheme);
+
+template<class M, class V, class E, class F, class P>
+CINO_INLINE
+Eigen::SparseMatrix<double,Eigen::RowMajor> subdivision_stencil(const AbstractPolyhedralMesh<M,V,E,F,P> & m,
+                                                                const int                                 scheme);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// one level of subdivision of m into m_out, given the refined vertices.
+// Unlike the in place subdivision routines, the refined connectivity is
+// generated in parallel (element by element) and the mesh is built at once
+//
+template<class Mesh, class M, class V, class E, class P>
+CINO_INLINE
+void subdivision_refine(const Trimesh<M,V,E,P>   & m,
+                        const int                  scheme,
+                        const std::vector<vec3d> & verts,
+                              Mesh               & m_out);
+
+template<class Mesh, class M, class V, class E, class F, class P>
+CINO_INLINE
+void subdivision_refine(const Tetmesh<M,V,E,F,P> & m,
+                        const int                  scheme,
+                        const std::vector<vec3d> & verts,
+                              Mesh               & m_out);
+
+template<class Mesh, class M, class V, class E, class F, class P>
+CINO_INLINE
+void subdivision_refine(const AbstractPolyhedralMesh<M,V,E,F,P> & m,
+                        const int                                 scheme,
+                        const std::vector<vec3d>                & verts,
+                              Mesh                              & m_out);
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// stencil that averages groups of control vertices. Row i has row_size(i)
+// entries, and row_verts(i,vids) writes its vertices into vids
+//
+template<class RowSize, class RowVerts>
+CINO_INLINE
+Eigen::SparseMatrix<double,Eigen::RowMajor> averaging_stencil(const uint       n_rows,
+                                                              const uint       n_cols,
+                                                              const RowSize  & row_size,
+                                                              const RowVerts & row_verts);
+
+}
+
+#ifndef  CINO_STATIC_LIB
+#include "subdivision_stencil.cpp"
+#endif
+
+#endif // CINO_SUBDIVISION_STENCIL_H
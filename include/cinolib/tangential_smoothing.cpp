@@ -62,7 +62,7 @@ void tangential_smoothing(Trimesh<M,V,E,P> & m, const uint vid)
     }
     delta /= norm_fact;
     delta -= m.vert(vid);
-    delta -= m.vert_data(vid).normal * delta.dot(m.vert_data(vid).normal);
+    delta -= m.vert_normal(vid) * delta.dot(m.vert_normal(vid));
     m.vert(vid) += delta;
 
     // update normals
@@ -55,6 +55,7 @@ void hex_to_tets(const Hexmesh<M,V,E,F,P> & hm,
     {
         uint id = tm.vert_add(hm.vert(vid));
         tm.vert_data(id) = hm.vert_data(vid);
+        tm.vert_channels().copy(id, hm.vert_channels(), vid);
     }
 
     for(uint pid=0; pid<hm.num_polys(); ++pid)
@@ -67,6 +68,7 @@ void hex_to_tets(const Hexmesh<M,V,E,F,P> & hm,
         {
             uint id = tm.poly_add(tet);
             tm.poly_data(id) = hm.poly_data(pid);
+            tm.poly_channels().copy(id, hm.poly_channels(), pid);
         }
     }
 }
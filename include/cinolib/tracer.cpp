@@ -0,0 +1,305 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#include <cinolib/tracer.h>
+#include <cinolib/memory_usage.h>
+#include <cinolib/min_max_inf.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <locale>
+#include <map>
+
+namespace cinolib
+{
+
+// ties the lifetime of a trace buffer to the lifetime of the thread using it
+struct TraceBufferHandle
+{
+    TraceBuffer *b = nullptr;
+   ~TraceBufferHandle() { if(b!=nullptr) Tracer::instance().release_buffer(b); }
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Tracer & Tracer::instance()
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+Tracer::Tracer() : origin(std::chrono::steady_clock::now()), peak_mem(0)
+{}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+int64_t Tracer::now() const
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now() - origin).count();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+TraceBuffer * Tracer::acquire_buffer()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(auto & b : buffers)
+    {
+        if(!b->in_use)
+        {
+            b->in_use = true;
+            b->depth  = 0;
+            return b.get();
+        }
+    }
+    buffers.push_back(std::unique_ptr<TraceBuffer>(new TraceBuffer));
+    buffers.back()->tid    = uint(buffers.size()-1);
+    buffers.back()->in_use = true;
+    return buffers.back().get();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void Tracer::release_buffer(TraceBuffer *b)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    b->in_use = false;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+TraceBuffer & Tracer::local()
+{
+    static thread_local TraceBufferHandle h;
+    if(h.b==nullptr) h.b = acquire_buffer();
+    return *h.b;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+uint Tracer::begin(const char *name)
+{
+    TraceBuffer & b = local();
+    b.events.push_back({name, now(), -1, b.depth++, 'X', 0.0});
+    return uint(b.events.size()-1);
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void Tracer::end(const uint id)
+{
+    TraceBuffer & b = local();
+    b.events[id].t_end = now();
+    --b.depth;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void Tracer::counter(const char *name, const double value)
+{
+    TraceBuffer & b = local();
+    b.events.push_back({name, now(), -1, b.depth, 'C', value});
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+size_t Tracer::sample_memory()
+{
+    size_t m    = memory_usage_in_bytes();
+    size_t peak = peak_mem.load();
+    while(m>peak && !peak_mem.compare_exchange_weak(peak,m)) {}
+    counter("memory (MB)", double(m)/(1024.0*1024.0));
+    return m;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void Tracer::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(auto & b : buffers) b->events.clear();
+    peak_mem = 0;
+    origin   = std::chrono::steady_clock::now();
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+CINO_INLINE
+void Tracer::report() const
+{
+    struct ScopeStats
+    {
+        const char *name;
+        uint        depth;
+        uint        calls;
+        double      time; // s
+    };
+    struct CounterStats
+    {
+        uint   samples = 0;
+        double last    = 0;
+        double max     = -inf_double;
+    };
+
+    // scopes are keyed by their full path within the call tree. The separator
+    // sorts before any printable character, hence children immediately follow
+    // their parent in the map, and the map visit prints the aggregated tree
+    std::map<std::string,ScopeStats>   scopes;
+    std::map<std::string,CounterStats> counters;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    int64_t t_now = now();
+    for(const auto & b : buffers)
+    {
+        std::vector<std::string> path;
+        for(const TraceEvent & e : b->events)
+        {
+            if(e.type=='C')
+            {
+                CounterStats & c = counters[e.name];
+                c.samples++;
+                c.last = e.value;
+                c.max  = std::max(c.max, e.value);
+                continue;
+            }
+            path.resize(e.depth);
+            path.push_back(e.depth>0 ? path.back() + '\x1f' + e.name : std::string(e.name));
+            ScopeStats & s = scopes.emplace(path.back(), ScopeStats{e.name, e.depth, 0, 0.0}).first->second;
+            s.calls++;
+            s.time += double((e.t_end<0 ? t_now : e.t_end) - e.t_beg) * 1e-9;
+        }
+    }
+
+    std::cout << "::::::::::::::: TRACER REPORT (" << buffers.size() << " thread buffers) :::::::::::::::" << std::endl;
+    for(const auto & obj : scopes)
+    {
+        const ScopeStats & s = obj.second;
+        std::string indent(4*s.depth, ' ');
+        printf("%s%-*s %10u calls %12.6fs\n", indent.c_str(), std::max(1,48-int(indent.size())), s.name, s.calls, s.time);
+    }
+    for(const auto & obj : counters)
+    {
+        const CounterStats & c = obj.second;
+        printf("[counter] %-38s %10u samples  last: %g  max: %g\n", obj.first.c_str(), c.samples, c.last, c.max);
+    }
+    if(peak_mem>0) printf("peak memory: %.2fMB\n", double(peak_mem)/(1024.0*1024.0));
+    std::cout << "::::::::::::::::::::::::::::::::::::::::::::::::::\n" << std::endl;
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+namespace
+{
+    // minimal JSON string escaping for event names
+    inline void json_escaped(std::ostream & out, const char *s)
+    {
+        for(; *s!='\0'; ++s)
+        {
+            unsigned char c = static_cast<unsigned char>(*s);
+            if(c=='"' || c=='\\') out << '\\' << char(c); else
+            if(c<0x20)            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+            else                  out << char(c);
+        }
+    }
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+//
+CINO_INLINE
+bool Tracer::write_chrome_trace(const char *filename) const
+{
+    std::ofstream f(filename);
+
+    if(!f.is_open())
+    {
+        std::cerr << "ERROR : " << __FILE__ << ", line " << __LINE__ << " : write_chrome_trace() : couldn't save file " << filename << std::endl;
+        return false;
+    }
+
+    // makes sure "." is the decimal separator, without touching the global locale
+    f.imbue(std::locale::classic());
+    f << std::fixed << std::setprecision(3);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    int64_t t_now = now();
+    bool    first = true;
+    f << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for(const auto & b : buffers)
+    {
+        for(const TraceEvent & e : b->events)
+        {
+            if(!first) f << ",\n";
+            first = false;
+            f << "{\"name\":\"";
+            json_escaped(f, e.name);
+            if(e.type=='X')
+            {
+                int64_t t_end = (e.t_end<0) ? t_now : e.t_end;
+                f << "\",\"cat\":\"cinolib\",\"ph\":\"X\",\"pid\":0,\"tid\":" << b->tid
+                  << ",\"ts\":" << double(e.t_beg)*1e-3 << ",\"dur\":" << double(t_end-e.t_beg)*1e-3 << "}";
+            }
+            else
+            {
+                f << "\",\"cat\":\"cinolib\",\"ph\":\"C\",\"pid\":0,\"tid\":" << b->tid
+                  << ",\"ts\":" << double(e.t_beg)*1e-3 << ",\"args\":{\"value\":"
+                  << std::defaultfloat << std::setprecision(17) << e.value
+                  << std::fixed        << std::setprecision(3)  << "}}";
+            }
+        }
+    }
+    f << "\n]}\n";
+    f.close();
+    return true;
+}
+
+}
@@ -0,0 +1,204 @@
+/********************************************************************************
+*  This file is part of CinoLib                                                 *
+*  Copyright(C) 2026: Marco Livesu                                              *
+*                                                                               *
+*  The MIT License                                                              *
+*                                                                               *
+*  Permission is hereby granted, free of charge, to any person obtaining a      *
+*  copy of this software and associated documentation files (the "Software"),   *
+*  to deal in the Software without restriction, including without limitation    *
+*  the rights to use, copy, modify, merge, publish, distribute, sublicense,     *
+*  and/or sell copies of the Software, and to permit persons to whom the        *
+*  Software is furnished to do so, subject to the following conditions:         *
+*                                                                               *
+*  The above copyright notice and this permission notice shall be included in   *
+*  all copies or substantial portions of the Software.                          *
+*                                                                               *
+*  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   *
+*  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     *
+*  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE *
+*  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       *
+*  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING      *
+*  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS *
+*  IN THE SOFTWARE.                                                             *
+*                                                                               *
+*  Author(s):                                                                   *
+*                                                                               *
+*     Marco Livesu (marco.livesu@gmail.com)                                     *
+*     http://pers.ge.imati.cnr.it/livesu/                                       *
+*                                                                               *
+*     Italian National Research Council (CNR)                                   *
+*     Institute for Applied Mathematics and Information Technologies (IMATI)    *
+*     Via de Marini, 6                                                          *
+*     16149 Genoa,                                                              *
+*     Italy                                                                     *
+*********************************************************************************/
+#ifndef CINO_TRACER_H
+#define CINO_TRACER_H
+
+#include <cinolib/cino_inline.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cinolib
+{
+
+/* Low overhead instrumentation layer, meant to see where time goes inside long running
+ * algorithms. Differently from the Profiler class (which keeps a single call tree and is
+ * therefore confined to serial code), the Tracer can be used from inside PARALLEL_FOR
+ * bodies: each thread records its events into a private buffer, and buffers are merged
+ * only when a report or a trace file is requested. Event names are string literals, so
+ * recording an event never allocates strings.
+ *
+ * Three kinds of data are recorded:
+ *
+ *  - scopes   => RAII timers (ScopedTimer) that measure the lifetime of a C++ scope.
+ *                Nested scopes are nested in the report as well
+ *  - counters => named numerical values sampled over time (e.g. the size of a front)
+ *  - memory   => the resident memory of the process (see memory_usage_in_bytes),
+ *                recorded as a counter. The high-water mark is tracked too
+ *
+ * Data can be printed on stdout as an aggregated call tree, or exported in the Trace
+ * Event JSON format, which can be loaded into chrome://tracing or https://ui.perfetto.dev
+ *
+ * Client code should NOT use the classes below directly, but the CINO_PROFILE_* macros at
+ * the bottom of this file, which expand to nothing unless CINOLIB_PROFILING is defined.
+ * This way instrumented code has zero cost in production builds.
+ *
+ * NOTE: report(), write_chrome_trace() and reset() must be called when no other thread
+ * is recording events (i.e. outside of parallel sections).
+*/
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+struct TraceEvent
+{
+    const char *name;
+    int64_t     t_beg; // ns, relative to the tracer origin
+    int64_t     t_end; // ns, relative to the tracer origin (scopes only)
+    uint        depth; // nesting level within the thread (scopes only)
+    char        type;  // 'X' for scopes, 'C' for counters
+    double      value; // counters only
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+struct TraceBuffer
+{
+    std::vector<TraceEvent> events;
+    uint                    tid;
+    uint                    depth  = 0;
+    bool                    in_use = false;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+class Tracer
+{
+    public:
+
+        static Tracer & instance();
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        uint   begin  (const char *name);
+        void   end    (const uint  id);
+        void   counter(const char *name, const double value);
+        size_t sample_memory();
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        size_t peak_memory_in_bytes() const { return peak_mem; }
+        void   reset();
+        void   report() const;
+        bool   write_chrome_trace(const char *filename) const;
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        // buffers are owned by the tracer and recycled when the thread that
+        // used them terminates (PARALLEL_FOR spawns new threads at each call)
+        TraceBuffer * acquire_buffer();
+        void          release_buffer(TraceBuffer *b);
+
+    protected:
+
+        Tracer();
+
+        int64_t       now() const;
+        TraceBuffer & local();
+
+        //::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+        std::chrono::steady_clock::time_point     origin;
+        std::atomic<size_t>                       peak_mem;
+        mutable std::mutex                        mutex;
+        std::vector<std::unique_ptr<TraceBuffer>> buffers;
+};
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+class ScopedTimer
+{
+    public:
+
+        explicit ScopedTimer(const char *name) : id(Tracer::instance().begin(name)) {}
+        ~ScopedTimer() { Tracer::instance().end(id); }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer & operator=(const ScopedTimer &) = delete;
+
+    private:
+
+        uint id;
+};
+
+}
+
+//::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+#define CINO_TRACE_CONCAT_IMPL(a,b) a##b
+#define CINO_TRACE_CONCAT(a,b)      CINO_TRACE_CONCAT_IMPL(a,b)
+
+// CINO_PROFILE_SCOPE times the rest of the enclosing scope. CINO_PROFILE_BLOCK times the
+// statement that follows it only (e.g. a loop), without wrapping it into a new scope
+//
+#ifdef CINOLIB_PROFILING
+#define CINO_PROFILE_SCOPE(name)          cinolib::ScopedTimer CINO_TRACE_CONCAT(cino_scoped_timer_,__LINE__)(name)
+#define CINO_PROFILE_BLOCK(name)          for(cinolib::ScopedTimer cino_block_timer(name), *cino_block_once = &cino_block_timer; cino_block_once; cino_block_once = nullptr)
+#define CINO_PROFILE_COUNTER(name,value)  cinolib::Tracer::instance().counter(name,double(value))
+#define CINO_PROFILE_MEMORY()             cinolib::Tracer::instance().sample_memory()
+#else
+#define CINO_PROFILE_SCOPE(name)          ((void)0)
+#define CINO_PROFILE_BLOCK(name)
+#define CINO_PROFILE_COUNTER(name,value)  ((void)0)
+#define CINO_PROFILE_MEMORY()             ((void)0)
+#endif
+
+#ifndef  CINO_STATIC_LIB
+#include "tracer.cpp"
+#endif
+
+#endif // CINO_TRACER_H
+
+
+/* EXAMPLE (compile with -DCINOLIB_PROFILING)
+
+        void foo(const DrawableTrimesh<> & m)
+        {
+            CINO_PROFILE_SCOPE("foo");
+            PARALLEL_FOR(0, m.num_polys(), 1000, [&](const uint pid)
+            {
+                CINO_PROFILE_SCOPE("foo::poly");
+                ...
+            });
+            CINO_PROFILE_MEMORY();
+        }
+
+        Tracer::instance().report();
+        Tracer::instance().write_chrome_trace("foo.json");
+*/
@@ -97,7 +97,7 @@ void voxel_grid_to_hexmesh(const VoxelGrid                         & g,
             }
             // add voxel
             uint pid = m.poly_add(faces,winding);
-            m.poly_data(pid).label = g.voxels[id];
+            m.poly_label(pid) = g.voxels[id];
         }
     }
 }